@@ -0,0 +1,8 @@
+#ifndef ECORE_BENCH_H_
+#define ECORE_BENCH_H_
+
+void ecore_bench_timer(Eina_Benchmark *bench);
+
+#define _ECORE_BENCH_TIMES(Start, Repeat, Jump) (Start), ((Start) + ((Jump) * (Repeat))), (Jump)
+
+#endif
@@ -0,0 +1,101 @@
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+
+#include <stdlib.h>
+
+#include <Eina.h>
+#include <Ecore.h>
+
+#include "ecore_bench.h"
+
+#define REARM_ROUNDS 10
+
+static Eina_Bool
+_timer_cb(void *data EINA_UNUSED)
+{
+   return ECORE_CALLBACK_RENEW;
+}
+
+static Ecore_Timer **
+_timers_add(int request)
+{
+   Ecore_Timer **timers;
+   int i;
+
+   timers = malloc(request * sizeof (Ecore_Timer *));
+   if (!timers) return NULL;
+
+   srand(request);
+   // long enough to never expire during the run, spread like a set of
+   // connection timeouts
+   for (i = 0; i < request; i++)
+     timers[i] = ecore_timer_add(60.0 + (rand() % 6000) / 100.0, _timer_cb, NULL);
+   ecore_main_loop_iterate();
+   return timers;
+}
+
+static void
+_timers_del(Ecore_Timer **timers, int request)
+{
+   int i;
+
+   for (i = 0; i < request; i++)
+     ecore_timer_del(timers[i]);
+   free(timers);
+}
+
+static void
+bench_timer_add_del(int request)
+{
+   _timers_del(_timers_add(request), request);
+}
+
+static void
+bench_timer_reset(int request)
+{
+   Ecore_Timer **timers;
+   int i, j;
+
+   timers = _timers_add(request);
+   if (!timers) return;
+
+   // what an inactivity timeout does on every read
+   for (j = 0; j < REARM_ROUNDS; j++)
+     {
+        for (i = 0; i < request; i++)
+          ecore_timer_reset(timers[rand() % request]);
+        ecore_main_loop_iterate();
+     }
+
+   _timers_del(timers, request);
+}
+
+static void
+bench_timer_delay(int request)
+{
+   Ecore_Timer **timers;
+   int i, j;
+
+   timers = _timers_add(request);
+   if (!timers) return;
+
+   for (j = 0; j < REARM_ROUNDS; j++)
+     {
+        for (i = 0; i < request; i++)
+          ecore_timer_delay(timers[rand() % request], (rand() % 200 - 100) / 100.0);
+        ecore_main_loop_iterate();
+     }
+
+   _timers_del(timers, request);
+}
+
+void ecore_bench_timer(Eina_Benchmark *bench)
+{
+   eina_benchmark_register(bench, "timer_add_del",
+         EINA_BENCHMARK(bench_timer_add_del), _ECORE_BENCH_TIMES(10000, 10, 10000));
+   eina_benchmark_register(bench, "timer_reset",
+         EINA_BENCHMARK(bench_timer_reset), _ECORE_BENCH_TIMES(10000, 10, 10000));
+   eina_benchmark_register(bench, "timer_delay",
+         EINA_BENCHMARK(bench_timer_delay), _ECORE_BENCH_TIMES(10000, 10, 10000));
+}
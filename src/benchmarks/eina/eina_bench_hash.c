@@ -279,6 +279,95 @@ eina_bench_lookup_superfast(int request)
    eina_hash_free(hash);
 }
 
+static void
+eina_bench_lookup_flat(int request)
+{
+   Eina_Hash *hash = NULL;
+   int *tmp_val;
+   unsigned int i;
+   unsigned int j;
+
+   hash = eina_hash_flat_string_new(free);
+
+   for (i = 0; i < (unsigned int)request; ++i)
+     {
+        char tmp_key[10];
+
+        tmp_val = malloc(sizeof (int));
+
+        if (!tmp_val)
+           continue;
+
+        eina_convert_itoa(i, tmp_key);
+        *tmp_val = i;
+
+        eina_hash_add(hash, tmp_key, tmp_val);
+     }
+
+   srand(time(NULL));
+
+   for (j = 0; j < 200; ++j)
+      for (i = 0; i < (unsigned int)request; ++i)
+        {
+           char tmp_key[10];
+
+           eina_convert_itoa(rand() % request, tmp_key);
+           tmp_val = eina_hash_find(hash, tmp_key);
+        }
+
+   eina_hash_free(hash);
+}
+
+static void
+_eina_bench_lookup_pointer(Eina_Hash *hash, int request)
+{
+   void **keys;
+   void *tmp_val;
+   unsigned int i;
+   unsigned int j;
+
+   keys = malloc(request * sizeof (void *));
+   if (!keys) return;
+
+   for (i = 0; i < (unsigned int)request; ++i)
+     {
+        keys[i] = malloc(sizeof (int));
+        eina_hash_add(hash, &keys[i], keys[i]);
+     }
+
+   srand(time(NULL));
+
+   for (j = 0; j < 200; ++j)
+      for (i = 0; i < (unsigned int)request; ++i)
+        tmp_val = eina_hash_find(hash, &keys[rand() % request]);
+
+   /* Same churn as objects being added/removed from a pointer hash */
+   for (j = 0; j < 10; ++j)
+      for (i = 0; i < (unsigned int)request; ++i)
+        {
+           eina_hash_del(hash, &keys[i], keys[i]);
+           eina_hash_add(hash, &keys[i], keys[i]);
+        }
+
+   eina_hash_free(hash);
+   for (i = 0; i < (unsigned int)request; ++i)
+     free(keys[i]);
+   free(keys);
+   (void) tmp_val;
+}
+
+static void
+eina_bench_lookup_pointer(int request)
+{
+   _eina_bench_lookup_pointer(eina_hash_pointer_new(NULL), request);
+}
+
+static void
+eina_bench_lookup_flat_pointer(int request)
+{
+   _eina_bench_lookup_pointer(eina_hash_flat_pointer_new(NULL), request);
+}
+
 static void
 eina_bench_lookup_djb2(int request)
 {
@@ -519,6 +608,15 @@ void eina_bench_hash(Eina_Benchmark *bench)
    eina_benchmark_register(bench, "superfast-lookup",
                            EINA_BENCHMARK(
                               eina_bench_lookup_superfast),   10, 10000, 10);
+   eina_benchmark_register(bench, "flat-superfast-lookup",
+                           EINA_BENCHMARK(
+                              eina_bench_lookup_flat),        10, 10000, 10);
+   eina_benchmark_register(bench, "pointer-lookup",
+                           EINA_BENCHMARK(
+                              eina_bench_lookup_pointer),     10, 10000, 10);
+   eina_benchmark_register(bench, "flat-pointer-lookup",
+                           EINA_BENCHMARK(
+                              eina_bench_lookup_flat_pointer), 10, 10000, 10);
    eina_benchmark_register(bench, "djb2-lookup",
                            EINA_BENCHMARK(
                               eina_bench_lookup_djb2),        10, 10000, 10);
@@ -28,7 +28,7 @@
 #include "Eina.h"
 
 static void
-_eina_mempool_bench(Eina_Mempool *mp, int request)
+_eina_mempool_bench_full(Eina_Mempool *mp, int request, Eina_Bool reset)
 {
    Eina_Array *array;
    int i;
@@ -44,6 +44,14 @@ _eina_mempool_bench(Eina_Mempool *mp, int request)
              eina_array_push(array, eina_mempool_malloc(mp, sizeof (int)));
           }
 
+        if (reset)
+          {
+             // release the whole frame at once
+             eina_array_clean(array);
+             eina_mempool_reset(mp);
+             continue;
+          }
+
         for (j = 0; j < request; ++j)
           {
              eina_mempool_free(mp, eina_array_pop(array));
@@ -54,6 +62,12 @@ _eina_mempool_bench(Eina_Mempool *mp, int request)
    eina_shutdown();
 }
 
+static void
+_eina_mempool_bench(Eina_Mempool *mp, int request)
+{
+   _eina_mempool_bench_full(mp, request, EINA_FALSE);
+}
+
 #ifdef EINA_BUILD_CHAINED_POOL
 static void
 eina_mempool_chained_mempool(int request)
@@ -64,6 +78,41 @@ eina_mempool_chained_mempool(int request)
    _eina_mempool_bench(mp, request);
    eina_mempool_del(mp);
 }
+
+static void
+eina_mempool_chained_mempool_magazine(int request)
+{
+   Eina_Mempool *mp;
+
+   mp = eina_mempool_add("chained_mempool", "test", "magazine", sizeof (int), 256);
+   _eina_mempool_bench(mp, request);
+   eina_mempool_del(mp);
+}
+#endif
+
+#ifdef EINA_BUILD_ONE_BIG
+static void
+eina_mempool_one_big(int request)
+{
+   Eina_Mempool *mp;
+
+   // one_big expects to know the maximum number of items in advance
+   mp = eina_mempool_add("one_big", "test", NULL, sizeof (int), 10000);
+   _eina_mempool_bench(mp, request);
+   eina_mempool_del(mp);
+}
+#endif
+
+#ifdef EINA_BUILD_ARENA
+static void
+eina_mempool_arena(int request)
+{
+   Eina_Mempool *mp;
+
+   mp = eina_mempool_add("arena", "test", NULL, sizeof (int), 256);
+   _eina_mempool_bench_full(mp, request, EINA_TRUE);
+   eina_mempool_del(mp);
+}
 #endif
 
 #ifdef EINA_BUILD_PASS_THROUGH
@@ -115,6 +164,19 @@ eina_bench_mempool(Eina_Benchmark *bench)
    eina_benchmark_register(bench, "chained mempool",
                            EINA_BENCHMARK(
                               eina_mempool_chained_mempool), 10, 10000, 10);
+   eina_benchmark_register(bench, "chained mempool (magazine)",
+                           EINA_BENCHMARK(
+                              eina_mempool_chained_mempool_magazine), 10, 10000, 10);
+#endif
+#ifdef EINA_BUILD_ONE_BIG
+   eina_benchmark_register(bench, "one big",
+                           EINA_BENCHMARK(
+                              eina_mempool_one_big),         10, 10000, 10);
+#endif
+#ifdef EINA_BUILD_ARENA
+   eina_benchmark_register(bench, "arena",
+                           EINA_BENCHMARK(
+                              eina_mempool_arena),           10, 10000, 10);
 #endif
 #ifdef EINA_BUILD_PASS_THROUGH
    eina_benchmark_register(bench, "pass through",
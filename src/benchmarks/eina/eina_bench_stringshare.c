@@ -35,6 +35,8 @@
 #include "eina_bench.h"
 #include "eina_convert.h"
 #include "eina_main.h"
+#include "eina_cpu.h"
+#include "eina_thread.h"
 
 static void
 eina_bench_stringshare_job(int request)
@@ -69,6 +71,76 @@ eina_bench_stringshare_job(int request)
    eina_shutdown();
 }
 
+#define EINA_BENCH_STRINGSHARE_THREADS 8
+
+static void *
+_eina_bench_stringshare_thread(void *data, Eina_Thread t EINA_UNUSED)
+{
+   int request = (int)(uintptr_t)data;
+   const char *tmp;
+   unsigned int j;
+   int i;
+
+   /* Every thread works on the same strings, adding a reference to an
+    * existing one and dropping it again, like image loaders or eio jobs. */
+   for (j = 0; j < 50; ++j)
+      for (i = 0; i < request; ++i)
+        {
+           char build[64] = "string_";
+
+           eina_convert_xtoa(i, build + 7);
+           tmp = eina_stringshare_add(build);
+           eina_stringshare_del(tmp);
+        }
+
+   return NULL;
+}
+
+static void
+eina_bench_stringshare_threads_job(int request)
+{
+   Eina_Thread threads[EINA_BENCH_STRINGSHARE_THREADS];
+   const char **strings;
+   int count;
+   int i;
+
+   eina_init();
+   eina_threads_init();
+
+   count = eina_cpu_count();
+   if (count > EINA_BENCH_STRINGSHARE_THREADS)
+     count = EINA_BENCH_STRINGSHARE_THREADS;
+   if (count < 2) count = 2;
+
+   strings = malloc(request * sizeof (const char *));
+   if (!strings) goto end;
+
+   for (i = 0; i < request; ++i)
+     {
+        char build[64] = "string_";
+
+        eina_convert_xtoa(i, build + 7);
+        strings[i] = eina_stringshare_add(build);
+     }
+
+   for (i = 0; i < count; ++i)
+     if (!eina_thread_create(&threads[i], EINA_THREAD_NORMAL, -1,
+                             _eina_bench_stringshare_thread,
+                             (void *)(uintptr_t)request))
+       break;
+   count = i;
+   for (i = 0; i < count; ++i)
+     eina_thread_join(threads[i]);
+
+   for (i = 0; i < request; ++i)
+     eina_stringshare_del(strings[i]);
+   free(strings);
+
+ end:
+   eina_threads_shutdown();
+   eina_shutdown();
+}
+
 #ifdef EINA_BENCH_HAVE_GLIB
 static void
 eina_bench_stringchunk_job(int request)
@@ -171,6 +243,9 @@ void eina_bench_stringshare(Eina_Benchmark *bench)
    eina_benchmark_register(bench, "stringshare",
                            EINA_BENCHMARK(
                               eina_bench_stringshare_job), 100, 20100, 500);
+   eina_benchmark_register(bench, "stringshare (threads)",
+                           EINA_BENCHMARK(
+                              eina_bench_stringshare_threads_job), 100, 20100, 500);
 #ifdef EINA_BENCH_HAVE_GLIB
    eina_benchmark_register(bench, "stringchunk (glib)",
                            EINA_BENCHMARK(
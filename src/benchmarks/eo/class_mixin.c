@@ -0,0 +1,40 @@
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+
+#include "Eo.h"
+#include "class_mixin.h"
+
+#define MY_CLASS MIXIN_CLASS
+
+static void
+_b_set(Eo *obj EINA_UNUSED, void *class_data, int b)
+{
+   Mixin_Public_Data *pd = class_data;
+   pd->b = b;
+}
+
+EAPI EFL_VOID_FUNC_BODYV(mixin_b_set, EFL_FUNC_CALL(b), int b);
+
+static Eina_Bool
+_class_initializer(Efl_Class *klass)
+{
+   EFL_OPS_DEFINE(ops,
+         EFL_OBJECT_OP_FUNC(mixin_b_set, _b_set),
+   );
+
+   return efl_class_functions_set(klass, &ops, NULL);
+}
+
+static const Efl_Class_Description class_desc = {
+     EO_VERSION,
+     "Mixin",
+     EFL_CLASS_TYPE_MIXIN,
+     sizeof(Mixin_Public_Data),
+     _class_initializer,
+     NULL,
+     NULL
+};
+
+EFL_DEFINE_CLASS(mixin_class_get, &class_desc, NULL, NULL)
+
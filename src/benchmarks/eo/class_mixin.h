@@ -0,0 +1,14 @@
+#ifndef MIXIN_H
+#define MIXIN_H
+
+typedef struct
+{
+   int b;
+} Mixin_Public_Data;
+
+EAPI void mixin_b_set(Eo *self, int b);
+
+#define MIXIN_CLASS mixin_class_get()
+const Efl_Class *mixin_class_get(void);
+
+#endif
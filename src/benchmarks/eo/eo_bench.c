@@ -5,6 +5,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <limits.h>
+#include <string.h>
 
 #include <Eina.h>
 
@@ -31,8 +32,28 @@ main(int argc, char **argv)
    Eina_Benchmark *test;
    unsigned int i;
 
+   if ((argc >= 3) && !strcmp(argv[1], "--json"))
+     {
+        int ret;
+
+        eina_init();
+        efl_object_init();
+
+        ret = eo_bench_micro(argv[2], (argc > 3) ? argv[3] : NULL);
+
+        efl_object_shutdown();
+        eina_shutdown();
+        return ret;
+     }
+
    if (argc != 2)
-      return -1;
+     {
+        fprintf(stderr,
+                "Usage: %s <run name>\n"
+                "       %s --json <output.json|-> [baseline.json]\n",
+                argv[0], argv[0]);
+        return -1;
+     }
 
    eina_init();
    efl_object_init();
@@ -50,6 +71,8 @@ main(int argc, char **argv)
         eina_benchmark_free(test);
      }
 
+   eo_bench_eo_do_report();
+
    efl_object_shutdown();
    eina_shutdown();
 
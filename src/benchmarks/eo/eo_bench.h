@@ -2,9 +2,16 @@
 #define EINA_BENCH_H_
 
 void eo_bench_eo_do(Eina_Benchmark *bench);
+/* Prints what the call cache did during the eo_do cases. */
+void eo_bench_eo_do_report(void);
 void eo_bench_efl_add(Eina_Benchmark *bench);
 void eo_bench_callbacks(Eina_Benchmark *bench);
 
+/* Runs the call path micro benchmarks, writes them as JSON to output ("-"
+ * for stdout) and, given a baseline written by an earlier run, returns 1 if
+ * any case regressed. */
+int eo_bench_micro(const char *output, const char *baseline);
+
 #define _EO_BENCH_TIMES(Start, Repeat, Jump) (Start), ((Start) + ((Jump) * (Repeat))), (Jump)
 
 #endif
@@ -75,10 +75,34 @@ bench_eo_callbacks_call(int request)
      }
 }
 
+static void
+bench_eo_callbacks_call_many(int request)
+{
+   /* One callback hidden among many others for another event, the emission
+      should not have to look at all of them. */
+   int i;
+   Eo *obj = efl_add_ref(SIMPLE_CLASS, NULL);
+
+   for (i = 0 ; i < 64 ; i++)
+     {
+        efl_event_callback_priority_add(obj, SIMPLE_FOO, (short) i, _cb, NULL);
+     }
+   efl_event_callback_priority_add(obj, SIMPLE_BAR, 32, _cb, NULL);
+
+   for (i = 0 ; i < request ; i++)
+     {
+        efl_event_callback_call(obj, SIMPLE_BAR, NULL);
+     }
+
+   efl_unref(obj);
+}
+
 void eo_bench_callbacks(Eina_Benchmark *bench)
 {
    eina_benchmark_register(bench, "add",
          EINA_BENCHMARK(bench_eo_callbacks_add), _EO_BENCH_TIMES(1000, 10, 2000));
    eina_benchmark_register(bench, "call",
          EINA_BENCHMARK(bench_eo_callbacks_call), _EO_BENCH_TIMES(100000, 10, 500000));
+   eina_benchmark_register(bench, "call_many",
+         EINA_BENCHMARK(bench_eo_callbacks_call_many), _EO_BENCH_TIMES(100000, 10, 500000));
 }
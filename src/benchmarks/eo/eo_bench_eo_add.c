@@ -38,10 +38,41 @@ bench_efl_add_jump_by_2(int request)
    free(objs);
 }
 
+static void
+bench_efl_add_parent(int request)
+{
+   int i;
+   Eo *parent = efl_add_ref(SIMPLE_CLASS, NULL);
+   Eo **objs = calloc(request, sizeof(Eo *));
+   for (i = 0 ; i < request ; i++)
+      objs[i] = efl_add(SIMPLE_CLASS, parent);
+
+   for (i = 0 ; i < request ; i++)
+      efl_del(objs[i]);
+   free(objs);
+   efl_unref(parent);
+}
+
+static void
+bench_efl_add_bulk(int request)
+{
+   Eo *parent = efl_add_ref(SIMPLE_CLASS, NULL);
+   Eo **objs = calloc(request, sizeof(Eo *));
+   efl_add_bulk(SIMPLE_CLASS, parent, objs, request, NULL, NULL);
+
+   efl_del_bulk(objs, request);
+   free(objs);
+   efl_unref(parent);
+}
+
 void eo_bench_efl_add(Eina_Benchmark *bench)
 {
    eina_benchmark_register(bench, "efl_add_linear",
          EINA_BENCHMARK(bench_efl_add_linear), _EO_BENCH_TIMES(1000, 10, 50000));
    eina_benchmark_register(bench, "efl_add_jump_by_2",
          EINA_BENCHMARK(bench_efl_add_jump_by_2), _EO_BENCH_TIMES(1000, 10, 50000));
+   eina_benchmark_register(bench, "efl_add_parent",
+         EINA_BENCHMARK(bench_efl_add_parent), _EO_BENCH_TIMES(1000, 10, 50000));
+   eina_benchmark_register(bench, "efl_add_bulk",
+         EINA_BENCHMARK(bench_efl_add_bulk), _EO_BENCH_TIMES(1000, 10, 50000));
 }
@@ -2,6 +2,8 @@
 # include <config.h>
 #endif
 
+#include <stdio.h>
+
 #include "Eo.h"
 #include "eo_bench.h"
 #include "class_simple.h"
@@ -19,6 +21,88 @@ bench_eo_do_simple(int request)
    efl_unref(obj);
 }
 
+typedef struct _Call_Cache_Stats Call_Cache_Stats;
+struct _Call_Cache_Stats
+{
+   const char *name;
+   unsigned long long calls;
+   unsigned long long misses;
+};
+
+/* Filled by the timed runs, printed by eo_bench_eo_do_report() once they
+ * are all done so that no I/O ends up in the measurements. */
+static Call_Cache_Stats _simple_cached_stats = { "simple_cached", 0, 0 };
+static Call_Cache_Stats _polymorphic_stats = { "polymorphic", 0, 0 };
+
+static void
+_call_cache_stats_add(Call_Cache_Stats *stats, unsigned long long misses, int calls)
+{
+   stats->misses += efl_object_call_cache_misses_get() - misses;
+   stats->calls += calls;
+}
+
+static void
+_call_cache_stats_print(const Call_Cache_Stats *stats)
+{
+   printf("%s: %llu calls, %llu call cache misses, %.2f%% hit rate\n",
+          stats->name, stats->calls, stats->misses,
+          stats->calls ?
+          100.0 * (stats->calls - stats->misses) / stats->calls : 0.0);
+}
+
+static void
+bench_eo_do_simple_cached(int request)
+{
+   unsigned long long misses;
+   int i;
+   Eo *obj = efl_add_ref(SIMPLE_CLASS, NULL);
+
+   misses = efl_object_call_cache_misses_get();
+   for (i = 0 ; i < request ; i++)
+     {
+        simple_a_set(obj, i);
+     }
+   _call_cache_stats_add(&_simple_cached_stats, misses, request);
+
+   efl_unref(obj);
+}
+
+static void
+bench_eo_do_polymorphic(int request)
+{
+   static const Efl_Class_Description class_desc = {
+        EO_VERSION,
+        "SimpleChild",
+        EFL_CLASS_TYPE_REGULAR,
+        0,
+        NULL,
+        NULL,
+        NULL
+   };
+   static const Efl_Class *child_klass = NULL;
+   unsigned long long misses;
+   int i;
+
+   if (!child_klass)
+     child_klass = efl_class_new(&class_desc, SIMPLE_CLASS, NULL);
+
+   /* The same call site sees two classes in turn, the worst case for a
+    * cache that only remembers the last one. */
+   Eo *objs[2] = {
+        efl_add_ref(SIMPLE_CLASS, NULL),
+        efl_add_ref(child_klass, NULL)
+   };
+   misses = efl_object_call_cache_misses_get();
+   for (i = 0 ; i < request ; i++)
+     {
+        simple_a_set(objs[i & 1], i);
+     }
+   _call_cache_stats_add(&_polymorphic_stats, misses, request);
+
+   efl_unref(objs[0]);
+   efl_unref(objs[1]);
+}
+
 static void
 bench_eo_do_two_objs(int request)
 {
@@ -96,6 +180,10 @@ void eo_bench_eo_do(Eina_Benchmark *bench)
 {
    eina_benchmark_register(bench, "simple",
          EINA_BENCHMARK(bench_eo_do_simple), _EO_BENCH_TIMES(1000, 10, 500000));
+   eina_benchmark_register(bench, "simple_cached",
+         EINA_BENCHMARK(bench_eo_do_simple_cached), _EO_BENCH_TIMES(1000, 10, 500000));
+   eina_benchmark_register(bench, "polymorphic",
+         EINA_BENCHMARK(bench_eo_do_polymorphic), _EO_BENCH_TIMES(1000, 10, 500000));
    eina_benchmark_register(bench, "super",
          EINA_BENCHMARK(bench_eo_do_super),  _EO_BENCH_TIMES(1000, 10, 500000));
    eina_benchmark_register(bench, "two_objs",
@@ -103,3 +191,9 @@ void eo_bench_eo_do(Eina_Benchmark *bench)
    eina_benchmark_register(bench, "two_objs_growing_stack",
          EINA_BENCHMARK(bench_eo_do_two_objs_growing_stack), _EO_BENCH_TIMES(1000, 10, 40000));
 }
+
+void eo_bench_eo_do_report(void)
+{
+   _call_cache_stats_print(&_simple_cached_stats);
+   _call_cache_stats_print(&_polymorphic_stats);
+}
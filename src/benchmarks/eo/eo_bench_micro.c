@@ -0,0 +1,495 @@
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Eina.h>
+
+#include "Eo.h"
+#include "eo_bench.h"
+#include "eo_bench_perf.h"
+#include "class_simple.h"
+#include "class_mixin.h"
+
+/* Micro benchmarks of the call paths in eo.c. Unlike the eina_benchmark
+ * based cases, each case reports per call figures, hardware counters when
+ * they can be read, and the whole run is written as JSON so two runs can be
+ * compared, see eo_bench_micro(). */
+
+#define MICRO_REPEAT 5
+#define MICRO_THREADS 4
+
+/* A case is reported as a regression against a baseline when it got slower
+ * by more than this, in percent. Instruction counts are stable from one run
+ * to another, times are not. */
+#define MICRO_THRESHOLD_INSTRUCTIONS 3.0
+#define MICRO_THRESHOLD_NS 10.0
+
+typedef struct _Micro_Case Micro_Case;
+struct _Micro_Case
+{
+   const char *name;
+   unsigned int iterations;
+   void *(*setup)(void);
+   void (*run)(void *data, unsigned int iterations);
+   void (*teardown)(void *data);
+};
+
+typedef struct _Micro_Result Micro_Result;
+struct _Micro_Result
+{
+   const char *name;
+   unsigned int iterations;
+   double ns;
+   double counter[EO_BENCH_COUNTER_LAST];
+   Eina_Bool valid[EO_BENCH_COUNTER_LAST];
+};
+
+static volatile int _sink;
+
+static void *
+_simple_setup(void)
+{
+   return efl_add_ref(SIMPLE_CLASS, NULL);
+}
+
+static void
+_obj_teardown(void *data)
+{
+   efl_unref(data);
+}
+
+static void
+_call_simple(void *data, unsigned int iterations)
+{
+   unsigned int i;
+
+   for (i = 0; i < iterations; i++)
+     simple_a_set(data, i);
+}
+
+static const Efl_Class *_super_klass = NULL;
+
+static void
+_super_a_set(Eo *obj, void *class_data EINA_UNUSED, int a)
+{
+   simple_a_set(efl_super(obj, _super_klass), a);
+}
+
+static Eina_Bool
+_super_class_initializer(Efl_Class *klass)
+{
+   EFL_OPS_DEFINE(ops,
+         EFL_OBJECT_OP_FUNC(simple_a_set, _super_a_set),
+   );
+
+   return efl_class_functions_set(klass, &ops, NULL);
+}
+
+static void *
+_super_setup(void)
+{
+   static const Efl_Class_Description class_desc = {
+        EO_VERSION,
+        "Bench_Super",
+        EFL_CLASS_TYPE_REGULAR,
+        0,
+        _super_class_initializer,
+        NULL,
+        NULL
+   };
+
+   if (!_super_klass)
+     _super_klass = efl_class_new(&class_desc, SIMPLE_CLASS, NULL);
+   return efl_add_ref(_super_klass, NULL);
+}
+
+static const Efl_Class *
+_mixed_class_get(void)
+{
+   static const Efl_Class_Description class_desc = {
+        EO_VERSION,
+        "Bench_Mixed",
+        EFL_CLASS_TYPE_REGULAR,
+        0,
+        NULL,
+        NULL,
+        NULL
+   };
+   static const Efl_Class *klass = NULL;
+
+   if (!klass)
+     klass = efl_class_new(&class_desc, SIMPLE_CLASS, MIXIN_CLASS, NULL);
+   return klass;
+}
+
+static void *
+_mixed_setup(void)
+{
+   return efl_add_ref(_mixed_class_get(), NULL);
+}
+
+static void
+_call_mixin(void *data, unsigned int iterations)
+{
+   unsigned int i;
+
+   for (i = 0; i < iterations; i++)
+     mixin_b_set(data, i);
+}
+
+static void
+_data_scope_get(void *data, unsigned int iterations)
+{
+   Simple_Public_Data *pd;
+   unsigned int i;
+
+   for (i = 0; i < iterations; i++)
+     {
+        pd = efl_data_scope_get(data, SIMPLE_CLASS);
+        _sink = pd->a;
+     }
+}
+
+static void
+_data_scope_get_mixin(void *data, unsigned int iterations)
+{
+   Mixin_Public_Data *pd;
+   unsigned int i;
+
+   for (i = 0; i < iterations; i++)
+     {
+        pd = efl_data_scope_get(data, MIXIN_CLASS);
+        _sink = pd->b;
+     }
+}
+
+typedef struct
+{
+   Eo *obj;
+   unsigned int iterations;
+} Shared_Call;
+
+static void *
+_shared_setup(void)
+{
+   Eo *obj;
+
+   efl_domain_current_push(EFL_ID_DOMAIN_SHARED);
+   obj = efl_add_ref(SIMPLE_CLASS, NULL);
+   efl_domain_current_pop();
+   return obj;
+}
+
+static void *
+_shared_call_thread(void *data, Eina_Thread t EINA_UNUSED)
+{
+   Shared_Call *call = data;
+
+   _call_simple(call->obj, call->iterations);
+   return NULL;
+}
+
+static void
+_call_shared_threads(void *data, unsigned int iterations)
+{
+   Shared_Call calls[MICRO_THREADS];
+   Eina_Thread t[MICRO_THREADS];
+   Eina_Bool started[MICRO_THREADS];
+   unsigned int i;
+
+   for (i = 0; i < MICRO_THREADS; i++)
+     {
+        calls[i].obj = data;
+        calls[i].iterations = iterations / MICRO_THREADS;
+        started[i] = eina_thread_create(&t[i], EINA_THREAD_NORMAL, -1,
+                                        _shared_call_thread, &calls[i]);
+     }
+   for (i = 0; i < MICRO_THREADS; i++)
+     if (started[i]) eina_thread_join(t[i]);
+}
+
+static void
+_event_cb(void *data, const Efl_Event *event EINA_UNUSED)
+{
+   int *count = data;
+   (*count)++;
+}
+
+static int _event_count = 0;
+
+static void *
+_event_setup(int callbacks)
+{
+   Eo *obj = efl_add_ref(SIMPLE_CLASS, NULL);
+   int i;
+
+   for (i = 0; i < callbacks; i++)
+     efl_event_callback_add(obj, SIMPLE_FOO, _event_cb, &_event_count);
+   return obj;
+}
+
+static void *
+_event_0_setup(void)
+{
+   return _event_setup(0);
+}
+
+static void *
+_event_1_setup(void)
+{
+   return _event_setup(1);
+}
+
+static void *
+_event_8_setup(void)
+{
+   return _event_setup(8);
+}
+
+static void *
+_event_64_setup(void)
+{
+   return _event_setup(64);
+}
+
+static void
+_event_call(void *data, unsigned int iterations)
+{
+   unsigned int i;
+
+   for (i = 0; i < iterations; i++)
+     efl_event_callback_call(data, SIMPLE_FOO, NULL);
+}
+
+static void
+_wref_add_del(void *data, unsigned int iterations)
+{
+   Eo *wref;
+   unsigned int i;
+
+   for (i = 0; i < iterations; i++)
+     {
+        efl_wref_add(data, &wref);
+        efl_wref_del(data, &wref);
+     }
+}
+
+static void *
+_null_setup(void)
+{
+   return NULL;
+}
+
+static void
+_null_teardown(void *data EINA_UNUSED)
+{
+}
+
+static void
+_wref_del_object(void *data EINA_UNUSED, unsigned int iterations)
+{
+   Eo *obj, *wrefs[4];
+   unsigned int i, j;
+
+   for (i = 0; i < iterations; i++)
+     {
+        obj = efl_add_ref(SIMPLE_CLASS, NULL);
+        for (j = 0; j < EINA_C_ARRAY_LENGTH(wrefs); j++)
+          efl_wref_add(obj, &wrefs[j]);
+        efl_unref(obj);
+     }
+}
+
+static const Micro_Case _cases[] = {
+   { "call_simple", 2000000, _simple_setup, _call_simple, _obj_teardown },
+   { "call_super", 2000000, _super_setup, _call_simple, _obj_teardown },
+   { "call_mixin", 2000000, _mixed_setup, _call_mixin, _obj_teardown },
+   { "call_shared_threads", 400000, _shared_setup, _call_shared_threads, _obj_teardown },
+   { "data_scope_get", 2000000, _simple_setup, _data_scope_get, _obj_teardown },
+   { "data_scope_get_mixin", 2000000, _mixed_setup, _data_scope_get_mixin, _obj_teardown },
+   { "event_call_0", 2000000, _event_0_setup, _event_call, _obj_teardown },
+   { "event_call_1", 1000000, _event_1_setup, _event_call, _obj_teardown },
+   { "event_call_8", 500000, _event_8_setup, _event_call, _obj_teardown },
+   { "event_call_64", 100000, _event_64_setup, _event_call, _obj_teardown },
+   { "wref_add_del", 1000000, _simple_setup, _wref_add_del, _obj_teardown },
+   { "wref_del_object", 100000, _null_setup, _wref_del_object, _null_teardown },
+   { NULL, 0, NULL, NULL, NULL }
+};
+
+static void
+_case_run(const Micro_Case *mc, Micro_Result *result)
+{
+   Eo_Bench_Perf perf;
+   Eo_Bench_Sample sample;
+   void *data;
+   int i, r;
+
+   memset(result, 0, sizeof(*result));
+   result->name = mc->name;
+   result->iterations = mc->iterations;
+
+   data = mc->setup();
+   /* Warm up caches, the call site caches and the lazily built tables. */
+   mc->run(data, mc->iterations / 10);
+
+   /* Each counter opened per case, so threads spawned by the case are
+    * counted as well. The best of all runs is kept, it is the one the
+    * least disturbed by the rest of the system. */
+   eo_bench_perf_open(&perf);
+   for (r = 0; r < MICRO_REPEAT; r++)
+     {
+        eo_bench_perf_start(&perf);
+        mc->run(data, mc->iterations);
+        eo_bench_perf_stop(&perf, &sample);
+
+        if ((r == 0) || (sample.ns < result->ns))
+          result->ns = sample.ns;
+        for (i = 0; i < EO_BENCH_COUNTER_LAST; i++)
+          {
+             if (!sample.valid[i]) continue;
+             if (!result->valid[i] || (sample.counter[i] < result->counter[i]))
+               result->counter[i] = sample.counter[i];
+             result->valid[i] = EINA_TRUE;
+          }
+     }
+   eo_bench_perf_close(&perf);
+
+   mc->teardown(data);
+
+   result->ns /= mc->iterations;
+   for (i = 0; i < EO_BENCH_COUNTER_LAST; i++)
+     result->counter[i] /= mc->iterations;
+}
+
+static void
+_json_write(FILE *f, const Micro_Result *results, unsigned int count)
+{
+   unsigned int c, i;
+
+   fprintf(f, "{\n  \"suite\": \"eo\",\n  \"cases\": [\n");
+   for (c = 0; c < count; c++)
+     {
+        /* One case per line, eo_bench_micro() relies on it to read a
+         * baseline back. */
+        fprintf(f, "    { \"name\": \"%s\", \"iterations\": %u, \"ns_per_op\": %.3f",
+                results[c].name, results[c].iterations, results[c].ns);
+        for (i = 0; i < EO_BENCH_COUNTER_LAST; i++)
+          {
+             if (results[c].valid[i])
+               fprintf(f, ", \"%s_per_op\": %.3f",
+                       eo_bench_perf_counter_name(i), results[c].counter[i]);
+             else
+               fprintf(f, ", \"%s_per_op\": null",
+                       eo_bench_perf_counter_name(i));
+          }
+        fprintf(f, " }%s\n", (c + 1 < count) ? "," : "");
+     }
+   fprintf(f, "  ]\n}\n");
+}
+
+static Eina_Bool
+_json_number_get(const char *line, const char *key, double *value)
+{
+   char buf[64];
+   const char *s;
+
+   snprintf(buf, sizeof(buf), "\"%s\": ", key);
+   s = strstr(line, buf);
+   if (!s) return EINA_FALSE;
+   return sscanf(s + strlen(buf), "%lf", value) == 1;
+}
+
+static Eina_Bool
+_regression_check(const char *name, const char *metric,
+                  double before, double after, double threshold)
+{
+   double change;
+
+   if (before <= 0.0) return EINA_FALSE;
+   change = 100.0 * (after - before) / before;
+   fprintf(stderr, "%s: %s %.3f -> %.3f (%+.1f%%)%s\n", name, metric,
+           before, after, change, (change > threshold) ? " REGRESSION" : "");
+   return change > threshold;
+}
+
+static unsigned int
+_baseline_compare(const char *file, const Micro_Result *results, unsigned int count)
+{
+   char line[1024], name[128];
+   const char *s;
+   double before;
+   unsigned int c, regressions = 0;
+   FILE *f;
+
+   f = fopen(file, "r");
+   if (!f)
+     {
+        fprintf(stderr, "Could not open baseline '%s'.\n", file);
+        return 1;
+     }
+
+   while (fgets(line, sizeof(line), f))
+     {
+        s = strstr(line, "\"name\": \"");
+        if (!s) continue;
+        if (sscanf(s + strlen("\"name\": \""), "%127[^\"]", name) != 1) continue;
+
+        for (c = 0; c < count; c++)
+          if (!strcmp(results[c].name, name)) break;
+        if (c == count) continue;
+
+        /* Instruction counts are the reliable figure, fall back to times
+         * only when the counters were not available on either run. */
+        if (results[c].valid[EO_BENCH_COUNTER_INSTRUCTIONS] &&
+            _json_number_get(line, "instructions_per_op", &before))
+          regressions += _regression_check
+            (name, "instructions/op", before,
+             results[c].counter[EO_BENCH_COUNTER_INSTRUCTIONS],
+             MICRO_THRESHOLD_INSTRUCTIONS);
+        else if (_json_number_get(line, "ns_per_op", &before))
+          regressions += _regression_check(name, "ns/op", before, results[c].ns,
+                                           MICRO_THRESHOLD_NS);
+     }
+   fclose(f);
+
+   return regressions;
+}
+
+int
+eo_bench_micro(const char *output, const char *baseline)
+{
+   Micro_Result results[EINA_C_ARRAY_LENGTH(_cases)];
+   unsigned int count, regressions = 0;
+   FILE *f;
+
+   for (count = 0; _cases[count].name; count++)
+     {
+        _case_run(&_cases[count], &results[count]);
+        fprintf(stderr, "%s: %.3f ns/op", results[count].name, results[count].ns);
+        if (results[count].valid[EO_BENCH_COUNTER_INSTRUCTIONS])
+          fprintf(stderr, ", %.1f instructions/op",
+                  results[count].counter[EO_BENCH_COUNTER_INSTRUCTIONS]);
+        fprintf(stderr, "\n");
+     }
+
+   if (!strcmp(output, "-"))
+     f = stdout;
+   else
+     f = fopen(output, "w");
+   if (!f)
+     {
+        fprintf(stderr, "Could not write '%s'.\n", output);
+        return -1;
+     }
+   _json_write(f, results, count);
+   if (f != stdout) fclose(f);
+
+   if (baseline)
+     regressions = _baseline_compare(baseline, results, count);
+
+   return regressions ? 1 : 0;
+}
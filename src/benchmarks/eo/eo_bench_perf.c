@@ -0,0 +1,122 @@
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef __linux__
+# include <sys/ioctl.h>
+# include <sys/syscall.h>
+# include <linux/perf_event.h>
+#endif
+
+#include <Eina.h>
+
+#include "eo_bench_perf.h"
+
+static const char *_counter_names[EO_BENCH_COUNTER_LAST] = {
+   "instructions",
+   "cache_misses",
+   "branch_misses"
+};
+
+const char *
+eo_bench_perf_counter_name(Eo_Bench_Counter counter)
+{
+   return _counter_names[counter];
+}
+
+static unsigned long long
+_now_ns(void)
+{
+   struct timespec ts;
+
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (unsigned long long) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+#ifdef __linux__
+static int
+_counter_open(unsigned long long config)
+{
+   struct perf_event_attr attr;
+
+   memset(&attr, 0, sizeof(attr));
+   attr.size = sizeof(attr);
+   attr.type = PERF_TYPE_HARDWARE;
+   attr.config = config;
+   attr.disabled = 1;
+   attr.inherit = 1;
+   attr.exclude_kernel = 1;
+   attr.exclude_hv = 1;
+
+   return syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+#endif
+
+void
+eo_bench_perf_open(Eo_Bench_Perf *perf)
+{
+   int i;
+
+   for (i = 0; i < EO_BENCH_COUNTER_LAST; i++)
+     perf->fd[i] = -1;
+   perf->start_ns = 0;
+
+#ifdef __linux__
+   perf->fd[EO_BENCH_COUNTER_INSTRUCTIONS] = _counter_open(PERF_COUNT_HW_INSTRUCTIONS);
+   perf->fd[EO_BENCH_COUNTER_CACHE_MISSES] = _counter_open(PERF_COUNT_HW_CACHE_MISSES);
+   perf->fd[EO_BENCH_COUNTER_BRANCH_MISSES] = _counter_open(PERF_COUNT_HW_BRANCH_MISSES);
+#endif
+}
+
+void
+eo_bench_perf_close(Eo_Bench_Perf *perf)
+{
+   int i;
+
+   for (i = 0; i < EO_BENCH_COUNTER_LAST; i++)
+     {
+        if (perf->fd[i] >= 0) close(perf->fd[i]);
+        perf->fd[i] = -1;
+     }
+}
+
+void
+eo_bench_perf_start(Eo_Bench_Perf *perf)
+{
+#ifdef __linux__
+   int i;
+
+   for (i = 0; i < EO_BENCH_COUNTER_LAST; i++)
+     {
+        if (perf->fd[i] < 0) continue;
+        ioctl(perf->fd[i], PERF_EVENT_IOC_RESET, 0);
+        ioctl(perf->fd[i], PERF_EVENT_IOC_ENABLE, 0);
+     }
+#endif
+   perf->start_ns = _now_ns();
+}
+
+void
+eo_bench_perf_stop(Eo_Bench_Perf *perf, Eo_Bench_Sample *sample)
+{
+   int i;
+
+   sample->ns = _now_ns() - perf->start_ns;
+
+   for (i = 0; i < EO_BENCH_COUNTER_LAST; i++)
+     {
+        sample->counter[i] = 0;
+        sample->valid[i] = EINA_FALSE;
+#ifdef __linux__
+        if (perf->fd[i] < 0) continue;
+        ioctl(perf->fd[i], PERF_EVENT_IOC_DISABLE, 0);
+        if (read(perf->fd[i], &sample->counter[i], sizeof(sample->counter[i])) ==
+            sizeof(sample->counter[i]))
+          sample->valid[i] = EINA_TRUE;
+#endif
+     }
+}
@@ -0,0 +1,39 @@
+#ifndef EO_BENCH_PERF_H_
+#define EO_BENCH_PERF_H_
+
+/* Hardware counters read around a benchmark run. They come from
+ * perf_event_open() on Linux and are simply unavailable elsewhere, or when
+ * the kernel does not let us open them (perf_event_paranoid, containers). */
+typedef enum
+{
+   EO_BENCH_COUNTER_INSTRUCTIONS,
+   EO_BENCH_COUNTER_CACHE_MISSES,
+   EO_BENCH_COUNTER_BRANCH_MISSES,
+   EO_BENCH_COUNTER_LAST
+} Eo_Bench_Counter;
+
+typedef struct _Eo_Bench_Perf Eo_Bench_Perf;
+struct _Eo_Bench_Perf
+{
+   int fd[EO_BENCH_COUNTER_LAST];
+   unsigned long long start_ns;
+};
+
+typedef struct _Eo_Bench_Sample Eo_Bench_Sample;
+struct _Eo_Bench_Sample
+{
+   unsigned long long ns;
+   unsigned long long counter[EO_BENCH_COUNTER_LAST];
+   Eina_Bool valid[EO_BENCH_COUNTER_LAST];
+};
+
+const char *eo_bench_perf_counter_name(Eo_Bench_Counter counter);
+
+/* Counters also count the threads created between start and stop, as long
+ * as they are joined before stop. */
+void eo_bench_perf_open(Eo_Bench_Perf *perf);
+void eo_bench_perf_close(Eo_Bench_Perf *perf);
+void eo_bench_perf_start(Eo_Bench_Perf *perf);
+void eo_bench_perf_stop(Eo_Bench_Perf *perf, Eo_Bench_Sample *sample);
+
+#endif
@@ -0,0 +1,150 @@
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif
+
+#include <stdlib.h>
+
+#include "Evas.h"
+#include "Evas_Engine_Buffer.h"
+#include "evas_bench.h"
+
+/* Compositing throughput of the buffer engine. Each request draws a
+ * request x request object over an opaque background, BLEND_FRAMES times,
+ * so the time of a request grows with the number of pixels the span
+ * functions go through. Run with EVAS_CPU_NO_AVX2=1 (or NO_SSE3, NO_MMX)
+ * to compare with the narrower spans. */
+
+#define BLEND_SIZE 1024
+#define BLEND_FRAMES 16
+
+static Evas *
+_setup_evas(void *buffer)
+{
+   Evas *evas;
+   Evas_Engine_Info_Buffer *einfo;
+
+   evas = evas_new();
+
+   evas_output_method_set(evas, evas_render_method_lookup("buffer"));
+   einfo = (Evas_Engine_Info_Buffer *)evas_engine_info_get(evas);
+
+   einfo->info.depth_type = EVAS_ENGINE_BUFFER_DEPTH_RGB32;
+   einfo->info.dest_buffer = buffer;
+   einfo->info.dest_buffer_row_bytes = BLEND_SIZE * sizeof (char) * 4;
+
+   evas_engine_info_set(evas, (Evas_Engine_Info *)einfo);
+
+   evas_output_size_set(evas, BLEND_SIZE, BLEND_SIZE);
+   evas_output_viewport_set(evas, 0, 0, BLEND_SIZE, BLEND_SIZE);
+
+   return evas;
+}
+
+static Evas_Object *
+_image_add(Evas *e, int size, Eina_Bool alpha)
+{
+   Evas_Object *o;
+   unsigned int *data;
+   int i;
+
+   o = evas_object_image_filled_add(e);
+   evas_object_image_size_set(o, size, size);
+   evas_object_image_alpha_set(o, alpha);
+   data = evas_object_image_data_get(o, EINA_TRUE);
+   for (i = 0; i < size * size; i++)
+     {
+        unsigned int a = alpha ? (i & 0xff) : 0xff;
+
+        /* premultiplied, with a bit of everything for the sparse spans */
+        data[i] = (a << 24) | ((a / 2) << 16) | ((a / 3) << 8) | (a / 4);
+     }
+   evas_object_image_data_set(o, data);
+   evas_object_image_data_update_add(o, 0, 0, size, size);
+
+   return o;
+}
+
+static void
+_bench_blend_run(int request, Evas_Object *o)
+{
+   Evas *e = evas_object_evas_get(o);
+   int i;
+
+   evas_object_geometry_set(o, 0, 0, request, request);
+   evas_object_show(o);
+
+   for (i = 0; i < BLEND_FRAMES; i++)
+     {
+        evas_damage_rectangle_add(e, 0, 0, request, request);
+        evas_render(e);
+     }
+}
+
+static void
+_bench_blend(int request, int op, Eina_Bool image, Eina_Bool alpha)
+{
+   Evas_Object *bg, *o;
+   void *buffer;
+   Evas *e;
+
+   buffer = malloc(BLEND_SIZE * BLEND_SIZE * 4);
+   if (!buffer) return;
+   e = _setup_evas(buffer);
+
+   bg = evas_object_rectangle_add(e);
+   evas_object_color_set(bg, 40, 80, 120, 255);
+   evas_object_geometry_set(bg, 0, 0, BLEND_SIZE, BLEND_SIZE);
+   evas_object_show(bg);
+
+   if (image)
+     o = _image_add(e, request, alpha);
+   else
+     {
+        o = evas_object_rectangle_add(e);
+        evas_object_color_set(o, 64, 32, 16, 128);
+     }
+   evas_object_render_op_set(o, op);
+   _bench_blend_run(request, o);
+
+   evas_free(e);
+   free(buffer);
+}
+
+static void
+evas_bench_blend_pixel(int request)
+{
+   _bench_blend(request, EVAS_RENDER_BLEND, EINA_TRUE, EINA_TRUE);
+}
+
+static void
+evas_bench_blend_color(int request)
+{
+   _bench_blend(request, EVAS_RENDER_BLEND, EINA_FALSE, EINA_FALSE);
+}
+
+static void
+evas_bench_copy_pixel(int request)
+{
+   _bench_blend(request, EVAS_RENDER_COPY, EINA_TRUE, EINA_FALSE);
+}
+
+static void
+evas_bench_mul_pixel(int request)
+{
+   _bench_blend(request, EVAS_RENDER_MUL, EINA_TRUE, EINA_FALSE);
+}
+
+static void
+evas_bench_mul_color(int request)
+{
+   _bench_blend(request, EVAS_RENDER_MUL, EINA_FALSE, EINA_FALSE);
+}
+
+void evas_bench_blend(Eina_Benchmark *bench)
+{
+   eina_benchmark_register(bench, "blend-pixel", EINA_BENCHMARK(evas_bench_blend_pixel), 64, BLEND_SIZE, 64);
+   eina_benchmark_register(bench, "blend-color", EINA_BENCHMARK(evas_bench_blend_color), 64, BLEND_SIZE, 64);
+   eina_benchmark_register(bench, "copy-pixel", EINA_BENCHMARK(evas_bench_copy_pixel), 64, BLEND_SIZE, 64);
+   eina_benchmark_register(bench, "mul-pixel", EINA_BENCHMARK(evas_bench_mul_pixel), 64, BLEND_SIZE, 64);
+   eina_benchmark_register(bench, "mul-color", EINA_BENCHMARK(evas_bench_mul_color), 64, BLEND_SIZE, 64);
+}
@@ -0,0 +1,341 @@
+#include <stdint.h>
+#include <limits.h>
+#include <unistd.h>
+
+#include "cache.h"
+
+/*
+ * A cache entry keeps everything a run of eolian_gen wrote, so that a later
+ * run with the same input and options can write the very same files without
+ * lexing and parsing anything. The entry is named after a hash of the input
+ * file contents, the options and the generator version. It records every
+ * .eo/.eot file the parse pulled in along with their hashes, so changing any
+ * of them invalidates it.
+ *
+ * Everything is stored in native byte order, an entry is not meant to be
+ * shared between machines:
+ *   header: magic, version, dependency count, output count
+ *   dependency: size, crc, superfast hash, path length, path
+ *   output: name length, data length, name, data
+ * Lengths count the terminating '\0' of the names and paths.
+ */
+
+#define CACHE_MAGIC 0x434c4f45 /* "EOLC" */
+#define CACHE_VERSION 1
+
+typedef struct
+{
+   uint32_t magic;
+   uint32_t version;
+   uint32_t deps;
+   uint32_t outs;
+} Cache_Header;
+
+typedef struct
+{
+   uint32_t size;
+   uint32_t crc;
+   uint32_t superfast;
+} Cache_Hash;
+
+struct _Eo_Gen_Cache
+{
+   char *path;
+   Eina_Binbuf *outs;
+   uint32_t nouts;
+};
+
+static Eina_Bool
+_cache_hash(const char *data, size_t len, Cache_Hash *h)
+{
+   /* both hashes take an int length, neither is seeded per process */
+   if (len > INT_MAX)
+     return EINA_FALSE;
+
+   h->size = len;
+   h->crc = len ? eina_crc(data, len, 0xffffffff, EINA_TRUE) : 0;
+   h->superfast = len ? (uint32_t)eina_hash_superfast(data, len) : 0;
+   return EINA_TRUE;
+}
+
+static Eina_Bool
+_cache_file_hash(const char *fname, Cache_Hash *h)
+{
+   Eina_File *f = eina_file_open(fname, EINA_FALSE);
+   if (!f)
+     return EINA_FALSE;
+
+   Eina_Bool ret = EINA_FALSE;
+   size_t len = eina_file_size_get(f);
+   if (!len)
+     {
+        ret = _cache_hash(NULL, 0, h);
+        goto end;
+     }
+
+   const char *data = eina_file_map_all(f, EINA_FILE_SEQUENTIAL);
+   if (!data)
+     goto end;
+   ret = _cache_hash(data, len, h);
+   eina_file_map_free(f, (void *)data);
+
+end:
+   eina_file_close(f);
+   return ret;
+}
+
+static Eina_Bool
+_cache_write(const char *fname, const void *data, size_t len)
+{
+   FILE *f = fopen(fname, "wb");
+   if (!f)
+     {
+        fprintf(stderr, "eolian: could not open '%s' (%s)\n",
+                fname, strerror(errno));
+        return EINA_FALSE;
+     }
+
+   Eina_Bool ret = EINA_TRUE;
+   if (len && (fwrite(data, 1, len, f) != len))
+     {
+        fprintf(stderr, "eolian: could not write '%s' (%s)\n",
+                fname, strerror(errno));
+        ret = EINA_FALSE;
+     }
+
+   if (fclose(f))
+     ret = EINA_FALSE;
+   return ret;
+}
+
+static Eina_Bool
+_cache_read(const unsigned char **p, const unsigned char *e, void *dst, size_t len)
+{
+   if ((size_t)(e - *p) < len)
+     return EINA_FALSE;
+   memcpy(dst, *p, len);
+   *p += len;
+   return EINA_TRUE;
+}
+
+static const char *
+_cache_read_str(const unsigned char **p, const unsigned char *e, uint32_t len)
+{
+   const char *str = (const char *)*p;
+   if (!len || ((size_t)(e - *p) < len) || str[len - 1])
+     return NULL;
+   *p += len;
+   return str;
+}
+
+/* the outputs are checked before anything is written, a truncated entry
+ * must not leave half of the files behind */
+static Eina_Bool
+_cache_outputs(const unsigned char *p, const unsigned char *e, uint32_t n,
+               Eina_Bool write)
+{
+   for (uint32_t i = 0; i < n; ++i)
+     {
+        uint32_t nlen, dlen;
+        if (!_cache_read(&p, e, &nlen, sizeof(nlen)) ||
+            !_cache_read(&p, e, &dlen, sizeof(dlen)))
+          return EINA_FALSE;
+
+        const char *name = _cache_read_str(&p, e, nlen);
+        if (!name || ((size_t)(e - p) < dlen))
+          return EINA_FALSE;
+
+        if (write)
+          {
+             INF("restoring from cache: %s", name);
+             if (!_cache_write(name, p, dlen))
+               return EINA_FALSE;
+          }
+        p += dlen;
+     }
+   return EINA_TRUE;
+}
+
+Eo_Gen_Cache *
+eo_gen_cache_new(const char *dir, const char *input, const Eina_Strbuf *opts)
+{
+   Cache_Hash h;
+   if (!_cache_file_hash(input, &h))
+     return NULL;
+
+   Eina_Strbuf *key = eina_strbuf_new();
+   eina_strbuf_append(key, "eolian_gen " PACKAGE_VERSION "\n");
+
+   /* relative paths in the options only mean something from there */
+   char cwd[PATH_MAX];
+   if (getcwd(cwd, sizeof(cwd)))
+     eina_strbuf_append_printf(key, "%s\n", cwd);
+
+   eina_strbuf_append_printf(key, "%s %08x %08x %08x\n", input,
+                             h.size, h.crc, h.superfast);
+   eina_strbuf_append_buffer(key, opts);
+
+   Eina_Bool ok = _cache_hash(eina_strbuf_string_get(key),
+                              eina_strbuf_length_get(key), &h);
+   eina_strbuf_free(key);
+   if (!ok)
+     return NULL;
+
+   Eo_Gen_Cache *cache = calloc(1, sizeof(Eo_Gen_Cache));
+   if (!cache)
+     return NULL;
+
+   Eina_Strbuf *path = eina_strbuf_new();
+   eina_strbuf_append_printf(path, "%s/%08x%08x.eoc", dir, h.crc, h.superfast);
+   cache->path = eina_strbuf_string_steal(path);
+   eina_strbuf_free(path);
+   cache->outs = eina_binbuf_new();
+
+   return cache;
+}
+
+void
+eo_gen_cache_free(Eo_Gen_Cache *cache)
+{
+   if (!cache)
+     return;
+   eina_binbuf_free(cache->outs);
+   free(cache->path);
+   free(cache);
+}
+
+Eina_Bool
+eo_gen_cache_restore(Eo_Gen_Cache *cache)
+{
+   Eina_File *f = eina_file_open(cache->path, EINA_FALSE);
+   if (!f)
+     {
+        DBG("cache miss: %s", cache->path);
+        return EINA_FALSE;
+     }
+
+   Eina_Bool ret = EINA_FALSE;
+   size_t len = eina_file_size_get(f);
+   const unsigned char *map = eina_file_map_all(f, EINA_FILE_SEQUENTIAL);
+   if (!map)
+     goto end;
+
+   const unsigned char *p = map, *e = map + len;
+   Cache_Header hd;
+   if (!_cache_read(&p, e, &hd, sizeof(hd)) ||
+       (hd.magic != CACHE_MAGIC) || (hd.version != CACHE_VERSION))
+     {
+        WRN("invalid cache entry: %s", cache->path);
+        goto unmap;
+     }
+
+   for (uint32_t i = 0; i < hd.deps; ++i)
+     {
+        Cache_Hash dh, fh;
+        uint32_t plen;
+        if (!_cache_read(&p, e, &dh, sizeof(dh)) ||
+            !_cache_read(&p, e, &plen, sizeof(plen)))
+          goto invalid;
+
+        const char *dpath = _cache_read_str(&p, e, plen);
+        if (!dpath)
+          goto invalid;
+
+        if (!_cache_file_hash(dpath, &fh) || memcmp(&dh, &fh, sizeof(dh)))
+          {
+             DBG("cache entry out of date, '%s' changed", dpath);
+             goto unmap;
+          }
+     }
+
+   if (!_cache_outputs(p, e, hd.outs, EINA_FALSE))
+     goto invalid;
+
+   ret = _cache_outputs(p, e, hd.outs, EINA_TRUE);
+   goto unmap;
+
+invalid:
+   WRN("invalid cache entry: %s", cache->path);
+unmap:
+   eina_file_map_free(f, (void *)map);
+end:
+   eina_file_close(f);
+   return ret;
+}
+
+void
+eo_gen_cache_output_add(Eo_Gen_Cache *cache, const char *fname,
+                        const Eina_Strbuf *buf)
+{
+   uint32_t nlen = strlen(fname) + 1;
+   uint32_t dlen = eina_strbuf_length_get(buf);
+
+   eina_binbuf_append_length(cache->outs, (unsigned char *)&nlen, sizeof(nlen));
+   eina_binbuf_append_length(cache->outs, (unsigned char *)&dlen, sizeof(dlen));
+   eina_binbuf_append_length(cache->outs, (unsigned char *)fname, nlen);
+   eina_binbuf_append_length(cache->outs,
+                             (unsigned char *)eina_strbuf_string_get(buf), dlen);
+   cache->nouts++;
+}
+
+Eina_Bool
+eo_gen_cache_store(Eo_Gen_Cache *cache, const Eolian_State *eos)
+{
+   Eina_Bool ret = EINA_FALSE;
+   Eina_Binbuf *deps = eina_binbuf_new();
+   Cache_Header hd = { CACHE_MAGIC, CACHE_VERSION, 0, cache->nouts };
+
+   /* every unit of the state, the input file included */
+   const Eolian_Unit *un;
+   Eina_Iterator *itr = eolian_state_units_get(eos);
+   EINA_ITERATOR_FOREACH(itr, un)
+     {
+        const char *dpath = eolian_unit_file_path_get(un);
+        if (!dpath)
+          continue;
+
+        Cache_Hash h;
+        if (!_cache_file_hash(dpath, &h))
+          {
+             eina_iterator_free(itr);
+             goto end;
+          }
+
+        uint32_t plen = strlen(dpath) + 1;
+        eina_binbuf_append_length(deps, (unsigned char *)&h, sizeof(h));
+        eina_binbuf_append_length(deps, (unsigned char *)&plen, sizeof(plen));
+        eina_binbuf_append_length(deps, (unsigned char *)dpath, plen);
+        hd.deps++;
+     }
+   eina_iterator_free(itr);
+
+   Eina_Binbuf *buf = eina_binbuf_new();
+   eina_binbuf_append_length(buf, (unsigned char *)&hd, sizeof(hd));
+   eina_binbuf_append_buffer(buf, deps);
+   eina_binbuf_append_buffer(buf, cache->outs);
+
+   /* concurrent runs may store the same entry, never show a partial one */
+   Eina_Strbuf *tmp = eina_strbuf_new();
+   eina_strbuf_append_printf(tmp, "%s.%d", cache->path, (int)getpid());
+   const char *tpath = eina_strbuf_string_get(tmp);
+
+   if (_cache_write(tpath, eina_binbuf_string_get(buf),
+                    eina_binbuf_length_get(buf)))
+     {
+        if (!rename(tpath, cache->path))
+          ret = EINA_TRUE;
+        else
+          unlink(tpath);
+     }
+   else
+     unlink(tpath);
+
+   eina_strbuf_free(tmp);
+   eina_binbuf_free(buf);
+
+end:
+   if (!ret)
+     WRN("could not store cache entry: %s", cache->path);
+   eina_binbuf_free(deps);
+   return ret;
+}
@@ -0,0 +1,14 @@
+#ifndef EOLIAN_GEN_CACHE_H
+#define EOLIAN_GEN_CACHE_H
+
+#include "main.h"
+
+typedef struct _Eo_Gen_Cache Eo_Gen_Cache;
+
+Eo_Gen_Cache *eo_gen_cache_new(const char *dir, const char *input, const Eina_Strbuf *opts);
+void eo_gen_cache_free(Eo_Gen_Cache *cache);
+Eina_Bool eo_gen_cache_restore(Eo_Gen_Cache *cache);
+void eo_gen_cache_output_add(Eo_Gen_Cache *cache, const char *fname, const Eina_Strbuf *buf);
+Eina_Bool eo_gen_cache_store(Eo_Gen_Cache *cache, const Eolian_State *eos);
+
+#endif
@@ -5,9 +5,13 @@
 #include "types.h"
 #include "headers.h"
 #include "sources.h"
+#include "cache.h"
 
 int _eolian_gen_log_dom = -1;
 
+/* outputs of this run, recorded for the next ones */
+static Eo_Gen_Cache *_cache = NULL;
+
 enum
 {
    GEN_H        = 1 << 0,
@@ -43,6 +47,7 @@ _print_usage(const char *progn, FILE *outf)
                  "  -g type       generate file of type \"type\"\n"
                  "  -o name       specify the base name for output\n"
                  "  -o type:name  specify a particular output filename\n"
+                 "  -C dir        cache the generated files in \"dir\"\n"
                  "  -h            print this message and exit\n"
                  "  -v            print version and exit\n"
                  "\n"
@@ -67,7 +72,11 @@ _print_usage(const char *progn, FILE *outf)
                  "is determined from the input file name. If that is not possible\n"
                  "for some reason, it defaults to \".eo\". Obviously, this does not\n"
                  "affect specific filenames (-o x:y) as these are full names.\n"
-                 "Implementation files are a special case (no \".eo\" added).\n");
+                 "Implementation files are a special case (no \".eo\" added).\n\n"
+                 "With a cache directory (-C or the EOLIAN_CACHE_DIR environment\n"
+                 "variable), a run with the same input, options and dependencies\n"
+                 "as an earlier one writes the files it cached without parsing.\n"
+                 "Implementation files are never cached.\n");
 }
 
 static void
@@ -231,6 +240,8 @@ _write_file(const char *fname, const Eina_Strbuf *buf)
 
 end:
    fclose(f);
+   if (fret && _cache)
+     eo_gen_cache_output_add(_cache, fname, buf);
    return fret;
 }
 
@@ -501,6 +512,7 @@ main(int argc, char **argv)
      NULL, NULL, NULL, NULL, NULL, NULL, NULL
    };
    char *basen = NULL;
+   const char *cdir = getenv("EOLIAN_CACHE_DIR");
    Eina_List *includes = NULL;
 
    eina_init();
@@ -521,7 +533,7 @@ main(int argc, char **argv)
    int gen_what = 0;
    Eina_Bool scan_system = EINA_TRUE;
 
-   for (int opt; (opt = getopt(argc, argv, "SI:g:o:hv")) != -1;)
+   for (int opt; (opt = getopt(argc, argv, "SI:g:o:C:hv")) != -1;)
      switch (opt)
        {
         case 0:
@@ -585,6 +597,9 @@ main(int argc, char **argv)
                basen = strdup(optarg);
             }
           break;
+        case 'C':
+          cdir = optarg;
+          break;
         case 'h':
           _print_usage(argv[0], stdout);
           pret = 0;
@@ -612,6 +627,34 @@ main(int argc, char **argv)
         goto end;
      }
 
+   _fill_all_outs(outs, input, basen);
+
+   if (!gen_what)
+     gen_what = GEN_H | GEN_C;
+
+   /* the implementation file is merged with what is on disk, so it
+    * cannot be replayed from the cache */
+   if (cdir && *cdir && !(gen_what & GEN_C_IMPL))
+     {
+        Eina_Strbuf *opts = eina_strbuf_new();
+        eina_strbuf_append_printf(opts, "%d %d\n", scan_system, gen_what);
+        const Eina_List *l;
+        const char *idir;
+        EINA_LIST_FOREACH(includes, l, idir)
+          eina_strbuf_append_printf(opts, "-I%s\n", idir);
+        for (size_t i = 0; i < (sizeof(_dexts) / sizeof(char *)); ++i)
+          eina_strbuf_append_printf(opts, "-o%s\n", outs[i]);
+        _cache = eo_gen_cache_new(cdir, input, opts);
+        eina_strbuf_free(opts);
+
+        if (_cache && eo_gen_cache_restore(_cache))
+          {
+             INF("'%s' restored from cache", input);
+             pret = 0;
+             goto end;
+          }
+     }
+
    if (scan_system)
      {
         if (!eolian_state_system_directory_add(eos))
@@ -637,13 +680,8 @@ main(int argc, char **argv)
         goto end;
      }
 
-   _fill_all_outs(outs, input, basen);
-
    const char *eobn = _get_filename(input);
 
-   if (!gen_what)
-     gen_what = GEN_H | GEN_C;
-
    Eina_Bool succ = EINA_TRUE;
    if (gen_what & GEN_H)
      succ = _write_header(eos, eos, outs[_get_bit_pos(GEN_H)], eobn, EINA_FALSE);
@@ -664,6 +702,9 @@ main(int argc, char **argv)
    if (!succ)
      goto end;
 
+   if (_cache)
+     eo_gen_cache_store(_cache, eos);
+
    pret = 0;
 end:
    if (_eolian_gen_log_dom >= 0)
@@ -676,6 +717,7 @@ end:
    for (size_t i = 0; i < (sizeof(_dexts) / sizeof(char *)); ++i)
      free(outs[i]);
    free(basen);
+   eo_gen_cache_free(_cache);
 
    eolian_state_free(eos);
    eolian_shutdown();
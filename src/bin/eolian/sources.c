@@ -823,11 +823,29 @@ _gen_func(const Eolian_Class *cl, const Eolian_Function *fid,
         if (fallback_free_ownership)
           eina_strbuf_append(buf, "_FALLBACK");
 
+        /* objects of a final class are of that exact class, its own
+         * methods can call their implementation without any lookup */
+        Eina_Bool direct = eolian_class_is_final(cl) && impl_need
+                           && !fallback_free_ownership;
+        if (direct)
+          eina_strbuf_append(buf, "_DIRECT");
+
         eina_strbuf_append_char(buf, '(');
 
         Eina_Stringshare *eofn = eolian_function_full_c_name_get(fid, ftype, EINA_FALSE);
         eina_strbuf_append(buf, eofn);
 
+        if (direct)
+          {
+             Eina_Stringshare *mname = eolian_class_c_name_get(cl);
+             eina_strbuf_append_printf(buf, ", %s, ", mname);
+             if (is_empty || is_auto || eina_strbuf_length_get(params_init))
+               eina_strbuf_append(buf, "__eolian");
+             eina_strbuf_append_printf(buf, "_%s_%s%s", cnamel,
+                                       eolian_function_name_get(fid), func_suffix);
+             eina_stringshare_del(mname);
+          }
+
         if (strcmp(rtpn, "void"))
           {
              eina_strbuf_append_printf(buf, ", %s, ", rtpn);
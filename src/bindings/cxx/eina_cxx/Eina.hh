@@ -14,6 +14,7 @@
 #include <eina_list.hh>
 #include <eina_stringshare.hh>
 #include <eina_string_view.hh>
+#include <eina_span.hh>
 #include <eina_strbuf.hh>
 #include <eina_error.hh>
 #include <eina_accessor.hh>
@@ -40,6 +40,8 @@ public:
   using _base_type::empty;
   using _base_type::get_clone_allocator;
   using _base_type::push_back;
+  using _base_type::emplace_back;
+  using _base_type::emplace;
   using _base_type::pop_back;
   using _base_type::insert;
   using _base_type::erase;
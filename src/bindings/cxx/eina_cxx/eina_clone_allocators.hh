@@ -8,7 +8,9 @@
 #include <memory>
 #include <cstring>
 #include <cstdlib>
+#include <new>
 #include <type_traits>
+#include <utility>
 
 /**
  * @addtogroup Eina_Cxx_Containers_Group
@@ -48,6 +50,12 @@ struct heap_copy_allocator
     return new T(v);
   }
 
+  template <typename T, typename... Args>
+  static T* construct_clone(Args&&... args)
+  {
+    return new T(std::forward<Args>(args)...);
+  }
+
   template <typename T>
   static void deallocate_clone(T* p)
   {
@@ -120,10 +128,17 @@ struct view_clone_allocator
 /**
  * This allocator does not define an @c allocate_clone member function,
  * so it should be used to disable operations that require elements to
- * be cloned.
+ * be cloned. Elements can still be constructed in place on the heap
+ * through @c construct_clone.
  */
 struct heap_no_copy_allocator
 {
+  template <typename T, typename... Args>
+  static T* construct_clone(Args&&... args)
+  {
+    return new T(std::forward<Args>(args)...);
+  }
+
   static void deallocate_clone(_Elm_Calendar_Mark const volatile*) {}
   static void deallocate_clone(_Elm_Calendar_Mark volatile*) {}
   static void deallocate_clone(_Elm_Calendar_Mark const*) {}
@@ -165,6 +180,16 @@ struct malloc_clone_allocator
     return p;
   }
 
+  template <typename T, typename... Args>
+  static T* construct_clone(Args&&... args)
+  {
+    static_assert(std::is_pod<T>::value, "malloc_clone_allocator can only be used with POD types");
+    void* p = std::malloc(sizeof(T));
+    if(!p)
+      return 0;
+    return new (p) T(std::forward<Args>(args)...);
+  }
+
   template <typename T>
   static void deallocate_clone(T const* p)
   {
@@ -4,8 +4,13 @@
 #include <Eina.h>
 #include <eina_type_traits.hh>
 #include <eina_range_types.hh>
+#include <eina_throw.hh>
 
 #include <iterator>
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <utility>
 #include <cstring>
 #include <cassert>
 
@@ -115,7 +120,7 @@ static T const& front(Eina_Inarray const* raw)
 template <typename T>
 static T* begin(Eina_Inarray* raw)
 {
-  return !raw->members ? 0 : static_cast<T*>( ::eina_inarray_nth(raw, 0u));
+  return static_cast<T*>(raw->members);
 }
 
 /**
@@ -124,8 +129,7 @@ static T* begin(Eina_Inarray* raw)
 template <typename T>
 static T* end(Eina_Inarray* raw)
 {
-  return !raw->members ? 0
-    : static_cast<T*>( ::eina_inarray_nth(raw, _inarray_access_traits::size<T>(raw) -1)) + 1;
+  return static_cast<T*>(raw->members) + raw->len;
 }
 
 /**
@@ -435,6 +439,31 @@ struct _inarray_common_base
    */
   const_native_handle_type native_handle() const { return _array; }
 
+  /**
+   * @brief Get the number of elements the array can hold without growing.
+   * @return Number of elements allocated for the array.
+   */
+  size_type capacity() const
+  {
+    return _array->max;
+  }
+
+  /**
+   * @brief Give up the ownership of the wrapped Eina_Inarray.
+   * @return Handle for the native Eina inline array.
+   *
+   * This member function returns the native @c Eina_Inarray handle,
+   * elements included, and leaves the object holding a new empty
+   * array. The caller becomes responsible for freeing the returned
+   * handle, this object no longer touches it.
+   */
+  native_handle_type release_native_handle()
+  {
+    native_handle_type tmp = _array;
+    _array = ::eina_inarray_new(tmp->member_size, 0);
+    return tmp;
+  }
+
   /**
    * @internal
    * Member variable that holds the native @c Eina_Inarray handle.
@@ -491,6 +520,8 @@ public:
    */
    using _base_type::empty;
   using _base_type::native_handle; /** Type for the native @c Eina_Inarray handle. */
+  using _base_type::capacity;
+  using _base_type::release_native_handle;
 
 
   /**
@@ -527,8 +558,7 @@ public:
    */
   _pod_inarray(size_type n, value_type const& t) : _base_type(sizeof(T))
   {
-    while(n--)
-      push_back(t);
+    insert(end(), n, t);
   }
 
   /**
@@ -546,11 +576,7 @@ public:
          , typename eina::enable_if<!eina::is_integral<InputIterator>::value>::type* = 0)
     : _base_type(sizeof(T))
   {
-    while(i != j)
-      {
-        push_back(*i);
-        ++i;
-      }
+    insert(end(), i, j);
   }
 
   /**
@@ -566,6 +592,19 @@ public:
     insert(end(), other.begin(), other.end());
   }
 
+  /**
+   * @brief Move constructor. Takes over the content of the given inline array.
+   * @param other Another inline array of the same type.
+   *
+   * This constructor takes the elements of @p other without copying
+   * them, @p other is left empty.
+   */
+  _pod_inarray(_pod_inarray<T>&& other)
+    : _base_type(sizeof(T))
+  {
+    swap(other);
+  }
+
   /**
    * Do nothing, the native @c Eina_Inarray is already released in the
    * base class destructor.
@@ -589,6 +628,20 @@ public:
     return *this;
   }
 
+  /**
+   * @brief Replace the current content with the content of another array.
+   * @param other Another inline array of the same type.
+   *
+   * This assignment operator takes the elements of @p other without
+   * copying them, @p other is left empty.
+   */
+  _pod_inarray<T>& operator=(_pod_inarray<T>&& other)
+  {
+    clear();
+    swap(other);
+    return *this;
+  }
+
   /**
    * @brief Remove all the elements of the array.
    */
@@ -621,6 +674,65 @@ public:
     eina_inarray_pop(_array);
   }
 
+  /**
+   * @brief Construct a new element at the end of the array.
+   * @param args Arguments forwarded to the constructor of the element.
+   * @return Reference to the new element.
+   */
+  template <typename... Args>
+  reference emplace_back(Args&&... args)
+  {
+    return *emplace(end(), std::forward<Args>(args)...);
+  }
+
+  /**
+   * @brief Construct a new element at the given position.
+   * @param i Iterator pointing to the position where the new element will be constructed.
+   * @param args Arguments forwarded to the constructor of the element.
+   * @return Iterator pointing to the new element.
+   *
+   * The element is built before the array grows, so @p args may refer
+   * to elements of the array itself.
+   */
+  template <typename... Args>
+  iterator emplace(iterator i, Args&&... args)
+  {
+    value_type t(std::forward<Args>(args)...);
+    return insert(i, t);
+  }
+
+  /**
+   * @brief Reserve storage for at least @p n elements.
+   * @param n Number of elements the array should be able to hold.
+   *
+   * This member function grows the array storage once, so that up to
+   * @p n elements can be added without any further allocation.
+   */
+  void reserve(size_type n)
+  {
+    size_type len = size();
+    if(n > capacity() && ::eina_inarray_resize(_array, n))
+      _array->len = len;
+  }
+
+  /**
+   * @brief Get a pointer to the contiguous storage of the elements.
+   * @return Pointer to the first element.
+   */
+  pointer data()
+  {
+    return begin();
+  }
+
+  /**
+   * @brief Get a constant pointer to the contiguous storage of the elements.
+   * @return Constant pointer to the first element.
+   */
+  const_pointer data() const
+  {
+    return begin();
+  }
+
   /**
    * @brief Insert a new element at the given position.
    * @param i Iterator pointing to the position where the new element will be inserted.
@@ -666,18 +778,23 @@ public:
    */
   iterator insert(iterator i, size_t n, value_type const& t)
   {
+    if(!n)
+      return i;
+
+    // t may be an element of this array, growing it would invalidate t
+    value_type v(t);
     T* q;
     if(i != end())
     {
       q = static_cast<iterator>
-        ( ::eina_inarray_alloc_at(_array, i - &_array->members, n));
+        ( ::eina_inarray_alloc_at(_array, i - begin(), n));
     }
     else
     {
-      q = eina_inarray_grow(_array, n);
+      q = static_cast<iterator>( ::eina_inarray_grow(_array, n));
     }
     for(T* p = q; n; --n, ++p)
-      std::memcpy(p, &t, sizeof(t));
+      std::memcpy(p, &v, sizeof(v));
     return q;
   }
 
@@ -699,6 +816,16 @@ public:
   template <typename InputIterator>
   iterator insert(iterator p, InputIterator i, InputIterator j
                   , typename eina::enable_if<!eina::is_integral<InputIterator>::value>::type* = 0)
+  {
+    return _insert(p, i, j, typename std::iterator_traits<InputIterator>::iterator_category());
+  }
+
+  /**
+   * @internal
+   * Insert the elements one by one, the size of the range is unknown.
+   */
+  template <typename InputIterator>
+  iterator _insert(iterator p, InputIterator i, InputIterator j, std::input_iterator_tag)
   {
     size_type n = 0;
     while(i != j)
@@ -711,6 +838,27 @@ public:
     return p - n;
   }
 
+  /**
+   * @internal
+   * Grow the array once for the whole range and copy it in place.
+   */
+  template <typename ForwardIterator>
+  iterator _insert(iterator p, ForwardIterator i, ForwardIterator j, std::forward_iterator_tag)
+  {
+    size_type n = std::distance(i, j);
+    if(!n)
+      return p;
+
+    T* q;
+    if(p != end())
+      q = static_cast<iterator>
+        ( ::eina_inarray_alloc_at(_array, p - begin(), n));
+    else
+      q = static_cast<iterator>( ::eina_inarray_grow(_array, n));
+    std::copy(i, j, q);
+    return q;
+  }
+
   /**
    * @brief Remove the element at the given position.
    * @param q Iterator pointing to the element to be removed.
@@ -1070,6 +1218,8 @@ public:
 
   using _base_type::size;
   using _base_type::empty;
+  using _base_type::capacity;
+  using _base_type::release_native_handle;
 
   /**
    * @brief Create a new object from a handle to a native Eina_Inarray.
@@ -1105,8 +1255,7 @@ public:
    */
   _nonpod_inarray(size_type n, value_type const& t) : _base_type(sizeof(T))
   {
-    while(n--)
-      push_back(t);
+    insert(end(), n, t);
   }
 
   /**
@@ -1123,11 +1272,7 @@ public:
          , typename eina::enable_if<!eina::is_integral<InputIterator>::value>::type* = 0)
     : _base_type(sizeof(T))
   {
-    while(i != j)
-      {
-        push_back(*i);
-        ++i;
-      }
+    insert(end(), i, j);
   }
 
   /**
@@ -1143,6 +1288,19 @@ public:
     insert(end(), other.begin(), other.end());
   }
 
+  /**
+   * @brief Move constructor. Takes over the content of the given inline array.
+   * @param other Another inline array of the same type.
+   *
+   * This constructor takes the elements of @p other without copying or
+   * moving any of them, @p other is left empty.
+   */
+  _nonpod_inarray(_nonpod_inarray<T>&& other)
+    : _base_type(sizeof(T))
+  {
+    swap(other);
+  }
+
   /**
    * @brief Destructor of array for non-POD elements.
    *
@@ -1172,6 +1330,20 @@ public:
     return *this;
   }
 
+  /**
+   * @brief Replace current content with the content of another array.
+   * @param other Another inline array of the same type.
+   *
+   * This assignment operator takes the elements of @p other without
+   * copying or moving any of them, @p other is left empty.
+   */
+  _nonpod_inarray<T>& operator=(_nonpod_inarray<T>&& other)
+  {
+    clear();
+    swap(other);
+    return *this;
+  }
+
   /**
    * @brief Remove all the elements of the array.
    */
@@ -1195,6 +1367,15 @@ public:
     insert(end(), 1u, value);
   }
 
+  /**
+   * @brief Move the given element to the end of the array.
+   * @param value Element to be moved at the end of the array.
+   */
+  void push_back(T&& value)
+  {
+    insert(end(), std::move(value));
+  }
+
   /**
    * @brief Remove the last element of the array.
    */
@@ -1205,6 +1386,71 @@ public:
     eina_inarray_pop(_array);
   }
 
+  /**
+   * @brief Construct a new element at the end of the array.
+   * @param args Arguments forwarded to the constructor of the element.
+   * @return Reference to the new element.
+   */
+  template <typename... Args>
+  reference emplace_back(Args&&... args)
+  {
+    return *emplace(end(), std::forward<Args>(args)...);
+  }
+
+  /**
+   * @brief Construct a new element at the given position.
+   * @param i Iterator pointing to the position where the new element will be constructed.
+   * @param args Arguments forwarded to the constructor of the element.
+   * @return Iterator pointing to the new element.
+   *
+   * When there is room at the end of the array the element is built
+   * right there, otherwise it is built first and moved in place.
+   */
+  template <typename... Args>
+  iterator emplace(iterator i, Args&&... args)
+  {
+    if(i == end() && _array->len != _array->max)
+      {
+        new (&*i) T(std::forward<Args>(args)...);
+        ++_array->len;
+        return i;
+      }
+    value_type t(std::forward<Args>(args)...);
+    return insert(i, std::move(t));
+  }
+
+  /**
+   * @brief Reserve storage for at least @p n elements.
+   * @param n Number of elements the array should be able to hold.
+   *
+   * This member function moves the elements to a larger storage once,
+   * so that up to @p n elements can be added without any further
+   * allocation.
+   */
+  void reserve(size_type n)
+  {
+    if(n > _array->max)
+      _relocate(n);
+  }
+
+  /**
+   * @brief Get a pointer to the contiguous storage of the elements.
+   * @return Pointer to the first element.
+   */
+  pointer data()
+  {
+    return begin();
+  }
+
+  /**
+   * @brief Get a constant pointer to the contiguous storage of the elements.
+   * @return Constant pointer to the first element.
+   */
+  const_pointer data() const
+  {
+    return begin();
+  }
+
   /**
    * @brief Insert a new element at the given position.
    * @param i Iterator pointing to the position where the new element will be inserted.
@@ -1239,64 +1485,37 @@ public:
    */
   iterator insert(iterator i, size_t n, value_type const& t)
   {
-    if(_array->max - _array->len >= n)
+    // t may be an element of this array, growing it would invalidate t
+    if(&t >= begin() && &t < end())
       {
-        iterator end_ = static_cast<T*>(_array->members)
-          + _array->len
-          , last = end_ + n;
-        _array->len += n;
-        std::reverse_iterator<iterator>
-          dest(last), src(end_), src_end(i);
-        for(;src != src_end; ++src)
-          {
-            if(dest.base() <= end_)
-                *dest++ = *src;
-            else
-              new (&*dest++) T(*src);
-          }
-        iterator j = i;
-        for(size_type k = 0;k != n;++k)
-          {
-            if(j < end_)
-                *j = t;
-            else
-              new (&*j++) T(t);
-          }
+        value_type v(t);
+        return insert(i, n, v);
       }
-    else
+
+    iterator q = _open_gap(i, n);
+    for(size_type k = 0; k != n; ++k)
+      new (&q[k]) T(t);
+    return q;
+  }
+
+  /**
+   * @brief Move the given element to the given position.
+   * @param i Iterator pointing to the position where the new element will be inserted.
+   * @param t Value to be moved to the new element.
+   * @return Iterator pointing to the new element inserted.
+   */
+  iterator insert(iterator i, value_type&& t)
+  {
+    // t may be an element of this array, growing it would invalidate t
+    if(&t >= begin() && &t < end())
       {
-        size_type index = i - static_cast<iterator>(_array->members);
-
-        Eina_Inarray* old_array = eina_inarray_new(_array->member_size, 0);
-        *old_array = *_array;
-        _array->len = _array->max = 0;
-        _array->members = 0;
-        eina_inarray_resize(_array, old_array->len+n);
-        _array->len = old_array->len+n;
-
-        iterator old_first = static_cast<iterator>(old_array->members)
-          , first = begin()
-          , last = first + _array->len;
-        i = index + begin();
-
-        while(first != i)
-          {
-            new (&*first++) T(*old_first);
-            old_first++->~T();
-          }
-        for(size_type j = 0;j != n;++j)
-          new (&*first++) T(t);
-        std::size_t diff = last - first;
-        static_cast<void>(diff);
-        assert(diff == _array->len - index - n);
-        static_cast<void>(diff);
-        while(first != last)
-          {
-            new (&*first++) T(*old_first);
-            old_first++->~T();
-          }
+        value_type v(std::move(t));
+        return insert(i, std::move(v));
       }
-    return i;
+
+    iterator q = _open_gap(i, 1u);
+    new (q) T(std::move(t));
+    return q;
   }
 
   /**
@@ -1314,6 +1533,16 @@ public:
   template <typename InputIterator>
   iterator insert(iterator p, InputIterator i, InputIterator j
                   , typename eina::enable_if<!eina::is_integral<InputIterator>::value>::type* = 0)
+  {
+    return _insert(p, i, j, typename std::iterator_traits<InputIterator>::iterator_category());
+  }
+
+  /**
+   * @internal
+   * Insert the elements one by one, the size of the range is unknown.
+   */
+  template <typename InputIterator>
+  iterator _insert(iterator p, InputIterator i, InputIterator j, std::input_iterator_tag)
   {
     size_type n = 0;
     while(i != j)
@@ -1326,6 +1555,75 @@ public:
     return p - n;
   }
 
+  /**
+   * @internal
+   * Make room once for the whole range and copy it in place.
+   */
+  template <typename ForwardIterator>
+  iterator _insert(iterator p, ForwardIterator i, ForwardIterator j, std::forward_iterator_tag)
+  {
+    iterator q = _open_gap(p, std::distance(i, j));
+    std::uninitialized_copy(i, j, q);
+    return q;
+  }
+
+  /**
+   * @internal
+   * Move the elements to a new storage able to hold @p max of them.
+   * Elements are not trivially relocatable, so the storage can not be
+   * simply reallocated.
+   */
+  void _relocate(size_type max)
+  {
+    Eina_Inarray* old_array = ::eina_inarray_new(_array->member_size, 0);
+    if(!old_array)
+      EFL_CXX_THROW(std::bad_alloc());
+    *old_array = *_array;
+    _array->len = _array->max = 0;
+    _array->members = 0;
+    if(!::eina_inarray_resize(_array, max))
+      {
+        // give the elements back, untouched
+        *_array = *old_array;
+        old_array->members = 0;
+        old_array->len = old_array->max = 0;
+        ::eina_inarray_free(old_array);
+        EFL_CXX_THROW(std::bad_alloc());
+      }
+    _array->len = old_array->len;
+
+    for(T* first = static_cast<T*>(old_array->members)
+          , *last = first + old_array->len
+          , *dest = begin(); first != last; ++first, ++dest)
+      {
+        new (dest) T(std::move(*first));
+        first->~T();
+      }
+    ::eina_inarray_free(old_array);
+  }
+
+  /**
+   * @internal
+   * Open @p n uninitialized slots at @p i, moving the following
+   * elements up. The storage grows geometrically when it is full.
+   */
+  iterator _open_gap(iterator i, size_type n)
+  {
+    size_type index = i - begin();
+    size_type len = _array->len;
+    if(_array->max - len < n)
+      _relocate(std::max<size_type>(len + n, 2 * _array->max));
+
+    T* first = begin();
+    for(size_type k = len; k != index; --k)
+      {
+        new (&first[k - 1 + n]) T(std::move(first[k - 1]));
+        first[k - 1].~T();
+      }
+    _array->len = len + n;
+    return first + index;
+  }
+
   /**
    * @brief Remove the element at the given position.
    * @param q Iterator pointing to the element to be removed.
@@ -1358,7 +1656,7 @@ public:
     iterator last = end();
     iterator k = i, l = j;
     while(l != last)
-      *k++ = *l++;
+      *k++ = std::move(*l++);
     while(k != last)
       k++->~T();
     _array->len -= j - i;
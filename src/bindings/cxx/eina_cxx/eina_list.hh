@@ -203,6 +203,9 @@ public:
   using _base_type::get_clone_allocator;
   using _base_type::push_back;
   using _base_type::push_front;
+  using _base_type::emplace_back;
+  using _base_type::emplace_front;
+  using _base_type::emplace;
   using _base_type::pop_back;
   using _base_type::pop_front;
   using _base_type::insert;
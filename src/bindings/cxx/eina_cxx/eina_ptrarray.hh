@@ -398,6 +398,15 @@ struct _ptr_array_common_base
     return _get_clone_allocator().allocate_clone(a);
   }
 
+  /**
+   * @internal
+   */
+  template <typename... Args>
+  T* _construct_clone(Args&&... args)
+  {
+    return _get_clone_allocator().template construct_clone<T>(std::forward<Args>(args)...);
+  }
+
   /**
    * @internal
    */
@@ -538,11 +547,12 @@ public:
   }
 
   /**
-   * @brief Destructor. Release all allocated elements.
+   * @brief Destructor. Release all allocated elements and the native array.
    */
   ~ptr_array()
   {
     clear();
+    ::eina_array_free(this->_impl._array);
   }
 
   /**
@@ -660,6 +670,33 @@ public:
       EFL_CXX_THROW(std::bad_alloc());
   }
 
+  /**
+   * @brief Construct a new element at the end of the array.
+   * @param args Arguments forwarded to the constructor of the element.
+   * @return Reference to the new element.
+   *
+   * The element is created by the @c construct_clone member function of
+   * the clone allocator, nothing is copied.
+   */
+  template <typename... Args>
+  reference emplace_back(Args&&... args)
+  {
+    push_back(this->_construct_clone(std::forward<Args>(args)...));
+    return back();
+  }
+
+  /**
+   * @brief Construct a new element at the given position.
+   * @param i Iterator pointing to the position where the new element will be inserted.
+   * @param args Arguments forwarded to the constructor of the element.
+   * @return Iterator pointing to the new element.
+   */
+  template <typename... Args>
+  iterator emplace(iterator i, Args&&... args)
+  {
+    return insert(i, this->_construct_clone(std::forward<Args>(args)...));
+  }
+
   /**
    * @brief Remove the last element of the array.
    */
@@ -335,8 +335,23 @@ struct _ptr_list_common_base
     : _impl(_list)
   {}
 
-  _ptr_list_common_base<T, CloneAllocator>& operator=(_ptr_list_common_base<T, CloneAllocator>&& other) = default;
-  _ptr_list_common_base(_ptr_list_common_base<T, CloneAllocator>&& other) = default;
+  /**
+   * @brief Swap the native handles, the elements are neither copied nor released.
+   */
+  _ptr_list_common_base<T, CloneAllocator>& operator=(_ptr_list_common_base<T, CloneAllocator>&& other)
+  {
+    std::swap(_impl._list, other._impl._list);
+    return *this;
+  }
+
+  /**
+   * @brief Take over the native handle of @p other, leaving it empty.
+   */
+  _ptr_list_common_base(_ptr_list_common_base<T, CloneAllocator>&& other)
+    : _impl(other._get_clone_allocator())
+  {
+    std::swap(_impl._list, other._impl._list);
+  }
 
   /**
    * @brief Default constructor. Create an empty list.
@@ -377,6 +392,15 @@ struct _ptr_list_common_base
     return _get_clone_allocator().allocate_clone(a);
   }
 
+  /**
+   * @internal
+   */
+  template <typename... Args>
+  value_type* _construct_clone(Args&&... args)
+  {
+    return _get_clone_allocator().template construct_clone<value_type>(std::forward<Args>(args)...);
+  }
+
   /**
    * @internal
    */
@@ -447,8 +471,29 @@ public:
     : _base_type(alloc)
   {}
 
-  ptr_list<T, CloneAllocator>& operator=(ptr_list<T, CloneAllocator>&& other) = default;
-  ptr_list(ptr_list<T, CloneAllocator>&& other) = default;
+  /**
+   * @brief Move constructor. Takes over the elements of the given @c ptr_list.
+   * @param other Another @c ptr_list of the same type.
+   *
+   * Nothing is copied, @p other is left empty.
+   */
+  ptr_list(ptr_list<T, CloneAllocator>&& other)
+    : _base_type(std::move(other))
+  {}
+
+  /**
+   * @brief Replace the current content with the elements of another list.
+   * @param other Another @c ptr_list of the same type.
+   *
+   * The current elements are released and the ones of @p other are
+   * taken over without being copied, @p other is left empty.
+   */
+  ptr_list<T, CloneAllocator>& operator=(ptr_list<T, CloneAllocator>&& other)
+  {
+    clear();
+    _base_type::operator=(std::move(other));
+    return *this;
+  }
   
   /**
    * @brief Construct an list object with @p n copies of @p t.
@@ -689,6 +734,45 @@ public:
        EFL_CXX_THROW(std::bad_alloc());
   }
 
+  /**
+   * @brief Construct a new element at the end of the list.
+   * @param args Arguments forwarded to the constructor of the element.
+   * @return Reference to the new element.
+   *
+   * The element is created by the @c construct_clone member function of
+   * the clone allocator, nothing is copied.
+   */
+  template <typename... Args>
+  reference emplace_back(Args&&... args)
+  {
+    push_back(this->_construct_clone(std::forward<Args>(args)...));
+    return back();
+  }
+
+  /**
+   * @brief Construct a new element at the beginning of the list.
+   * @param args Arguments forwarded to the constructor of the element.
+   * @return Reference to the new element.
+   */
+  template <typename... Args>
+  reference emplace_front(Args&&... args)
+  {
+    push_front(this->_construct_clone(std::forward<Args>(args)...));
+    return front();
+  }
+
+  /**
+   * @brief Construct a new element at the given position.
+   * @param i Iterator pointing to the position where the new element will be inserted.
+   * @param args Arguments forwarded to the constructor of the element.
+   * @return Iterator pointing to the new element.
+   */
+  template <typename... Args>
+  iterator emplace(iterator i, Args&&... args)
+  {
+    return insert(i, this->_construct_clone(std::forward<Args>(args)...));
+  }
+
   /**
    * @brief Remove the last element of the list.
    */
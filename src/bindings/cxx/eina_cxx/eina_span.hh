@@ -0,0 +1,203 @@
+#ifndef EINA_SPAN_HH_
+#define EINA_SPAN_HH_
+
+#include <Eina.h>
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <eina_throw.hh>
+
+namespace efl { namespace eina {
+
+/**
+ * @internal
+ */
+template <typename Container, typename T, typename Enable = void>
+struct _is_span_container : std::false_type {};
+
+/**
+ * @internal
+ * Contiguous containers (std::vector, std::array, eina::inarray, ...)
+ * expose their storage through data() and size().
+ */
+template <typename Container, typename T>
+struct _is_span_container
+  <Container, T
+   , typename std::enable_if
+   <std::is_convertible<decltype(std::declval<Container&>().data()), T*>::value
+    && std::is_convertible<decltype(std::declval<Container&>().size()), std::size_t>::value>::type>
+  : std::true_type {};
+
+/**
+ * View over a contiguous sequence of elements, much like C++20's
+ * std::span. It never owns the elements.
+ *
+ * A span<T const> maps to a @c Eina_Slice and a span<T> to a
+ * @c Eina_Rw_Slice, so bulk data held by C++ containers can be handed
+ * to the Eina and EFL functions taking slices, and slices returned by
+ * them can be walked as typed ranges, without converting any element.
+ */
+template <typename T>
+class span
+{
+public:
+   // Types:
+   typedef T element_type;
+   typedef typename std::remove_cv<T>::type value_type;
+   typedef T& reference;
+   typedef T const& const_reference;
+   typedef T* pointer;
+   typedef T const* const_pointer;
+   typedef pointer iterator;
+   typedef const_pointer const_iterator;
+   typedef std::reverse_iterator<iterator> reverse_iterator;
+   typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+   typedef std::ptrdiff_t difference_type;
+   typedef std::size_t size_type;
+
+   // Constants:
+   static constexpr size_type npos = size_type(-1);
+
+   // Constructors:
+   constexpr span() noexcept
+     : _data(nullptr), _size(0)
+   {}
+
+   constexpr span(pointer data, size_type size) noexcept
+     : _data(data), _size(size)
+   {}
+
+   template <std::size_t N>
+   constexpr span(element_type (&array)[N]) noexcept
+     : _data(array), _size(N)
+   {}
+
+   template <typename Container>
+   span(Container& c
+        , typename std::enable_if<_is_span_container<Container, T>::value>::type* = 0)
+     : _data(c.data()), _size(c.size())
+   {}
+
+   template <typename U>
+   constexpr span(span<U> const& other
+                  , typename std::enable_if<std::is_convertible<U(*)[], T(*)[]>::value>::type* = 0) noexcept
+     : _data(other.data()), _size(other.size())
+   {}
+
+   /**
+    * @brief Create a span of read-only elements over a @c Eina_Slice.
+    *
+    * The slice length must be a multiple of the element size, extra
+    * bytes are left out of the span.
+    */
+   template <typename U = T>
+   explicit span(Eina_Slice const& slice
+                 , typename std::enable_if<std::is_const<U>::value>::type* = 0) noexcept
+     : _data(static_cast<pointer>(slice.mem)), _size(slice.len / sizeof(T))
+   {}
+
+   /**
+    * @brief Create a span over a @c Eina_Rw_Slice.
+    *
+    * The slice length must be a multiple of the element size, extra
+    * bytes are left out of the span.
+    */
+   explicit span(Eina_Rw_Slice const& slice) noexcept
+     : _data(static_cast<pointer>(slice.mem)), _size(slice.len / sizeof(T))
+   {}
+
+   span(span<T> const& other) noexcept = default;
+   span<T>& operator=(span<T> const& other) noexcept = default;
+
+   // Iterators:
+   constexpr iterator begin() const noexcept { return _data; }
+   constexpr const_iterator cbegin() const noexcept { return _data; }
+   constexpr iterator end() const noexcept { return _data + _size; }
+   constexpr const_iterator cend() const noexcept { return _data + _size; }
+   reverse_iterator rbegin() const noexcept { return reverse_iterator(end()); }
+   const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(cend()); }
+   reverse_iterator rend() const noexcept { return reverse_iterator(begin()); }
+   const_reverse_iterator crend() const noexcept { return const_reverse_iterator(cbegin()); }
+
+   // Capacity:
+   constexpr size_type size() const noexcept { return _size; }
+   constexpr size_type size_bytes() const noexcept { return _size * sizeof(T); }
+   constexpr bool empty() const noexcept { return _size == 0; }
+
+   // Element access:
+   constexpr reference operator[](size_type pos) const { return _data[pos]; }
+
+   reference at(size_type pos) const
+   {
+      if (pos >= _size)
+        EFL_CXX_THROW(std::out_of_range("efl::eina::span::at"));
+      return _data[pos];
+   }
+
+   constexpr reference front() const { return _data[0]; }
+   constexpr reference back() const { return _data[_size-1]; }
+   constexpr pointer data() const noexcept { return _data; }
+
+   // Subviews:
+   span<T> first(size_type count) const { return span<T>(_data, count); }
+   span<T> last(size_type count) const { return span<T>(_data + _size - count, count); }
+
+   span<T> subspan(size_type offset, size_type count = npos) const
+   {
+      return span<T>(_data + offset, count == npos ? _size - offset : count);
+   }
+
+   // Eina slices:
+   /**
+    * @brief Get a read-only @c Eina_Slice over the elements.
+    */
+   Eina_Slice slice() const noexcept
+   {
+      Eina_Slice s;
+      s.len = size_bytes();
+      s.mem = _data;
+      return s;
+   }
+
+   /**
+    * @brief Get a @c Eina_Rw_Slice over the elements.
+    *
+    * Only available when the elements are not const-qualified.
+    */
+   template <typename U = T>
+   typename std::enable_if<!std::is_const<U>::value, Eina_Rw_Slice>::type
+   rw_slice() const noexcept
+   {
+      Eina_Rw_Slice s;
+      s.len = size_bytes();
+      s.mem = _data;
+      return s;
+   }
+
+   void swap(span<T>& other) noexcept
+   {
+      std::swap(_data, other._data);
+      std::swap(_size, other._size);
+   }
+
+private:
+   pointer _data;
+   size_type _size;
+};
+
+template <typename T>
+constexpr typename span<T>::size_type span<T>::npos;
+
+template <typename T>
+void swap(span<T>& lhs, span<T>& rhs) noexcept
+{
+   lhs.swap(rhs);
+}
+
+} }
+
+#endif
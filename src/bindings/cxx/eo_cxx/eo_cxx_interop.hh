@@ -457,15 +457,17 @@ Eina_List const* convert_to_c_impl(efl::eina::range_list<T> range, tag<Eina_List
 {
   return range.native_handle();
 }
+// with own, the C side frees the container and its elements, the C++
+// container is left empty so that it does not free them too
 template <typename T>
 Eina_List* convert_to_c_impl(efl::eina::list<T>const& c, tag<Eina_List *, efl::eina::list<T>const&, true>)
 {
-  return const_cast<Eina_List*>(c.native_handle());
+  return const_cast<efl::eina::list<T>&>(c).release_native_handle();
 }
 template <typename T>
 Eina_List const* convert_to_c_impl(efl::eina::list<T>const& c, tag<Eina_List const *, efl::eina::list<T>const&, true>)
 {
-  return c.native_handle();
+  return const_cast<efl::eina::list<T>&>(c).release_native_handle();
 }
 
 template <typename T>
@@ -478,15 +480,17 @@ Eina_Array const* convert_to_c_impl(efl::eina::range_array<T> range, tag<Eina_Ar
 {
   return range.native_handle();
 }
+// with own, the C side frees the container and its elements, the C++
+// container is left empty so that it does not free them too
 template <typename T>
 Eina_Array* convert_to_c_impl(efl::eina::array<T>const& c, tag<Eina_Array *, efl::eina::array<T>const&, true>)
 {
-  return const_cast<Eina_Array*>(c.native_handle());
+  return const_cast<efl::eina::array<T>&>(c).release_native_handle();
 }
 template <typename T>
 Eina_Array const* convert_to_c_impl(efl::eina::array<T>const& c, tag<Eina_Array const *, efl::eina::array<T>const&, true>)
 {
-  return c.native_handle();
+  return const_cast<efl::eina::array<T>&>(c).release_native_handle();
 }
 template <typename T>
 Eina_Iterator* convert_to_c_impl(efl::eina::iterator<T>const& i, tag<Eina_Iterator *, efl::eina::iterator<T>const&>)
@@ -11,8 +11,20 @@
 #include "eo_concrete.hh"
 #include "eo_cxx_interop.hh"
 
+#include <cstring>
 #include <functional>
 #include <memory>
+#include <type_traits>
+#include <utility>
+
+/// Generated event descriptions return the address of the exported
+/// Efl_Event_Description, which is a constant expression unless the
+/// symbol is imported from a DLL.
+#ifdef _WIN32
+# define EFL_CXX_EVENT_CONSTEXPR
+#else
+# define EFL_CXX_EVENT_CONSTEXPR constexpr
+#endif
 
 namespace efl { namespace eolian {
 
@@ -24,12 +36,73 @@ static const callback_priority default_ = 0;
 static const callback_priority  after = 100;
 }
 
+/// @cond LOCAL
+/// Registration of one C callback on an object: enough to remove it
+/// again without going through a type-erased deleter. It holds a
+/// reference to the object for as long as it is connected.
+struct _event_connection
+{
+  _event_connection() noexcept
+    : _eo(nullptr), _cb(nullptr), _description(nullptr), _data(nullptr), _free_data(nullptr)
+  {}
+  _event_connection(Eo* eo, ::Efl_Event_Cb cb, Efl_Event_Description const* description
+                    , void* data, void (*free_data)(void*))
+    : _eo( ::efl_ref(eo)), _cb(cb), _description(description), _data(data), _free_data(free_data)
+  {}
+  ~_event_connection()
+  {
+    if(_eo)
+      ::efl_unref(_eo);
+  }
+  _event_connection(_event_connection const& other)
+    : _eo(other._eo ? ::efl_ref(other._eo) : nullptr), _cb(other._cb), _description(other._description)
+    , _data(other._data), _free_data(other._free_data)
+  {}
+  _event_connection(_event_connection&& other) noexcept
+    : _eo(other._eo), _cb(other._cb), _description(other._description)
+    , _data(other._data), _free_data(other._free_data)
+  {
+    other._eo = nullptr;
+  }
+  _event_connection& operator=(_event_connection other) noexcept
+  {
+    std::swap(_eo, other._eo);
+    std::swap(_cb, other._cb);
+    std::swap(_description, other._description);
+    std::swap(_data, other._data);
+    std::swap(_free_data, other._free_data);
+    return *this;
+  }
+
+  void disconnect()
+  {
+    if(!_eo) return;
+    ::efl_event_callback_del(_eo, _description, _cb, _data);
+    // The callback may be the one running right now, so its data is
+    // released from the main loop.
+    if(_free_data)
+      ::ecore_main_loop_thread_safe_call_async(_free_data, _data);
+    *this = _event_connection();
+  }
+
+private:
+  Eo* _eo;
+  ::Efl_Event_Cb _cb;
+  Efl_Event_Description const* _description;
+  void* _data;
+  void (*_free_data)(void*);
+};
+/// @endcond
+
 struct signal_connection
 {
   signal_connection(std::function<void()> deleter)
     : _deleter(deleter) {}
+  signal_connection(_event_connection connection)
+    : _connection(std::move(connection)) {}
   void disconnect()
   {
+    _connection.disconnect();
     if(_deleter)
       {
         _deleter();
@@ -37,6 +110,7 @@ struct signal_connection
       }
   }
 private:
+  _event_connection _connection;
   std::function<void()> _deleter;
   friend struct scoped_signal_connection;
 };
@@ -44,7 +118,7 @@ private:
 struct scoped_signal_connection
 {
   scoped_signal_connection(signal_connection const& other)
-    : _deleter(other._deleter)
+    : _connection(other._connection), _deleter(other._deleter)
   {
   }
   ~scoped_signal_connection()
@@ -53,6 +127,7 @@ struct scoped_signal_connection
   }
   void disconnect()
   {
+    _connection.disconnect();
     if(_deleter)
       {
         _deleter();
@@ -60,11 +135,12 @@ struct scoped_signal_connection
       }
   }
   scoped_signal_connection(scoped_signal_connection&& other)
-    : _deleter(other._deleter)
+    : _connection(std::move(other._connection)), _deleter(other._deleter)
   {
     other._deleter = std::function<void()>();
   }
 private:
+  _event_connection _connection;
   std::function<void()> _deleter;
 
   scoped_signal_connection& operator=(scoped_signal_connection const&) = delete;
@@ -72,51 +148,15 @@ private:
 };
 
 template <typename F>
-struct _event_deleter
+void _event_data_delete(void* data)
 {
-  _event_deleter(F* data, Eo* eo, ::Efl_Event_Cb cb, Efl_Event_Description const* description)
-    : _data(data), _eo( ::efl_ref(eo)), _cb(cb), _description(description)
-  {
-  }
-  ~_event_deleter()
-  {
-    ::efl_unref(_eo);
-  }
-  _event_deleter(_event_deleter const& other)
-    : _data(other._data), _eo( ::efl_ref(other._eo)), _cb(other._cb), _description(other._description)
-  {}
-  _event_deleter& operator=(_event_deleter const& other)
-  {
-    ::efl_unref( _eo);
-    _data = other._data;
-    _eo = ::efl_ref(other._eo);
-    _cb = other._cb;
-    _description = other._description;
-    return *this;
-  }
-
-  void operator()() const
-  {
-    ::efl_event_callback_del(_eo, _description, _cb, _data);
-    ::ecore_main_loop_thread_safe_call_async(&_deleter_call, _data);
-  }
-
-private:
-  static void _deleter_call(void* data)
-  {
-    delete static_cast<F*>(data);
-  }
-
-  F* _data;
-  Eo* _eo;
-  ::Efl_Event_Cb _cb;
-  Efl_Event_Description const* _description;
-};
+  delete static_cast<F*>(data);
+}
 
 template <typename F>
 signal_connection make_signal_connection(std::unique_ptr<F>& data, Eo* eo, ::Efl_Event_Cb cb, Efl_Event_Description const* description)
 {
-  signal_connection c(_event_deleter<F>(data.get(), eo, cb, description));
+  signal_connection c(_event_connection(eo, cb, description, data.get(), &_event_data_delete<F>));
   data.release();
   return c;
 }
@@ -142,26 +182,68 @@ void event_callback(void *data, ::Efl_Event const* event)
    _detail::really_call_event<T, P>
      (wrapper, *f, event->info, std::is_void<P>{});
 }
+
+/// Callables small and trivial enough to travel inside the callback
+/// data pointer itself: function pointers, captureless lambdas and
+/// lambdas capturing a single pointer such as @c this.
+template <typename F>
+struct is_inline_callable
+  : std::integral_constant
+  <bool, std::is_trivially_copyable<F>::value
+   && sizeof(F) <= sizeof(void*) && alignof(F) <= alignof(void*)>
+{};
+
+template <typename T, typename P, typename F>
+void event_callback_inline(void *data, ::Efl_Event const* event)
+{
+   T wrapper(::efl_ref(event->object));
+   typename std::aligned_storage<sizeof(F), alignof(F)>::type storage;
+   std::memcpy(&storage, &data, sizeof(F));
+   _detail::really_call_event<T, P>
+     (wrapper, *reinterpret_cast<F*>(&storage), event->info, std::is_void<P>{});
+}
+
+template <typename P, typename Object, typename F>
+signal_connection event_add_impl(Efl_Event_Description const* description, Object object
+                                 , F&& function, std::true_type)
+{
+  typedef typename std::decay<F>::type function_type;
+  void* data = nullptr;
+  std::memcpy(&data, std::addressof(function), sizeof(function_type));
+
+  ::Efl_Event_Cb cb = &_detail::event_callback_inline<Object, P, function_type>;
+  ::efl_event_callback_priority_add(object._eo_ptr(), description, 0, cb, data);
+  return signal_connection(_event_connection(object._eo_ptr(), cb, description, data, nullptr));
 }
 
+template <typename P, typename Object, typename F>
+signal_connection event_add_impl(Efl_Event_Description const* description, Object object
+                                 , F&& function, std::false_type)
+{
+  typedef typename std::remove_reference<F>::type function_type;
+  std::unique_ptr<function_type> f(new function_type(std::forward<F>(function)));
+
+  ::Efl_Event_Cb cb = &_detail::event_callback<Object, P, function_type>;
+  ::efl_event_callback_priority_add(object._eo_ptr(), description, 0, cb, f.get());
+  return make_signal_connection(f, object._eo_ptr(), cb, description);
+}
+}
+
+/// Connects @p function to @p event on @p object.
+///
+/// The C callback is a trampoline instantiated for the exact type of
+/// @p function, so the call is resolved at compile time and can be
+/// inlined. Callables for which @c _detail::is_inline_callable holds are
+/// stored in the callback data pointer and connecting them allocates
+/// nothing; other callables are moved to the heap.
 template <typename Event, typename Object, typename F>
 signal_connection event_add(Event event, Object object, F&& function)
 {
   static_assert((eo::is_eolian_object<Object>::value), "Type is not an object");
 
-  typedef typename std::remove_reference<F>::type function_type;
-  std::unique_ptr<function_type> f(new function_type(std::forward<F>(function)));
-
-  ::efl_event_callback_priority_add
-      (object._eo_ptr(), event.description(), 0
-       , static_cast<Efl_Event_Cb>
-       (&_detail::event_callback<Object, typename Event::parameter_type, function_type>)
-       , f.get());
-  return make_signal_connection
-    (f, object._eo_ptr()
-     , static_cast<Efl_Event_Cb>
-     (&_detail::event_callback<Object, typename Event::parameter_type, function_type>)
-     , event.description());
+  return _detail::event_add_impl<typename Event::parameter_type>
+    (event.description(), object, std::forward<F>(function)
+     , _detail::is_inline_callable<typename std::decay<F>::type>{});
 }
 
 } }
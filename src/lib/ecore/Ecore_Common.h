@@ -1791,6 +1791,11 @@ typedef void (*Ecore_Thread_Notify_Cb)(void *data, Ecore_Thread *thread, void *m
  * so some of the jobs started may be waiting until another one finishes
  * before it can execute its own @p func_blocking.
  *
+ * Waiting jobs are spread over one queue per thread of the pool. Each queue
+ * is served in order, but a job queued later on another queue may start
+ * first, so the @p func_blocking of waiting jobs are not started in strict
+ * queue order either.
+ *
  * @see ecore_thread_feedback_run()
  * @see ecore_thread_cancel()
  * @see ecore_thread_reschedule()
@@ -1842,6 +1847,69 @@ EAPI Ecore_Thread *ecore_thread_feedback_run(Ecore_Thread_Cb func_heavy, Ecore_T
                                              Ecore_Thread_Cb func_end, Ecore_Thread_Cb func_cancel,
                                              const void *data, Eina_Bool try_no_queue);
 
+/**
+ * @typedef Ecore_Thread_Job
+ * A job to give to ecore_thread_run_batch().
+ *
+ * @since 1.22
+ */
+typedef struct _Ecore_Thread_Job Ecore_Thread_Job;
+
+/**
+ * @struct _Ecore_Thread_Job
+ * The arguments ecore_thread_run() would take for one job.
+ *
+ * @since 1.22
+ */
+struct _Ecore_Thread_Job
+{
+   Ecore_Thread_Cb func_blocking; /**< The function to run in another thread */
+   Ecore_Thread_Cb func_end; /**< Called from the main loop when done (may be NULL) */
+   Ecore_Thread_Cb func_cancel; /**< Called from the main loop on cancel or failure (may be NULL) */
+   const void     *data; /**< User context data passed to all callbacks */
+};
+
+/**
+ * Schedules many tasks to run in parallel threads at once.
+ *
+ * @param jobs An array of @p count jobs to run.
+ * @param count The number of jobs in @p jobs.
+ * @param threads An array of @p count thread handlers to fill, or @c NULL.
+ * @return The number of jobs that were scheduled.
+ *
+ * This does the same as calling ecore_thread_run() on every job of
+ * @p jobs, but spreads them over the thread pool in one go, which is a lot
+ * cheaper when starting many small jobs. A job that could not be scheduled
+ * gets a @c NULL handler in @p threads, and its @c func_cancel is called
+ * if it has one.
+ *
+ * @see ecore_thread_run()
+ * @see ecore_thread_hint_set()
+ * @since 1.22
+ */
+EAPI unsigned int ecore_thread_run_batch(const Ecore_Thread_Job *jobs, unsigned int count, Ecore_Thread **threads);
+
+/**
+ * Gives scheduling hints for a pending job of the thread pool.
+ *
+ * @param thread The thread to give the hints to.
+ * @param priority How soon the job should run compared to the other ones.
+ * @param affinity The CPU to run the job on, or @c -1 for any.
+ * @return @c EINA_TRUE if the hints were applied, @c EINA_FALSE if the job
+ * already started or does not run in the pool.
+ *
+ * An #EINA_THREAD_URGENT job is run before the other pending ones and an
+ * #EINA_THREAD_IDLE one only when there is nothing else to do. The
+ * priority does not change the priority of the thread itself. When
+ * @p affinity is set, the thread running the job is bound to that CPU with
+ * eina_sched_affinity_set() for the time of the job.
+ *
+ * @see ecore_thread_run()
+ * @see ecore_thread_feedback_run()
+ * @since 1.22
+ */
+EAPI Eina_Bool ecore_thread_hint_set(Ecore_Thread *thread, Eina_Thread_Priority priority, int affinity);
+
 /**
  * Cancels a running thread.
  *
@@ -162,8 +162,12 @@ struct _Efl_Loop_Data
 
    double               last_check;
    Eina_Inlist         *timers;
+   Eina_Rbtree         *timers_tree; // same timers, to find where to insert
+   double               timers_shift;
    Eina_Inlist         *suspended;
    Efl_Loop_Timer_Data *timer_current;
+   unsigned long long   timers_order;
+   unsigned long long   timers_generation;
    int                  timers_added;
 
    Eina_Value           exit_code;
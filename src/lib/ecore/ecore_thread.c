@@ -15,6 +15,14 @@
 #include "Ecore.h"
 #include "ecore_private.h"
 
+#ifdef EINA_HAVE_PTHREAD_AFFINITY
+# include <pthread.h>
+# ifndef __linux__
+#  include <pthread_np.h>
+#  define cpu_set_t cpuset_t
+# endif
+#endif
+
 # define LK(x)        Eina_Lock x
 # define LKI(x)       eina_lock_new(&(x))
 # define LKD(x)       eina_lock_free(&(x))
@@ -46,10 +54,37 @@
 # define PHC(x, f, d) eina_thread_create(&(x), EINA_THREAD_BACKGROUND, -1, (void *)f, d)
 # define PHJ(x)       eina_thread_join(x)
 
+#ifdef __ATOMIC_RELAXED
+# define ATOMIC 1
+#endif
+
 typedef struct _Ecore_Pthread_Worker Ecore_Pthread_Worker;
 typedef struct _Ecore_Pthread        Ecore_Pthread;
 typedef struct _Ecore_Thread_Data    Ecore_Thread_Data;
 typedef struct _Ecore_Thread_Waiter  Ecore_Thread_Waiter;
+typedef struct _Ecore_Thread_Slot    Ecore_Thread_Slot;
+typedef struct _Ecore_Thread_Job_Run Ecore_Thread_Job_Run;
+
+/* Pending jobs are queued on the slot of one of the pool threads. A thread
+ * takes the oldest job of its own slot and, once it runs dry, steals the
+ * oldest one of another slot. Short jobs go before feedback ones and idle
+ * priority jobs come last. Jobs of one slot start in the order they were
+ * queued, jobs of different slots may not. */
+enum
+{
+   ECORE_THREAD_QUEUE_SHORT,
+   ECORE_THREAD_QUEUE_FEEDBACK,
+   ECORE_THREAD_QUEUE_IDLE,
+   ECORE_THREAD_QUEUE_LAST
+};
+
+struct _Ecore_Thread_Slot
+{
+   SLK(lock);
+   Eina_Inlist *jobs[ECORE_THREAD_QUEUE_LAST];
+   Eina_Bool    used; /* a pool thread is attached to it */
+   char         pad[64]; /* keep the locks of two slots apart */
+};
 
 struct _Ecore_Thread_Waiter
 {
@@ -66,6 +101,8 @@ struct _Ecore_Thread_Data
 
 struct _Ecore_Pthread_Worker
 {
+   EINA_INLIST;
+
    union
    {
       struct
@@ -99,6 +136,7 @@ struct _Ecore_Pthread_Worker
    } u;
 
    Ecore_Thread_Waiter *waiter;
+   Ecore_Thread_Slot   *slot; /* where the job is queued while pending */
    Ecore_Thread_Cb      func_cancel;
    Ecore_Thread_Cb      func_end;
    PH(self);
@@ -109,6 +147,8 @@ struct _Ecore_Pthread_Worker
    const void          *data;
 
    int                  cancel;
+   int                  affinity;
+   Eina_Thread_Priority priority;
 
    SLK(cancel_mutex);
 
@@ -145,6 +185,17 @@ struct _Ecore_Pthread_Message
    Eina_Bool   sync : 1;
 };
 
+struct _Ecore_Thread_Job_Run
+{
+   Ecore_Pthread_Worker *work;
+   Ecore_Thread_Slot    *slot;
+   Eina_Bool             pinned;
+#ifdef EINA_HAVE_PTHREAD_AFFINITY
+   Eina_Bool             affinity_saved;
+   cpu_set_t             affinity; /* what the thread had before the job */
+#endif
+};
+
 static int _ecore_thread_count_max = 0;
 
 static void _ecore_thread_handler(void *data);
@@ -153,8 +204,12 @@ static int _ecore_thread_count = 0;
 static int _ecore_thread_count_no_queue = 0;
 
 static Eina_List *_ecore_running_job = NULL;
-static Eina_List *_ecore_pending_job_threads = NULL;
-static Eina_List *_ecore_pending_job_threads_feedback = NULL;
+static Ecore_Thread_Slot *_ecore_thread_slots = NULL;
+static int _ecore_thread_slots_count = 0;
+static int _ecore_thread_slots_used = 0;
+static unsigned int _ecore_thread_slot_next = 0;
+static int _ecore_pending_job_threads = 0;
+static int _ecore_pending_job_threads_feedback = 0;
 static SLK(_ecore_pending_job_threads_mutex);
 static SLK(_ecore_running_job_mutex);
 
@@ -171,6 +226,220 @@ static int _ecore_thread_worker_count = 0;
 static void                 *_ecore_thread_worker(void *);
 static Ecore_Pthread_Worker *_ecore_thread_worker_new(void);
 
+/* the counters are read without the slot locks to know if a thread has
+ * anything left to do */
+static inline int
+_ecore_thread_counter_get(int *counter)
+{
+#ifdef ATOMIC
+   return __atomic_load_n(counter, __ATOMIC_ACQUIRE);
+#else
+   int ret;
+
+   SLKL(_ecore_pending_job_threads_mutex);
+   ret = *counter;
+   SLKU(_ecore_pending_job_threads_mutex);
+   return ret;
+#endif
+}
+
+static inline void
+_ecore_thread_counter_add(int *counter, int n)
+{
+#ifdef ATOMIC
+   __atomic_add_fetch(counter, n, __ATOMIC_RELEASE);
+#else
+   SLKL(_ecore_pending_job_threads_mutex);
+   *counter += n;
+   SLKU(_ecore_pending_job_threads_mutex);
+#endif
+}
+
+static inline int
+_ecore_thread_pending_count(void)
+{
+   return _ecore_thread_counter_get(&_ecore_pending_job_threads) +
+     _ecore_thread_counter_get(&_ecore_pending_job_threads_feedback);
+}
+
+static inline int
+_ecore_thread_queue_get(const Ecore_Pthread_Worker *work)
+{
+   if (work->priority == EINA_THREAD_IDLE) return ECORE_THREAD_QUEUE_IDLE;
+   if (work->feedback_run) return ECORE_THREAD_QUEUE_FEEDBACK;
+   return ECORE_THREAD_QUEUE_SHORT;
+}
+
+/* must be called with the slot lock held */
+static void
+_ecore_thread_slot_push(Ecore_Thread_Slot *slot, Ecore_Pthread_Worker *work)
+{
+   int q = _ecore_thread_queue_get(work);
+
+   if (work->priority == EINA_THREAD_URGENT)
+     slot->jobs[q] = eina_inlist_prepend(slot->jobs[q], EINA_INLIST_GET(work));
+   else
+     slot->jobs[q] = eina_inlist_append(slot->jobs[q], EINA_INLIST_GET(work));
+   work->slot = slot;
+   _ecore_thread_counter_add(work->feedback_run ?
+                             &_ecore_pending_job_threads_feedback :
+                             &_ecore_pending_job_threads, 1);
+}
+
+/* must be called with the slot lock held */
+static void
+_ecore_thread_slot_remove(Ecore_Thread_Slot *slot, Ecore_Pthread_Worker *work)
+{
+   int q = _ecore_thread_queue_get(work);
+
+   slot->jobs[q] = eina_inlist_remove(slot->jobs[q], EINA_INLIST_GET(work));
+   work->slot = NULL;
+   _ecore_thread_counter_add(work->feedback_run ?
+                             &_ecore_pending_job_threads_feedback :
+                             &_ecore_pending_job_threads, -1);
+}
+
+static Ecore_Pthread_Worker *
+_ecore_thread_slot_pop(Ecore_Thread_Slot *slot)
+{
+   Ecore_Pthread_Worker *work = NULL;
+   int q;
+
+   SLKL(slot->lock);
+   for (q = 0; q < ECORE_THREAD_QUEUE_LAST; q++)
+     {
+        Eina_Inlist *l = slot->jobs[q];
+
+        if (!l) continue;
+        work = EINA_INLIST_CONTAINER_GET(l, Ecore_Pthread_Worker);
+        _ecore_thread_slot_remove(slot, work);
+        break;
+     }
+   SLKU(slot->lock);
+
+   return work;
+}
+
+/* take a job from our own slot, or from someone else */
+static Ecore_Pthread_Worker *
+_ecore_thread_job_get(Ecore_Thread_Slot *own)
+{
+   Ecore_Pthread_Worker *work;
+   int i, n, start;
+
+   work = _ecore_thread_slot_pop(own);
+   if (work) return work;
+   if (!_ecore_thread_pending_count()) return NULL;
+
+   n = _ecore_thread_counter_get(&_ecore_thread_slots_used);
+   start = own - _ecore_thread_slots;
+   for (i = 1; i <= n; i++)
+     {
+        Ecore_Thread_Slot *slot = _ecore_thread_slots + ((start + i) % n);
+
+        if (slot == own) continue;
+        work = _ecore_thread_slot_pop(slot);
+        if (work) return work;
+     }
+
+   return NULL;
+}
+
+/* only called from the main loop */
+static Eina_Bool
+_ecore_thread_slots_init(void)
+{
+   int i;
+
+   if (_ecore_thread_slots) return EINA_TRUE;
+
+   /* ecore_thread_max_set() will not go over this */
+   _ecore_thread_slots_count = 32 * eina_cpu_count();
+   if (_ecore_thread_slots_count < _ecore_thread_count_max)
+     _ecore_thread_slots_count = _ecore_thread_count_max;
+   _ecore_thread_slots = calloc(_ecore_thread_slots_count, sizeof(Ecore_Thread_Slot));
+   if (!_ecore_thread_slots) return EINA_FALSE;
+   for (i = 0; i < _ecore_thread_slots_count; i++)
+     SLKI(_ecore_thread_slots[i].lock);
+
+   return EINA_TRUE;
+}
+
+/* only called from the main loop, spread the jobs over the slots */
+static Ecore_Thread_Slot *
+_ecore_thread_slot_next_get(void)
+{
+   int max = MIN(_ecore_thread_count_max, _ecore_thread_slots_count);
+
+   if (_ecore_thread_counter_get(&_ecore_thread_slots_used) < max)
+     {
+#ifdef ATOMIC
+        __atomic_store_n(&_ecore_thread_slots_used, max, __ATOMIC_RELEASE);
+#else
+        SLKL(_ecore_pending_job_threads_mutex);
+        _ecore_thread_slots_used = max;
+        SLKU(_ecore_pending_job_threads_mutex);
+#endif
+     }
+
+   return _ecore_thread_slots + (_ecore_thread_slot_next++ % max);
+}
+
+static void
+_ecore_thread_queue_push(Ecore_Pthread_Worker *work)
+{
+   Ecore_Thread_Slot *slot = _ecore_thread_slot_next_get();
+
+   SLKL(slot->lock);
+   _ecore_thread_slot_push(slot, work);
+   SLKU(slot->lock);
+}
+
+static Eina_Bool
+_ecore_thread_queue_remove(Ecore_Pthread_Worker *work)
+{
+   Ecore_Thread_Slot *slot;
+   Eina_Bool ret = EINA_FALSE;
+
+   if (!work) return EINA_FALSE;
+   slot = work->slot;
+   if (!slot) return EINA_FALSE;
+
+   SLKL(slot->lock);
+   /* it could have been taken by a thread in the meantime */
+   if (work->slot == slot)
+     {
+        _ecore_thread_slot_remove(slot, work);
+        ret = EINA_TRUE;
+     }
+   SLKU(slot->lock);
+
+   return ret;
+}
+
+/* must be called with _ecore_pending_job_threads_mutex held */
+static Eina_Bool
+_ecore_thread_spawn(void)
+{
+   Ecore_Thread_Slot *slot = NULL;
+   PH(thread);
+   int i;
+
+   for (i = 0; i < _ecore_thread_slots_count; i++)
+     if (!_ecore_thread_slots[i].used)
+       {
+          slot = _ecore_thread_slots + i;
+          break;
+       }
+   if (!slot) return EINA_FALSE;
+
+   if (!PHC(thread, _ecore_thread_worker, slot)) return EINA_FALSE;
+
+   slot->used = EINA_TRUE;
+   _ecore_thread_count++;
+   return EINA_TRUE;
+}
+
 static PH(get_main_loop_thread) (void)
 {
    static PH(main_loop_thread);
@@ -337,72 +606,39 @@ _ecore_message_notify_handler(void *data)
 }
 
 static void
-_ecore_short_job_cleanup(void *data)
+_ecore_thread_affinity_pin(Ecore_Thread_Job_Run *run)
 {
-   Ecore_Pthread_Worker *work = data;
-
-   DBG("cleanup work=%p, thread=%" PRIu64, work, (uint64_t)work->self);
-
-   SLKL(_ecore_running_job_mutex);
-   _ecore_running_job = eina_list_remove(_ecore_running_job, work);
-   SLKU(_ecore_running_job_mutex);
-
-   if (work->reschedule)
-     {
-        work->reschedule = EINA_FALSE;
-
-        SLKL(_ecore_pending_job_threads_mutex);
-        _ecore_pending_job_threads = eina_list_append(_ecore_pending_job_threads, work);
-        SLKU(_ecore_pending_job_threads_mutex);
-     }
-   else
-     {
-        ecore_main_loop_thread_safe_call_async(_ecore_thread_handler, work);
-     }
+#ifdef EINA_HAVE_PTHREAD_AFFINITY
+   run->affinity_saved = !pthread_getaffinity_np(pthread_self(),
+                                                 sizeof(run->affinity),
+                                                 &run->affinity);
+#endif
+   run->pinned = eina_sched_affinity_set(run->work->affinity);
 }
 
 static void
-_ecore_short_job(PH(thread))
+_ecore_thread_affinity_restore(Ecore_Thread_Job_Run *run)
 {
-   Ecore_Pthread_Worker *work;
-   int cancel;
-
-   SLKL(_ecore_pending_job_threads_mutex);
-
-   if (!_ecore_pending_job_threads)
-     {
-        SLKU(_ecore_pending_job_threads_mutex);
-        return;
-     }
-
-   work = eina_list_data_get(_ecore_pending_job_threads);
-   _ecore_pending_job_threads = eina_list_remove_list(_ecore_pending_job_threads,
-                                                      _ecore_pending_job_threads);
-   SLKU(_ecore_pending_job_threads_mutex);
-
-   SLKL(_ecore_running_job_mutex);
-   _ecore_running_job = eina_list_append(_ecore_running_job, work);
-   SLKU(_ecore_running_job_mutex);
-
-   SLKL(work->cancel_mutex);
-   cancel = work->cancel;
-   SLKU(work->cancel_mutex);
-   work->self = thread;
-
-   EINA_THREAD_CLEANUP_PUSH(_ecore_short_job_cleanup, work);
-   if (!cancel)
-     work->u.short_run.func_blocking((void *)work->data, (Ecore_Thread *)work);
-   eina_thread_cancellable_set(EINA_FALSE, NULL);
-   EINA_THREAD_CLEANUP_POP(EINA_TRUE);
+   if (!run->pinned) return;
+#ifdef EINA_HAVE_PTHREAD_AFFINITY
+   if ((run->affinity_saved) &&
+       (!pthread_setaffinity_np(pthread_self(), sizeof(run->affinity),
+                                &run->affinity)))
+     return;
+#endif
+   eina_sched_affinity_set(-1);
 }
 
 static void
-_ecore_feedback_job_cleanup(void *data)
+_ecore_thread_job_cleanup(void *data)
 {
-   Ecore_Pthread_Worker *work = data;
+   Ecore_Thread_Job_Run *run = data;
+   Ecore_Pthread_Worker *work = run->work;
 
    DBG("cleanup work=%p, thread=%" PRIu64, work, (uint64_t)work->self);
 
+   _ecore_thread_affinity_restore(run);
+
    SLKL(_ecore_running_job_mutex);
    _ecore_running_job = eina_list_remove(_ecore_running_job, work);
    SLKU(_ecore_running_job_mutex);
@@ -411,9 +647,9 @@ _ecore_feedback_job_cleanup(void *data)
      {
         work->reschedule = EINA_FALSE;
 
-        SLKL(_ecore_pending_job_threads_mutex);
-        _ecore_pending_job_threads_feedback = eina_list_append(_ecore_pending_job_threads_feedback, work);
-        SLKU(_ecore_pending_job_threads_mutex);
+        SLKL(run->slot->lock);
+        _ecore_thread_slot_push(run->slot, work);
+        SLKU(run->slot->lock);
      }
    else
      {
@@ -422,23 +658,11 @@ _ecore_feedback_job_cleanup(void *data)
 }
 
 static void
-_ecore_feedback_job(PH(thread))
+_ecore_thread_job_run(Ecore_Thread_Slot *slot, Ecore_Pthread_Worker *work, PH(thread))
 {
-   Ecore_Pthread_Worker *work;
+   Ecore_Thread_Job_Run run = { work, slot, EINA_FALSE };
    int cancel;
 
-   SLKL(_ecore_pending_job_threads_mutex);
-
-   if (!_ecore_pending_job_threads_feedback)
-     {
-        SLKU(_ecore_pending_job_threads_mutex);
-        return;
-     }
-
-   work = eina_list_data_get(_ecore_pending_job_threads_feedback);
-   _ecore_pending_job_threads_feedback = eina_list_remove_list(_ecore_pending_job_threads_feedback,
-                                                               _ecore_pending_job_threads_feedback);
-   SLKU(_ecore_pending_job_threads_mutex);
    SLKL(_ecore_running_job_mutex);
    _ecore_running_job = eina_list_append(_ecore_running_job, work);
    SLKU(_ecore_running_job_mutex);
@@ -448,9 +672,16 @@ _ecore_feedback_job(PH(thread))
    SLKU(work->cancel_mutex);
    work->self = thread;
 
-   EINA_THREAD_CLEANUP_PUSH(_ecore_feedback_job_cleanup, work);
+   if (work->affinity >= 0) _ecore_thread_affinity_pin(&run);
+
+   EINA_THREAD_CLEANUP_PUSH(_ecore_thread_job_cleanup, &run);
    if (!cancel)
-     work->u.feedback_run.func_heavy((void *)work->data, (Ecore_Thread *)work);
+     {
+        if (work->feedback_run)
+          work->u.feedback_run.func_heavy((void *)work->data, (Ecore_Thread *)work);
+        else
+          work->u.short_run.func_blocking((void *)work->data, (Ecore_Thread *)work);
+     }
    eina_thread_cancellable_set(EINA_FALSE, NULL);
    EINA_THREAD_CLEANUP_POP(EINA_TRUE);
 }
@@ -489,40 +720,44 @@ _ecore_direct_worker(Ecore_Pthread_Worker *work)
    return NULL;
 }
 
+/* must be called with _ecore_pending_job_threads_mutex held */
 static void
-_ecore_thread_worker_cleanup(void *data EINA_UNUSED)
+_ecore_thread_worker_leave(Ecore_Thread_Slot *slot)
 {
-   DBG("cleanup thread=%" PRIuPTR " (should join)", PHS());
-   SLKL(_ecore_pending_job_threads_mutex);
    _ecore_thread_count--;
+   slot->used = EINA_FALSE;
    ecore_main_loop_thread_safe_call_async((Ecore_Cb)_ecore_thread_join,
                                           (void *)(intptr_t)PHS());
+}
+
+static void
+_ecore_thread_worker_cleanup(void *data)
+{
+   DBG("cleanup thread=%" PRIuPTR " (should join)", PHS());
+   SLKL(_ecore_pending_job_threads_mutex);
+   _ecore_thread_worker_leave(data);
    SLKU(_ecore_pending_job_threads_mutex);
 }
 
 static void *
-_ecore_thread_worker(void *data EINA_UNUSED)
+_ecore_thread_worker(void *data)
 {
+   Ecore_Thread_Slot *slot = data;
+   Ecore_Pthread_Worker *work;
+
    eina_thread_cancellable_set(EINA_FALSE, NULL);
-   EINA_THREAD_CLEANUP_PUSH(_ecore_thread_worker_cleanup, NULL);
+   EINA_THREAD_CLEANUP_PUSH(_ecore_thread_worker_cleanup, slot);
 restart:
 
-   /* these 2 are cancellation points as user cb may enable */
-   _ecore_short_job(PHS());
-   _ecore_feedback_job(PHS());
+   /* this is a cancellation point as user cb may enable */
+   while ((work = _ecore_thread_job_get(slot)))
+     _ecore_thread_job_run(slot, work, PHS());
 
    /* from here on, cancellations are guaranteed to be disabled */
 
-   /* FIXME: Check if there is feedback running task todo, and switch to feedback run handler. */
    eina_thread_name_set(eina_thread_self(), "Ethread-worker");
 
-   SLKL(_ecore_pending_job_threads_mutex);
-   if (_ecore_pending_job_threads || _ecore_pending_job_threads_feedback)
-     {
-        SLKU(_ecore_pending_job_threads_mutex);
-        goto restart;
-     }
-   SLKU(_ecore_pending_job_threads_mutex);
+   if (_ecore_thread_pending_count()) goto restart;
 
    /* Sleep a little to prevent premature death */
 #ifdef _WIN32
@@ -531,15 +766,18 @@ restart:
    usleep(50);
 #endif
 
+   /* a job queued after this check finds one thread less and starts one */
    SLKL(_ecore_pending_job_threads_mutex);
-   if (_ecore_pending_job_threads || _ecore_pending_job_threads_feedback)
+   if (_ecore_thread_pending_count())
      {
         SLKU(_ecore_pending_job_threads_mutex);
         goto restart;
      }
+   DBG("leaving thread=%" PRIuPTR " (should join)", PHS());
+   _ecore_thread_worker_leave(slot);
    SLKU(_ecore_pending_job_threads_mutex);
 
-   EINA_THREAD_CLEANUP_POP(EINA_TRUE);
+   EINA_THREAD_CLEANUP_POP(EINA_FALSE);
 
    return NULL;
 }
@@ -560,6 +798,9 @@ _ecore_thread_worker_new(void)
      {
         memset(result, 0, sizeof(Ecore_Pthread_Worker));
      }
+   if (!result) return NULL;
+   result->affinity = -1;
+   result->priority = EINA_THREAD_BACKGROUND;
 
    SLKI(result->cancel_mutex);
    LKI(result->mutex);
@@ -590,24 +831,18 @@ _ecore_thread_shutdown(void)
    Eina_List *l;
    Eina_Bool test;
    int iteration = 0;
+   int i;
 
-   SLKL(_ecore_pending_job_threads_mutex);
-
-   EINA_LIST_FREE(_ecore_pending_job_threads, work)
-     {
-        if (work->func_cancel)
-          work->func_cancel((void *)work->data, (Ecore_Thread *)work);
-        free(work);
-     }
-
-   EINA_LIST_FREE(_ecore_pending_job_threads_feedback, work)
+   for (i = 0; _ecore_thread_slots && i < _ecore_thread_slots_count; i++)
      {
-        if (work->func_cancel)
-          work->func_cancel((void *)work->data, (Ecore_Thread *)work);
-        free(work);
+        while ((work = _ecore_thread_slot_pop(_ecore_thread_slots + i)))
+          {
+             if (work->func_cancel)
+               work->func_cancel((void *)work->data, (Ecore_Thread *)work);
+             free(work);
+          }
      }
 
-   SLKU(_ecore_pending_job_threads_mutex);
    SLKL(_ecore_running_job_mutex);
 
    EINA_LIST_FOREACH(_ecore_running_job, l, work)
@@ -649,6 +884,14 @@ _ecore_thread_shutdown(void)
         free(work);
      }
 
+   for (i = 0; _ecore_thread_slots && i < _ecore_thread_slots_count; i++)
+     SLKD(_ecore_thread_slots[i].lock);
+   free(_ecore_thread_slots);
+   _ecore_thread_slots = NULL;
+   _ecore_thread_slots_count = 0;
+   _ecore_thread_slots_used = 0;
+   _ecore_thread_slot_next = 0;
+
    SLKD(_ecore_pending_job_threads_mutex);
    LRWKD(_ecore_thread_global_hash_lock);
    LKD(_ecore_thread_global_hash_mutex);
@@ -664,13 +907,12 @@ ecore_thread_run(Ecore_Thread_Cb func_blocking,
 {
    Ecore_Pthread_Worker *work;
    Eina_Bool tried = EINA_FALSE;
-   PH(thread);
 
    EINA_MAIN_LOOP_CHECK_RETURN_VAL(NULL);
 
    if (!func_blocking) return NULL;
 
-   work = _ecore_thread_worker_new();
+   work = _ecore_thread_slots_init() ? _ecore_thread_worker_new() : NULL;
    if (!work)
      {
         if (func_cancel)
@@ -692,10 +934,10 @@ ecore_thread_run(Ecore_Thread_Cb func_blocking,
    work->self = 0;
    work->hash = NULL;
 
-   SLKL(_ecore_pending_job_threads_mutex);
-   _ecore_pending_job_threads = eina_list_append(_ecore_pending_job_threads, work);
+   _ecore_thread_queue_push(work);
 
-   if (_ecore_thread_count == _ecore_thread_count_max)
+   SLKL(_ecore_pending_job_threads_mutex);
+   if (_ecore_thread_count >= _ecore_thread_count_max)
      {
         SLKU(_ecore_pending_job_threads_mutex);
         return (Ecore_Thread *)work;
@@ -709,9 +951,8 @@ ecore_thread_run(Ecore_Thread_Cb func_blocking,
    SLKL(_ecore_pending_job_threads_mutex);
 
 retry:
-   if (PHC(thread, _ecore_thread_worker, NULL))
+   if (_ecore_thread_spawn())
      {
-        _ecore_thread_count++;
         SLKU(_ecore_pending_job_threads_mutex);
         return (Ecore_Thread *)work;
      }
@@ -722,10 +963,8 @@ retry:
         goto retry;
      }
 
-   if (_ecore_thread_count == 0)
+   if ((_ecore_thread_count == 0) && (_ecore_thread_queue_remove(work)))
      {
-        _ecore_pending_job_threads = eina_list_remove(_ecore_pending_job_threads, work);
-
         if (work->func_cancel)
           work->func_cancel((void *)work->data, (Ecore_Thread *)work);
 
@@ -739,11 +978,144 @@ retry:
    return (Ecore_Thread *)work;
 }
 
+EAPI unsigned int
+ecore_thread_run_batch(const Ecore_Thread_Job *jobs,
+                       unsigned int count,
+                       Ecore_Thread **threads)
+{
+   Ecore_Pthread_Worker **works;
+   Ecore_Thread_Slot *slot = NULL;
+   unsigned int i, queued = 0, per_slot;
+   int spawn;
+   Eina_Bool tried = EINA_FALSE;
+
+   EINA_MAIN_LOOP_CHECK_RETURN_VAL(0);
+
+   if ((!jobs) || (!count)) return 0;
+
+   works = calloc(count, sizeof(Ecore_Pthread_Worker *));
+   if ((!works) || (!_ecore_thread_slots_init())) goto on_error;
+
+   for (i = 0; i < count; i++)
+     {
+        Ecore_Pthread_Worker *work;
+
+        if (!jobs[i].func_blocking) continue;
+        work = _ecore_thread_worker_new();
+        if (!work)
+          {
+             if (jobs[i].func_cancel)
+               jobs[i].func_cancel((void *)jobs[i].data, NULL);
+             continue;
+          }
+        work->u.short_run.func_blocking = jobs[i].func_blocking;
+        work->func_end = jobs[i].func_end;
+        work->func_cancel = jobs[i].func_cancel;
+        work->data = jobs[i].data;
+        works[i] = work;
+     }
+
+   /* queue the jobs in runs, one lock per slot, so that every thread of
+    * the pool gets its share without having to steal it */
+   per_slot = count / _ecore_thread_count_max;
+   if (per_slot < 1) per_slot = 1;
+   for (i = 0; i < count; i++)
+     {
+        if ((i % per_slot) == 0)
+          {
+             if (slot) SLKU(slot->lock);
+             slot = _ecore_thread_slot_next_get();
+             SLKL(slot->lock);
+          }
+        if (!works[i]) continue;
+        _ecore_thread_slot_push(slot, works[i]);
+        queued++;
+     }
+   if (slot) SLKU(slot->lock);
+
+   /* start as many threads as there are jobs, if we are allowed to */
+   SLKL(_ecore_pending_job_threads_mutex);
+   spawn = MIN((int)queued, _ecore_thread_count_max - _ecore_thread_count);
+   while (spawn > 0)
+     {
+        eina_threads_init();
+        if (_ecore_thread_spawn())
+          {
+             spawn--;
+             continue;
+          }
+        eina_threads_shutdown();
+        if (tried) break;
+        _ecore_main_call_flush();
+        tried = EINA_TRUE;
+     }
+
+   if (_ecore_thread_count == 0)
+     {
+        for (i = 0; i < count; i++)
+          {
+             if ((!works[i]) || (!_ecore_thread_queue_remove(works[i])))
+               continue;
+             if (works[i]->func_cancel)
+               works[i]->func_cancel((void *)works[i]->data, (Ecore_Thread *)works[i]);
+             _ecore_thread_worker_free(works[i]);
+             works[i] = NULL;
+             queued--;
+          }
+     }
+   SLKU(_ecore_pending_job_threads_mutex);
+
+   if (threads)
+     memcpy(threads, works, count * sizeof(Ecore_Thread *));
+   free(works);
+
+   return queued;
+
+ on_error:
+   free(works);
+   for (i = 0; i < count; i++)
+     {
+        if (jobs[i].func_cancel)
+          jobs[i].func_cancel((void *)jobs[i].data, NULL);
+        if (threads) threads[i] = NULL;
+     }
+   return 0;
+}
+
+EAPI Eina_Bool
+ecore_thread_hint_set(Ecore_Thread *thread,
+                      Eina_Thread_Priority priority,
+                      int affinity)
+{
+   Ecore_Pthread_Worker *work = (Ecore_Pthread_Worker *)thread;
+   Ecore_Thread_Slot *slot;
+   Eina_Bool ret = EINA_FALSE;
+
+   EINA_MAIN_LOOP_CHECK_RETURN_VAL(EINA_FALSE);
+
+   if (!work) return EINA_FALSE;
+   slot = work->slot;
+   if (!slot) return EINA_FALSE;
+
+   SLKL(slot->lock);
+   /* only a job still waiting in a queue can be moved around */
+   if (work->slot == slot)
+     {
+        _ecore_thread_slot_remove(slot, work);
+        work->priority = priority;
+        work->affinity = affinity;
+        _ecore_thread_slot_push(slot, work);
+        ret = EINA_TRUE;
+     }
+   SLKU(slot->lock);
+
+   return ret;
+}
+
 EAPI Eina_Bool
 ecore_thread_cancel(Ecore_Thread *thread)
 {
    Ecore_Pthread_Worker *volatile work = (Ecore_Pthread_Worker *)thread;
-   Eina_List *l;
    int cancel;
 
    if (!work)
@@ -762,49 +1134,17 @@ ecore_thread_cancel(Ecore_Thread *thread)
           goto on_exit;
      }
 
-   SLKL(_ecore_pending_job_threads_mutex);
-
    if ((have_main_loop_thread) &&
-       (PHE(get_main_loop_thread(), PHS())))
+       (PHE(get_main_loop_thread(), PHS())) &&
+       (_ecore_thread_queue_remove(work)))
      {
-        if (!work->feedback_run)
-          EINA_LIST_FOREACH(_ecore_pending_job_threads, l, work)
-            {
-               if ((void *)work == (void *)thread)
-                 {
-                    _ecore_pending_job_threads = eina_list_remove_list(_ecore_pending_job_threads, l);
-
-                    SLKU(_ecore_pending_job_threads_mutex);
-
-                    if (work->func_cancel)
-                      work->func_cancel((void *)work->data, (Ecore_Thread *)work);
-                    free(work);
-
-                    return EINA_TRUE;
-                 }
-            }
-        else
-          EINA_LIST_FOREACH(_ecore_pending_job_threads_feedback, l, work)
-            {
-               if ((void *)work == (void *)thread)
-                 {
-                    _ecore_pending_job_threads_feedback = eina_list_remove_list(_ecore_pending_job_threads_feedback, l);
-
-                    SLKU(_ecore_pending_job_threads_mutex);
-
-                    if (work->func_cancel)
-                      work->func_cancel((void *)work->data, (Ecore_Thread *)work);
-                    free(work);
+        if (work->func_cancel)
+          work->func_cancel((void *)work->data, (Ecore_Thread *)work);
+        free(work);
 
-                    return EINA_TRUE;
-                 }
-            }
+        return EINA_TRUE;
      }
 
-   SLKU(_ecore_pending_job_threads_mutex);
-
-   work = (Ecore_Pthread_Worker *)thread;
-
    /* Delay the destruction */
 on_exit:
    eina_thread_cancel(work->self); /* noop unless eina_thread_cancellable_set() was used by user */
@@ -919,13 +1259,12 @@ ecore_thread_feedback_run(Ecore_Thread_Cb func_heavy,
 {
    Ecore_Pthread_Worker *worker;
    Eina_Bool tried = EINA_FALSE;
-   PH(thread);
 
    EINA_MAIN_LOOP_CHECK_RETURN_VAL(NULL);
 
    if (!func_heavy) return NULL;
 
-   worker = _ecore_thread_worker_new();
+   worker = _ecore_thread_slots_init() ? _ecore_thread_worker_new() : NULL;
    if (!worker) goto on_error;
 
    worker->u.feedback_run.func_heavy = func_heavy;
@@ -981,10 +1320,10 @@ retry_direct:
 
    worker->no_queue = EINA_FALSE;
 
-   SLKL(_ecore_pending_job_threads_mutex);
-   _ecore_pending_job_threads_feedback = eina_list_append(_ecore_pending_job_threads_feedback, worker);
+   _ecore_thread_queue_push(worker);
 
-   if (_ecore_thread_count == _ecore_thread_count_max)
+   SLKL(_ecore_pending_job_threads_mutex);
+   if (_ecore_thread_count >= _ecore_thread_count_max)
      {
         SLKU(_ecore_pending_job_threads_mutex);
         return (Ecore_Thread *)worker;
@@ -997,9 +1336,8 @@ retry_direct:
 
    SLKL(_ecore_pending_job_threads_mutex);
 retry:
-   if (PHC(thread, _ecore_thread_worker, NULL))
+   if (_ecore_thread_spawn())
      {
-        _ecore_thread_count++;
         SLKU(_ecore_pending_job_threads_mutex);
         return (Ecore_Thread *)worker;
      }
@@ -1015,11 +1353,9 @@ retry:
 
 on_error:
    SLKL(_ecore_pending_job_threads_mutex);
-   if (_ecore_thread_count == 0)
+   if ((_ecore_thread_count == 0) &&
+       ((!worker) || (_ecore_thread_queue_remove(worker))))
      {
-        _ecore_pending_job_threads_feedback = eina_list_remove(_ecore_pending_job_threads_feedback,
-                                                               worker);
-
         if (func_cancel) func_cancel((void *)data, NULL);
 
         if (worker)
@@ -1173,9 +1509,7 @@ ecore_thread_pending_get(void)
    int ret;
 
    EINA_MAIN_LOOP_CHECK_RETURN_VAL(0);
-   SLKL(_ecore_pending_job_threads_mutex);
-   ret = eina_list_count(_ecore_pending_job_threads);
-   SLKU(_ecore_pending_job_threads_mutex);
+   ret = _ecore_thread_counter_get(&_ecore_pending_job_threads);
    return ret;
 }
 
@@ -1185,9 +1519,7 @@ ecore_thread_pending_feedback_get(void)
    int ret;
 
    EINA_MAIN_LOOP_CHECK_RETURN_VAL(0);
-   SLKL(_ecore_pending_job_threads_mutex);
-   ret = eina_list_count(_ecore_pending_job_threads_feedback);
-   SLKU(_ecore_pending_job_threads_mutex);
+   ret = _ecore_thread_counter_get(&_ecore_pending_job_threads_feedback);
    return ret;
 }
 
@@ -1197,9 +1529,7 @@ ecore_thread_pending_total_get(void)
    int ret;
 
    EINA_MAIN_LOOP_CHECK_RETURN_VAL(0);
-   SLKL(_ecore_pending_job_threads_mutex);
-   ret = eina_list_count(_ecore_pending_job_threads) + eina_list_count(_ecore_pending_job_threads_feedback);
-   SLKU(_ecore_pending_job_threads_mutex);
+   ret = _ecore_thread_pending_count();
    return ret;
 }
 
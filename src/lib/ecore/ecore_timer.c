@@ -28,6 +28,7 @@ struct _Ecore_Timer_Legacy
 struct _Efl_Loop_Timer_Data
 {
    EINA_INLIST;
+   EINA_RBTREE;
 
    Eo            *object;
    Eo            *loop;
@@ -36,10 +37,15 @@ struct _Efl_Loop_Timer_Data
    double     in;
    double     at;
    double     pending;
+   double     queued_at; // tree key, at when inserted plus timers_shift
+
+   unsigned long long order;
+   unsigned long long generation;
 
    int        listening;
 
-   Eina_Bool  just_added  : 1;
+   Eina_Bool  queued      : 1; // in loop_data->timers
+   Eina_Bool  suspended   : 1; // in loop_data->suspended
    Eina_Bool  frozen      : 1;
    Eina_Bool  initialized : 1;
    Eina_Bool  noparent    : 1;
@@ -51,6 +57,7 @@ typedef struct _Ecore_Timer_Legacy Ecore_Timer_Legacy;
 
 static void _efl_loop_timer_util_delay(Efl_Loop_Timer_Data *timer, double add);
 static void _efl_loop_timer_util_instanciate(Efl_Loop_Data *loop, Efl_Loop_Timer_Data *timer);
+static void _efl_loop_timer_util_suspended_remove(Efl_Loop_Data *loop, Efl_Loop_Timer_Data *timer);
 static void _efl_loop_timer_set(Efl_Loop_Timer_Data *timer, double at, double in);
 
 static double precision = 10.0 / 1000000.0;
@@ -370,10 +377,7 @@ _efl_loop_timer_efl_object_event_thaw(Eo *obj, Efl_Loop_Timer_Data *timer)
    timer->frozen = 0;
 
    if (timer->loop_data)
-     {
-        timer->loop_data->suspended = eina_inlist_remove
-          (timer->loop_data->suspended, EINA_INLIST_GET(timer));
-     }
+     _efl_loop_timer_util_suspended_remove(timer->loop_data, timer);
    now = ecore_time_get();
    _efl_loop_timer_set(timer, timer->pending + now, timer->in);
 }
@@ -384,11 +388,80 @@ ecore_timer_dump(void)
    return NULL;
 }
 
+static Eina_Rbtree_Direction
+_efl_loop_timer_cmp(const Eina_Rbtree *left, const Eina_Rbtree *right,
+                    void *data EINA_UNUSED)
+{
+   const Efl_Loop_Timer_Data *t1 = EINA_RBTREE_CONTAINER_GET(left, Efl_Loop_Timer_Data);
+   const Efl_Loop_Timer_Data *t2 = EINA_RBTREE_CONTAINER_GET(right, Efl_Loop_Timer_Data);
+
+   if (t2->queued_at > t1->queued_at) return EINA_RBTREE_RIGHT;
+   if (t2->queued_at < t1->queued_at) return EINA_RBTREE_LEFT;
+   // the last timer queued goes before the ones expiring at the same time
+   return (t2->order > t1->order) ? EINA_RBTREE_LEFT : EINA_RBTREE_RIGHT;
+}
+
+static inline Eina_Bool
+_efl_loop_timer_just_added(const Efl_Loop_Data *loop, const Efl_Loop_Timer_Data *timer)
+{
+   // every timer set since the last _efl_loop_timer_enable_new()
+   return timer->generation == loop->timers_generation;
+}
+
 static void
-_efl_loop_timer_util_loop_clear(Efl_Loop_Timer_Data *pd)
+_efl_loop_timer_util_timers_remove(Efl_Loop_Data *loop, Efl_Loop_Timer_Data *timer)
 {
-   Eina_Inlist *first;
+   if (!timer->queued) return;
+   loop->timers = eina_inlist_remove(loop->timers, EINA_INLIST_GET(timer));
+   loop->timers_tree = eina_rbtree_inline_remove(loop->timers_tree,
+                                                 EINA_RBTREE_GET(timer),
+                                                 _efl_loop_timer_cmp, NULL);
+   timer->queued = EINA_FALSE;
+}
+
+static void
+_efl_loop_timer_util_timers_insert(Efl_Loop_Data *loop, Efl_Loop_Timer_Data *timer)
+{
+   Efl_Loop_Timer_Data *prev = NULL;
+   Eina_Rbtree *node;
+
+   timer->queued_at = timer->at + loop->timers_shift;
+   timer->order = ++loop->timers_order;
 
+   // The list stays sorted for the walk in _efl_loop_timer_expired_call(),
+   // the tree gives the timer just before us without walking the list
+   for (node = loop->timers_tree; node; )
+     {
+        Eina_Rbtree_Direction dir = _efl_loop_timer_cmp(node, EINA_RBTREE_GET(timer), NULL);
+
+        if (dir == EINA_RBTREE_RIGHT)
+          prev = EINA_RBTREE_CONTAINER_GET(node, Efl_Loop_Timer_Data);
+        node = node->son[dir];
+     }
+
+   loop->timers_tree = eina_rbtree_inline_insert(loop->timers_tree,
+                                                 EINA_RBTREE_GET(timer),
+                                                 _efl_loop_timer_cmp, NULL);
+   if (prev)
+     loop->timers = eina_inlist_append_relative(loop->timers,
+                                                EINA_INLIST_GET(timer),
+                                                EINA_INLIST_GET(prev));
+   else
+     loop->timers = eina_inlist_prepend(loop->timers, EINA_INLIST_GET(timer));
+   timer->queued = EINA_TRUE;
+}
+
+static void
+_efl_loop_timer_util_suspended_remove(Efl_Loop_Data *loop, Efl_Loop_Timer_Data *timer)
+{
+   if (!timer->suspended) return;
+   loop->suspended = eina_inlist_remove(loop->suspended, EINA_INLIST_GET(timer));
+   timer->suspended = EINA_FALSE;
+}
+
+static void
+_efl_loop_timer_util_loop_clear(Efl_Loop_Timer_Data *pd)
+{
    if (!pd->loop_data) return;
    // Check if we are the current timer, if so move along
    if (pd->loop_data->timer_current == pd)
@@ -396,20 +469,13 @@ _efl_loop_timer_util_loop_clear(Efl_Loop_Timer_Data *pd)
        EINA_INLIST_GET(pd)->next;
 
    // Remove the timer from all possible pending list
-   first = eina_inlist_first(EINA_INLIST_GET(pd));
-   if (first == pd->loop_data->timers)
-     pd->loop_data->timers = eina_inlist_remove
-       (pd->loop_data->timers, EINA_INLIST_GET(pd));
-   else if (first == pd->loop_data->suspended)
-     pd->loop_data->suspended = eina_inlist_remove
-       (pd->loop_data->suspended, EINA_INLIST_GET(pd));
+   _efl_loop_timer_util_timers_remove(pd->loop_data, pd);
+   _efl_loop_timer_util_suspended_remove(pd->loop_data, pd);
 }
 
 static void
 _efl_loop_timer_util_instanciate(Efl_Loop_Data *loop, Efl_Loop_Timer_Data *timer)
 {
-   Efl_Loop_Timer_Data *t2;
-
    if (!loop) return;
    _efl_loop_timer_util_loop_clear(timer);
 
@@ -419,6 +485,7 @@ _efl_loop_timer_util_instanciate(Efl_Loop_Data *loop, Efl_Loop_Timer_Data *timer
      {
         loop->suspended = eina_inlist_prepend(loop->suspended,
                                               EINA_INLIST_GET(timer));
+        timer->suspended = EINA_TRUE;
         return;
      }
 
@@ -428,17 +495,7 @@ _efl_loop_timer_util_instanciate(Efl_Loop_Data *loop, Efl_Loop_Timer_Data *timer
         return;
      }
 
-   EINA_INLIST_REVERSE_FOREACH(loop->timers, t2)
-     {
-        if (timer->at > t2->at)
-          {
-             loop->timers = eina_inlist_append_relative(loop->timers,
-                                                        EINA_INLIST_GET(timer),
-                                                        EINA_INLIST_GET(t2));
-             return;
-          }
-     }
-   loop->timers = eina_inlist_prepend(loop->timers, EINA_INLIST_GET(timer));
+   _efl_loop_timer_util_timers_insert(loop, timer);
 }
 
 static void
@@ -460,20 +517,13 @@ _efl_loop_timer_util_delay(Efl_Loop_Timer_Data *timer, double add)
 EOLIAN static void
 _efl_loop_timer_efl_object_parent_set(Eo *obj, Efl_Loop_Timer_Data *pd, Efl_Object *parent)
 {
-   Eina_Inlist *first;
-
    efl_parent_set(efl_super(obj, EFL_LOOP_TIMER_CLASS), parent);
 
    if ((!pd->constructed) || (!pd->finalized)) return;
 
    // Remove the timer from all possible pending list
-   first = eina_inlist_first(EINA_INLIST_GET(pd));
-   if (first == pd->loop_data->timers)
-     pd->loop_data->timers = eina_inlist_remove
-       (pd->loop_data->timers, EINA_INLIST_GET(pd));
-   else if (first == pd->loop_data->suspended)
-     pd->loop_data->suspended = eina_inlist_remove
-       (pd->loop_data->suspended, EINA_INLIST_GET(pd));
+   _efl_loop_timer_util_timers_remove(pd->loop_data, pd);
+   _efl_loop_timer_util_suspended_remove(pd->loop_data, pd);
 
    if (efl_invalidated_get(obj)) return;
 
@@ -501,11 +551,10 @@ _efl_loop_timer_efl_object_destructor(Eo *obj, Efl_Loop_Timer_Data *pd)
 void
 _efl_loop_timer_enable_new(Eo *obj EINA_UNUSED, Efl_Loop_Data *pd)
 {
-   Efl_Loop_Timer_Data *timer;
-
    if (!pd->timers_added) return;
    pd->timers_added = 0;
-   EINA_INLIST_FOREACH(pd->timers, timer) timer->just_added = 0;
+   // no need to walk the timers, they just belong to an older generation now
+   pd->timers_generation++;
 }
 
 int
@@ -521,13 +570,13 @@ _efl_loop_timer_first_get(Eo *ob EINA_UNUSED, Efl_Loop_Data *pd)
 
    EINA_INLIST_FOREACH(pd->timers, timer)
      {
-        if (!timer->just_added) return timer->object;
+        if (!_efl_loop_timer_just_added(pd, timer)) return timer->object;
      }
    return NULL;
 }
 
 static inline Efl_Loop_Timer_Data *
-_efl_loop_timer_after_get(Efl_Loop_Timer_Data *base)
+_efl_loop_timer_after_get(Efl_Loop_Data *pd, Efl_Loop_Timer_Data *base)
 {
    Efl_Loop_Timer_Data *timer;
    Efl_Loop_Timer_Data *valid_timer = base;
@@ -537,7 +586,7 @@ _efl_loop_timer_after_get(Efl_Loop_Timer_Data *base)
      {
         if (EINA_UNLIKELY(!timer->initialized)) continue; // This shouldn't happen
         if (timer->at >= maxtime) break;
-        if (!timer->just_added) valid_timer = timer;
+        if (!_efl_loop_timer_just_added(pd, timer)) valid_timer = timer;
      }
    return valid_timer;
 }
@@ -553,7 +602,7 @@ _efl_loop_timer_next_get(Eo *obj, Efl_Loop_Data *pd)
    object = _efl_loop_timer_first_get(obj, pd);
    if (!object) return -1;
 
-   first = _efl_loop_timer_after_get(efl_data_scope_get(object, MY_CLASS));
+   first = _efl_loop_timer_after_get(pd, efl_data_scope_get(object, MY_CLASS));
    now = efl_loop_time_get(obj);
    in = first->at - now;
    if (in < 0) in = 0;
@@ -565,13 +614,8 @@ _efl_loop_timer_reschedule(Efl_Loop_Timer_Data *timer, double when)
 {
    if (timer->frozen || efl_invalidated_get(timer->object)) return;
 
-   if (timer->loop_data &&
-       (EINA_INLIST_GET(timer)->next || EINA_INLIST_GET(timer)->prev))
-     {
-        if (timer->loop_data->timers && (!timer->noparent))
-          timer->loop_data->timers = eina_inlist_remove
-            (timer->loop_data->timers, EINA_INLIST_GET(timer));
-     }
+   if (timer->loop_data && (!timer->noparent))
+     _efl_loop_timer_util_timers_remove(timer->loop_data, timer);
 
    /* if the timer would have gone off more than 15 seconds ago,
     * assume that the system hung and set the timer to go off
@@ -605,6 +649,8 @@ _efl_loop_timer_expired_call(Eo *obj EINA_UNUSED, Efl_Loop_Data *pd, double when
         // User set time backwards
         EINA_INLIST_FOREACH(pd->timers, timer)
           timer->at -= (pd->last_check - when);
+        // the tree keys can not change, shift the new ones instead
+        pd->timers_shift += (pd->last_check - when);
      }
    pd->last_check = when;
 
@@ -630,7 +676,7 @@ _efl_loop_timer_expired_call(Eo *obj EINA_UNUSED, Efl_Loop_Data *pd, double when
              return 0;
           }
 
-        if (timer->just_added)
+        if (_efl_loop_timer_just_added(pd, timer))
           {
              pd->timer_current = (Efl_Loop_Timer_Data *)
                EINA_INLIST_GET(pd->timer_current)->next;
@@ -658,8 +704,8 @@ _efl_loop_timer_set(Efl_Loop_Timer_Data *timer, double at, double in)
 {
    if (!timer->loop_data) return;
    timer->loop_data->timers_added = 1;
+   timer->generation = timer->loop_data->timers_generation;
    timer->in = in;
-   timer->just_added = 1;
    timer->initialized = 1;
    if (!timer->frozen)
      {
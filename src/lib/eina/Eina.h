@@ -261,6 +261,7 @@ extern "C" {
 #include <eina_value_util.h>
 #include <eina_cow.h>
 #include <eina_thread_queue.h>
+#include <eina_parallel.h>
 #include <eina_matrix.h>
 #include <eina_vector.h>
 #include <eina_crc.h>
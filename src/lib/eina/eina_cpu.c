@@ -79,15 +79,28 @@ static inline void _x86_cpuid(int op, int *a, int *b, int *c, int *d)
       "popl %%ebx       \n\t" /* restore the old %ebx */
 #endif
       : "=a" (*a), "=r" (*b), "=c" (*c), "=d" (*d)
-      : "a" (op)
+      : "a" (op), "c" (0)
       : "cc");
 }
 
+static inline unsigned int _x86_xgetbv(void)
+{
+   unsigned int a, d;
+
+   __asm__ volatile (
+      ".byte 0x0f, 0x01, 0xd0 \n\t" /* xgetbv */
+      : "=a" (a), "=d" (d)
+      : "c" (0));
+   return a;
+}
+
 static
 void _x86_simd(Eina_Cpu_Features *features)
 {
    int a, b, c, d;
+   int max;
 
+   _x86_cpuid(0, &max, &b, &c, &d);
    _x86_cpuid(1, &a, &b, &c, &d);
    /*
     * edx
@@ -102,6 +115,8 @@ void _x86_simd(Eina_Cpu_Features *features)
     * 9 = SSSE3
     * 19 = SSE4.1
     * 20 = SSE4.2
+    * 27 = OSXSAVE
+    * 28 = AVX
     */
    if ((d >> 23) & 1)
       *features |= EINA_CPU_MMX;
@@ -123,6 +138,18 @@ void _x86_simd(Eina_Cpu_Features *features)
 
    if ((c >> 20) & 1)
       *features |= EINA_CPU_SSE42;
+
+   /*
+    * AVX2 is leaf 7 ebx bit 5, but it is only usable when the kernel
+    * saves the YMM registers (XCR0 bits 1 and 2).
+    */
+   if ((max >= 7) && ((c >> 27) & 1) && ((c >> 28) & 1) &&
+       ((_x86_xgetbv() & 0x6) == 0x6))
+     {
+        _x86_cpuid(7, &a, &b, &c, &d);
+        if ((b >> 5) & 1)
+           *features |= EINA_CPU_AVX2;
+     }
 }
 #endif
 
@@ -37,6 +37,7 @@
 # include <mach/mach_time.h>
 #endif
 
+#include <stdio.h>
 #include <time.h>
 #include <unistd.h>
 
@@ -72,6 +73,50 @@ static double _eina_evlog_time_clock_conversion = 1e-9;
 
 static int _evlog_get_opcode = EINA_DEBUG_OPCODE_INVALID;
 
+// file mode: every thread logs in its own ring and a thread writes them to
+// a Chrome trace event file from time to time
+# define EVLOG_RING_SIZE (1024 * 1024)
+# define EVLOG_RING_MASK (EVLOG_RING_SIZE - 1)
+# define EVLOG_RECORD_HEAD 8
+# define EVLOG_FLUSH_INTERVAL 0.1
+
+#ifdef __ATOMIC_RELAXED
+# define RING_POS_GET(p) __atomic_load_n(&(p), __ATOMIC_ACQUIRE)
+# define RING_POS_SET(p, v) __atomic_store_n(&(p), (v), __ATOMIC_RELEASE)
+#else
+# define RING_POS_GET(p) (__sync_synchronize(), *(volatile unsigned int *)&(p))
+# define RING_POS_SET(p, v) do { __sync_synchronize(); *(volatile unsigned int *)&(p) = (v); } while (0)
+#endif
+
+typedef struct _Evlog_Ring Evlog_Ring;
+struct _Evlog_Ring
+{
+   Evlog_Ring *next;
+   unsigned char *buf;
+   unsigned int head; // only moved by the thread owning the ring
+   unsigned int tail; // only moved by the file thread
+   unsigned int id;
+   Eina_Bool main_loop : 1;
+   Eina_Bool named : 1;
+   Eina_Bool dead;
+};
+
+static FILE           *_evlog_file = NULL;
+static Eina_TLS        _evlog_ring_key;
+static Eina_Lock       _evlog_rings_lock;
+static Evlog_Ring     *_evlog_rings = NULL;
+static unsigned int    _evlog_rings_id = 0;
+static unsigned int    _evlog_main_ring_id = 0; // where the samples go
+static Eina_Thread     _evlog_file_thread;
+static Eina_Lock       _evlog_file_lock;
+static Eina_Condition  _evlog_file_cond;
+static Eina_Bool       _evlog_file_exit = EINA_FALSE;
+static double          _evlog_file_t0 = 0.0;
+static int             _evlog_file_pid = 0;
+static unsigned int    _evlog_sample_usec = 0;
+static Eina_Evlog_Sample_Cb _evlog_sample_cb = NULL;
+static const void     *_evlog_sample_data = NULL;
+
 static inline double
 get_time(void)
 {
@@ -152,6 +197,341 @@ push_buf(Eina_Evlog_Buf *b, unsigned int size)
    return ptr;
 }
 
+static void
+_evlog_ring_release(void *data)
+{
+   Evlog_Ring *r = data;
+
+   // the file thread frees it once it has written what is left
+   eina_lock_take(&_evlog_rings_lock);
+   r->dead = EINA_TRUE;
+   eina_lock_release(&_evlog_rings_lock);
+}
+
+static Evlog_Ring *
+_evlog_ring_get(void)
+{
+   Evlog_Ring *r;
+
+   r = eina_tls_get(_evlog_ring_key);
+   if (EINA_LIKELY(r != NULL)) return r;
+
+   r = calloc(1, sizeof(Evlog_Ring));
+   if (!r) return NULL;
+   r->buf = malloc(EVLOG_RING_SIZE);
+   if (!r->buf)
+     {
+        free(r);
+        return NULL;
+     }
+   r->main_loop = eina_main_loop_is();
+
+   eina_lock_take(&_evlog_rings_lock);
+   r->id = ++_evlog_rings_id;
+   if (r->main_loop) _evlog_main_ring_id = r->id;
+   r->next = _evlog_rings;
+   _evlog_rings = r;
+   eina_lock_release(&_evlog_rings_lock);
+
+   eina_tls_set(_evlog_ring_key, r);
+   return r;
+}
+
+static void
+_evlog_ring_push(const char *event, void *obj, double now, double srctime, const char *detail)
+{
+   Evlog_Ring *r = _evlog_ring_get();
+   Eina_Evlog_Item *item;
+   unsigned char *rec;
+   unsigned int size, head, tail, off, pad = 0;
+   unsigned short detail_offset = 0, event_size;
+
+   if (!r) return;
+
+   event_size = strlen(event) + 1;
+   size = sizeof(Eina_Evlog_Item) + event_size;
+   if (detail)
+     {
+        detail_offset = size;
+        size += strlen(detail) + 1;
+     }
+   size = EVLOG_RECORD_HEAD + sizeof(double) * ((size + sizeof(double) - 1)
+                                                / sizeof(double));
+   if (size > (EVLOG_RING_SIZE / 4)) return;
+
+   // records never wrap, the end of the ring is skipped instead
+   head = r->head;
+   tail = RING_POS_GET(r->tail);
+   off = head & EVLOG_RING_MASK;
+   if ((off + size) > EVLOG_RING_SIZE) pad = EVLOG_RING_SIZE - off;
+   // full, the file thread is late: drop the event rather than block
+   if (((head - tail) + pad + size) > EVLOG_RING_SIZE) return;
+   if (pad)
+     {
+        *(unsigned int *)(r->buf + off) = 0;
+        head += pad;
+        off = 0;
+     }
+
+   rec = r->buf + off;
+   *(unsigned int *)rec = size;
+   item = (Eina_Evlog_Item *)(rec + EVLOG_RECORD_HEAD);
+   item->tim           = now;
+   item->srctim        = srctime;
+   item->thread        = (unsigned long long)(uintptr_t)pthread_self();
+   item->obj           = (unsigned long long)(uintptr_t)obj;
+   item->event_offset  = sizeof(Eina_Evlog_Item);
+   item->detail_offset = detail_offset;
+   item->event_next    = size - EVLOG_RECORD_HEAD;
+   strcpy((char *)item + sizeof(Eina_Evlog_Item), event);
+   if (detail_offset > 0) strcpy((char *)item + detail_offset, detail);
+
+   RING_POS_SET(r->head, head + size);
+}
+
+static void
+_evlog_json_string(FILE *f, const char *str)
+{
+   const unsigned char *p;
+
+   fputc('"', f);
+   for (p = (const unsigned char *)str; *p; p++)
+     {
+        if ((*p == '"') || (*p == '\\')) fprintf(f, "\\%c", *p);
+        else if (*p < 0x20) fprintf(f, "\\u%04x", *p);
+        else fputc(*p, f);
+     }
+   fputc('"', f);
+}
+
+// microseconds since the file was opened, printed from integers so that the
+// locale decimal separator can't break the json
+static void
+_evlog_json_ts(FILE *f, double tim)
+{
+   unsigned long long ns = 0;
+
+   if (tim > _evlog_file_t0)
+     ns = (unsigned long long)(((tim - _evlog_file_t0) * 1000000000.0) + 0.5);
+   fprintf(f, ",\"ts\":%llu.%03u", ns / 1000, (unsigned int)(ns % 1000));
+}
+
+static void
+_evlog_json_item(FILE *f, Evlog_Ring *r, const Eina_Evlog_Item *item)
+{
+   const char *event = (const char *)item + item->event_offset;
+   const char *detail = NULL;
+   const char *ph;
+
+   if (item->detail_offset) detail = (const char *)item + item->detail_offset;
+
+   switch (event[0])
+     {
+      case '+': ph = "B"; break;
+      case '-': ph = "E"; break;
+      case '!': ph = "i"; break;
+      case '>': ph = "b"; break;
+      case '<': ph = "e"; break;
+      case '*':
+         // the only metadata we know how to show. the file thread records
+         // the samples but they tell what the main loop is doing
+         if (strcmp(event, "*sample") || !detail) return;
+         fputs(",\n{\"ph\":\"X\",\"cat\":\"sample\",\"name\":", f);
+         _evlog_json_string(f, detail);
+         fprintf(f, ",\"pid\":%i,\"tid\":%u", _evlog_file_pid,
+                 _evlog_main_ring_id ? _evlog_main_ring_id : r->id);
+         _evlog_json_ts(f, item->tim);
+         fprintf(f, ",\"dur\":%u}", _evlog_sample_usec);
+         return;
+      default: return;
+     }
+
+   fprintf(f, ",\n{\"ph\":\"%s\",\"name\":", ph);
+   _evlog_json_string(f, event + 1);
+   fprintf(f, ",\"pid\":%i,\"tid\":%u", _evlog_file_pid, r->id);
+   _evlog_json_ts(f, item->tim);
+   // states do not nest, they are async events keyed on the object
+   if ((event[0] == '>') || (event[0] == '<'))
+     fprintf(f, ",\"cat\":\"state\",\"id\":\"0x%llx\"", item->obj);
+   else if (event[0] == '!')
+     fputs(",\"s\":\"t\"", f);
+   if (detail)
+     {
+        fputs(",\"args\":{\"detail\":", f);
+        _evlog_json_string(f, detail);
+        fputc('}', f);
+     }
+   fputc('}', f);
+}
+
+static void
+_evlog_ring_flush(FILE *f, Evlog_Ring *r)
+{
+   unsigned int head, tail, off, size;
+
+   if (!r->named)
+     {
+        fprintf(f, ",\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":%i,"
+                "\"tid\":%u,\"args\":{\"name\":\"%s %u\"}}",
+                _evlog_file_pid, r->id,
+                r->main_loop ? "main loop" : "thread", r->id);
+        r->named = EINA_TRUE;
+     }
+
+   head = RING_POS_GET(r->head);
+   tail = r->tail;
+   while (tail != head)
+     {
+        off = tail & EVLOG_RING_MASK;
+        size = *(unsigned int *)(r->buf + off);
+        // padding up to the end of the ring
+        if (!size)
+          {
+             tail += EVLOG_RING_SIZE - off;
+             continue;
+          }
+        _evlog_json_item(f, r, (Eina_Evlog_Item *)(r->buf + off + EVLOG_RECORD_HEAD));
+        tail += size;
+     }
+   RING_POS_SET(r->tail, tail);
+}
+
+static void
+_evlog_file_flush(void)
+{
+   Evlog_Ring *r, *next, *prev = NULL;
+
+   eina_lock_take(&_evlog_rings_lock);
+   for (r = _evlog_rings; r; r = next)
+     {
+        next = r->next;
+        _evlog_ring_flush(_evlog_file, r);
+        if (r->dead)
+          {
+             if (prev) prev->next = next;
+             else _evlog_rings = next;
+             free(r->buf);
+             free(r);
+             continue;
+          }
+        prev = r;
+     }
+   eina_lock_release(&_evlog_rings_lock);
+   fflush(_evlog_file);
+}
+
+static void *
+_evlog_file_thread_cb(void *data EINA_UNUSED, Eina_Thread t EINA_UNUSED)
+{
+   double next_flush, wait, now;
+   const char *op;
+
+   eina_thread_name_set(eina_thread_self(), "Eevlog");
+
+   wait = EVLOG_FLUSH_INTERVAL;
+   if (_evlog_sample_usec) wait = _evlog_sample_usec / 1000000.0;
+   next_flush = get_time() + EVLOG_FLUSH_INTERVAL;
+
+   eina_lock_take(&_evlog_file_lock);
+   while (!_evlog_file_exit)
+     {
+        eina_condition_timedwait(&_evlog_file_cond, wait);
+        if (_evlog_file_exit) break;
+
+        if (_evlog_sample_cb)
+          {
+             op = _evlog_sample_cb((void *)_evlog_sample_data);
+             if (op) eina_evlog("*sample", NULL, 0.0, op);
+          }
+
+        now = get_time();
+        if (now < next_flush) continue;
+        next_flush = now + EVLOG_FLUSH_INTERVAL;
+        eina_lock_release(&_evlog_file_lock);
+        _evlog_file_flush();
+        eina_lock_take(&_evlog_file_lock);
+     }
+   eina_lock_release(&_evlog_file_lock);
+
+   return NULL;
+}
+
+static void
+_evlog_file_open(const char *path)
+{
+   const char *s;
+
+   _evlog_file = fopen(path, "w");
+   if (!_evlog_file)
+     {
+        EINA_LOG_ERR("EINA_EVLOG_FILE: cannot open '%s'", path);
+        return;
+     }
+   // the json array format allows the first dummy entry and a missing
+   // closing bracket if we are killed
+   _evlog_file_t0 = get_time();
+   _evlog_file_pid = (int)getpid();
+   fprintf(_evlog_file, "[\n{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":%i,"
+           "\"args\":{\"name\":\"efl\"}}", _evlog_file_pid);
+
+   s = getenv("EINA_EVLOG_SAMPLE");
+   if (s && (atoi(s) > 0)) _evlog_sample_usec = atoi(s);
+
+   eina_tls_cb_new(&_evlog_ring_key, _evlog_ring_release);
+   eina_lock_new(&_evlog_rings_lock);
+   eina_lock_new(&_evlog_file_lock);
+   eina_condition_new(&_evlog_file_cond, &_evlog_file_lock);
+   _evlog_file_exit = EINA_FALSE;
+   if (!eina_thread_create(&_evlog_file_thread, EINA_THREAD_BACKGROUND, -1,
+                           _evlog_file_thread_cb, NULL))
+     {
+        EINA_LOG_ERR("EINA_EVLOG_FILE: cannot start the writer thread");
+        eina_condition_free(&_evlog_file_cond);
+        eina_lock_free(&_evlog_file_lock);
+        eina_lock_free(&_evlog_rings_lock);
+        eina_tls_free(_evlog_ring_key);
+        fclose(_evlog_file);
+        _evlog_file = NULL;
+        return;
+     }
+   eina_evlog_start();
+   // eina_init() runs in the main loop, its ring is the one of the samples
+   _evlog_ring_get();
+}
+
+static void
+_evlog_file_close(void)
+{
+   if (!_evlog_file) return;
+
+   eina_lock_take(&_evlog_file_lock);
+   _evlog_file_exit = EINA_TRUE;
+   eina_condition_signal(&_evlog_file_cond);
+   eina_lock_release(&_evlog_file_lock);
+   eina_thread_join(_evlog_file_thread);
+
+   eina_evlog_stop();
+   _evlog_file_flush();
+   fputs("\n]\n", _evlog_file);
+   fclose(_evlog_file);
+   _evlog_file = NULL;
+   // rings of threads still alive are not freed, they may still log
+   eina_condition_free(&_evlog_file_cond);
+   eina_lock_free(&_evlog_file_lock);
+}
+
+EAPI Eina_Bool
+eina_evlog_sample_cb_set(Eina_Evlog_Sample_Cb cb, const void *data)
+{
+   if (!_evlog_file || !_evlog_sample_usec) return EINA_FALSE;
+
+   eina_lock_take(&_evlog_file_lock);
+   _evlog_sample_cb = cb;
+   _evlog_sample_data = data;
+   eina_lock_release(&_evlog_file_lock);
+   return EINA_TRUE;
+}
+
 EAPI void
 eina_evlog(const char *event, void *obj, double srctime, const char *detail)
 {
@@ -163,6 +543,11 @@ eina_evlog(const char *event, void *obj, double srctime, const char *detail)
 
    if (!_evlog_go) return;
    now                 = get_time();
+   if (_evlog_file)
+     {
+        _evlog_ring_push(event, obj, now, srctime, detail);
+        return;
+     }
    event_size          = strlen(event) + 1;
    size                = sizeof(Eina_Evlog_Item) + event_size;
    detail_offset       = 0;
@@ -288,6 +673,8 @@ EINA_DEBUG_OPCODES_ARRAY_DEFINE(_EINA_DEBUG_EVLOG_OPS,
 Eina_Bool
 eina_evlog_init(void)
 {
+   const char *s;
+
    eina_spinlock_new(&_evlog_lock);
    buf = &(buffers[0]);
 #if defined (HAVE_CLOCK_GETTIME) || defined (EXOTIC_PROVIDE_CLOCK_GETTIME)
@@ -300,6 +687,8 @@ eina_evlog_init(void)
           _eina_evlog_time_clock_id = CLOCK_REALTIME;
      }
 #endif
+   s = getenv("EINA_EVLOG_FILE");
+   if (s && s[0]) _evlog_file_open(s);
    eina_evlog("+eina_init", NULL, 0.0, NULL);
    eina_debug_opcodes_register(NULL, _EINA_DEBUG_EVLOG_OPS(), NULL, NULL);
    return EINA_TRUE;
@@ -308,6 +697,7 @@ eina_evlog_init(void)
 Eina_Bool
 eina_evlog_shutdown(void)
 {
+   _evlog_file_close();
    // yes - we don't free tyhe evlog buffers. they may be in used by debug th
    eina_spinlock_free(&_evlog_lock);
    return EINA_TRUE;
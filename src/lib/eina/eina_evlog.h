@@ -28,6 +28,14 @@
  * outside of EFL itself at this stage. The format of debug logs may and
  * likely will change as this feature matures.
  *
+ * Setting the environment variable @c EINA_EVLOG_FILE to a path starts
+ * logging at eina_init() and writes the events to this file in the Chrome
+ * trace event format, that chrome://tracing and Perfetto can open, without
+ * needing efl_debugd. Each thread logs in its own buffer and a background
+ * thread writes them out every 100ms. When @c EINA_EVLOG_SAMPLE is set to
+ * an interval in microseconds, this thread also records what the main loop
+ * is doing at that rate, see eina_evlog_sample_cb_set().
+ *
  * @{
  *
  * @since 1.15
@@ -148,6 +156,30 @@ eina_evlog_start(void);
 EAPI void
 eina_evlog_stop(void);
 
+/**
+ * @typedef Eina_Evlog_Sample_Cb
+ * @brief Returns what the main loop is doing, or @c NULL.
+ *
+ * It is called from the sampling thread, the returned string must stay
+ * valid after the main loop moved on (e.g. a string literal).
+ *
+ * @since 1.22
+ */
+typedef const char *(*Eina_Evlog_Sample_Cb)(void *data);
+
+/**
+ * @brief Sets the callback giving the samples of the sampling profiler.
+ *
+ * @param[in] cb The callback, or @c NULL to stop sampling
+ * @param[in] data The data given to @p cb
+ * @return #EINA_TRUE if the sampling profiler is running and will call
+ *         @p cb, #EINA_FALSE otherwise
+ *
+ * @since 1.22
+ */
+EAPI Eina_Bool
+eina_evlog_sample_cb_set(Eina_Evlog_Sample_Cb cb, const void *data);
+
 /**
  * @}
  */
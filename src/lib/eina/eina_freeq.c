@@ -353,14 +353,50 @@ eina_freeq_ptr_pending(Eina_FreeQ *fq)
    return pending;
 }
 
+// with the queue lock held, EINA_FALSE if there is no room for ptr
+static Eina_Bool
+_eina_freeq_ptr_queue_nolock(Eina_FreeQ *fq,
+                             void *ptr,
+                             void (*free_func) (void *ptr),
+                             size_t size)
+{
+   Eina_FreeQ_Block *fb;
+
+   if ((!fq->block_last) || (fq->block_last->end == ITEM_BLOCK_COUNT))
+     {
+        if (!_eina_freeq_block_append(fq)) return EINA_FALSE;
+     }
+
+   fb = fq->block_last;
+   fb->items[fb->end].ptr = ptr;
+   fb->items[fb->end].free_func = free_func;
+   fb->items[fb->end].size = size;
+   fb->end++;
+   fq->count++;
+   fq->mem_total += size;
+   return EINA_TRUE;
+}
+
+// without the lock, free_func may use the queue
+static void
+_eina_freeq_ptr_queue_failed(Eina_FreeQ *fq,
+                             void *ptr,
+                             void (*free_func) (void *ptr),
+                             size_t size)
+{
+   if (!fq->postponed)
+     _eina_freeq_free_do(ptr, free_func, size);
+   else
+     EINA_LOG_ERR("Could not add a pointer to the free queue! This "
+                  "program will leak resources!");
+}
+
 EAPI void
 eina_freeq_ptr_add(Eina_FreeQ *fq,
                    void *ptr,
                    void (*free_func) (void *ptr),
                    size_t size)
 {
-   Eina_FreeQ_Block *fb;
-
    if (!ptr) return;
    if (!free_func) free_func = free;
    if ((((fq) && !fq->postponed) || (!fq)) &&
@@ -374,27 +410,53 @@ eina_freeq_ptr_add(Eina_FreeQ *fq,
      }
 
    LOCK_FQ(fq);
-   if ((!fq->block_last) || (fq->block_last->end == ITEM_BLOCK_COUNT))
+   if (!_eina_freeq_ptr_queue_nolock(fq, ptr, free_func, size))
      {
-        if (!_eina_freeq_block_append(fq))
-          {
-             UNLOCK_FQ(fq);
-             if (!fq->postponed)
-               _eina_freeq_free_do(ptr, free_func, size);
-             else
-               EINA_LOG_ERR("Could not add a pointer to the free queue! This "
-                            "program will leak resources!");
-             return;
-          }
+        UNLOCK_FQ(fq);
+        _eina_freeq_ptr_queue_failed(fq, ptr, free_func, size);
+        return;
      }
+   _eina_freeq_flush_nolock(fq);
+   UNLOCK_FQ(fq);
+}
 
-   fb = fq->block_last;
-   fb->items[fb->end].ptr = ptr;
-   fb->items[fb->end].free_func = free_func;
-   fb->items[fb->end].size = size;
-   fb->end++;
-   fq->count++;
-   fq->mem_total += size;
+EAPI void
+eina_freeq_ptrs_add(Eina_FreeQ *fq,
+                    void **ptrs,
+                    unsigned int count,
+                    void (*free_func) (void *ptr),
+                    size_t size)
+{
+   unsigned int i;
+
+   if (!ptrs || !count) return;
+   if (!free_func) free_func = free;
+   if ((((fq) && !fq->postponed) || (!fq)) &&
+       (size < _eina_freeq_fillpat_max) && (size > 0))
+     {
+        for (i = 0; i < count; i++)
+          if (ptrs[i]) _eina_freeq_fill_do(ptrs[i], size);
+     }
+
+   if (!fq || fq->bypass)
+     {
+        for (i = 0; i < count; i++)
+          if (ptrs[i]) _eina_freeq_free_do(ptrs[i], free_func, size);
+        return;
+     }
+
+   // same as eina_freeq_ptr_add() but the lock is taken and the queue
+   // flushed once for the whole array
+   LOCK_FQ(fq);
+   for (i = 0; i < count; i++)
+     {
+        if (!ptrs[i]) continue;
+        if (_eina_freeq_ptr_queue_nolock(fq, ptrs[i], free_func, size))
+          continue;
+        UNLOCK_FQ(fq);
+        _eina_freeq_ptr_queue_failed(fq, ptrs[i], free_func, size);
+        LOCK_FQ(fq);
+     }
    _eina_freeq_flush_nolock(fq);
    UNLOCK_FQ(fq);
 }
@@ -309,6 +309,24 @@ eina_freeq_ptr_pending(Eina_FreeQ *fq);
 EAPI void
 eina_freeq_ptr_add(Eina_FreeQ *fq, void *ptr, void (*free_func) (void *ptr), size_t size);
 
+/**
+ * @brief Add an array of pointers to a free queue
+ *
+ * @param[in,out] fq The free queue to add the pointers to
+ * @param[in] ptrs The pointers to free, @c NULL ones are skipped
+ * @param[in] count The number of pointers in @p ptrs
+ * @param[in] free_func The function used to free each pointer with
+ * @param[in] size The size of the data each pointer points to
+ *
+ * This is the same as calling eina_freeq_ptr_add() on each pointer of the
+ * array, with the same @p free_func and @p size, but the queue is locked
+ * and flushed only once. The @p ptrs array itself is not kept.
+ *
+ * @since 1.22
+ */
+EAPI void
+eina_freeq_ptrs_add(Eina_FreeQ *fq, void **ptrs, unsigned int count, void (*free_func) (void *ptr), size_t size);
+
 /**
  * @brief Add a pointer to the main free queue
  *
@@ -327,6 +345,25 @@ eina_freeq_ptr_main_add(void *ptr, void (*free_func) (void *ptr), size_t size)
    eina_freeq_ptr_add(eina_freeq_main_get(), ptr, free_func, size);
 }
 
+/**
+ * @brief Add an array of pointers to the main free queue
+ *
+ * @param[in] ptrs The pointers to free, @c NULL ones are skipped
+ * @param[in] count The number of pointers in @p ptrs
+ * @param[in] free_func The function used to free each pointer with
+ * @param[in] size The size of the data each pointer points to
+ *
+ * This is the same as eina_freeq_ptrs_add() but the main free queue is
+ * fetched by eina_freeq_main_get().
+ *
+ * @since 1.22
+ */
+static inline void
+eina_freeq_ptrs_main_add(void **ptrs, unsigned int count, void (*free_func) (void *ptr), size_t size)
+{
+   eina_freeq_ptrs_add(eina_freeq_main_get(), ptrs, count, free_func, size);
+}
+
 /**
  * @brief Convenience macro for well known structures and types
  *
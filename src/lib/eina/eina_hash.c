@@ -24,8 +24,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <stddef.h>
 #include <string.h>
 
+#ifdef __SSE2__
+# include <emmintrin.h>
+#endif
+
 #include "eina_config.h"
 #include "eina_private.h"
 #include "eina_rbtree.h"
@@ -63,7 +68,19 @@
 
 #define EINA_HASH_RBTREE_MASK       0xFFFF
 
+/* Control bytes of the flat (open addressing) backend. A full slot stores
+ * the 7 low bits of its hash, special states all have the high bit set. */
+#define EINA_HASH_FLAT_EMPTY        ((signed char)-128)
+#define EINA_HASH_FLAT_DELETED      ((signed char)-2)
+
+#ifdef __SSE2__
+# define EINA_HASH_FLAT_GROUP_WIDTH 16
+#else
+# define EINA_HASH_FLAT_GROUP_WIDTH 8
+#endif
+
 typedef struct _Eina_Hash_Head         Eina_Hash_Head;
+typedef struct _Eina_Hash_Flat_Slot    Eina_Hash_Flat_Slot;
 typedef struct _Eina_Hash_Element      Eina_Hash_Element;
 typedef struct _Eina_Hash_Foreach_Data Eina_Hash_Foreach_Data;
 typedef struct _Eina_Iterator_Hash     Eina_Iterator_Hash;
@@ -84,6 +101,12 @@ struct _Eina_Hash
 
    int             buckets_power_size;
 
+   /* Flat backend: size and mask describe the slot table, buckets is unused */
+   Eina_Hash_Flat_Slot *slots;
+   signed char         *ctrl;
+   int                  growth_left;
+   Eina_Bool            flat : 1;
+
    EINA_MAGIC
 };
 
@@ -102,6 +125,15 @@ struct _Eina_Hash_Element
    Eina_Hash_Tuple tuple;
 };
 
+struct _Eina_Hash_Flat_Slot
+{
+   Eina_Hash_Tuple tuple;
+   int             hash;
+   Eina_Bool       key_owned : 1;
+   Eina_Bool       key_inlined : 1;
+   uint64_t        key_inline;
+};
+
 struct _Eina_Hash_Foreach_Data
 {
    Eina_Hash_Foreach cb;
@@ -123,6 +155,7 @@ struct _Eina_Iterator_Hash
    Eina_Iterator                     *list;
    Eina_Hash_Head                    *hash_head;
    Eina_Hash_Element                 *hash_element;
+   Eina_Hash_Tuple                   *tuple;
    int                                bucket;
 
    int                                index;
@@ -148,6 +181,351 @@ struct _Eina_Hash_Each
                        + (uint32_t)(((const uint8_t *)(d))[0]))
 #endif
 
+/*
+ * Flat backend: SwissTable-like open addressing. The table is one array of
+ * slots followed by one control byte per slot. Lookups scan a whole group of
+ * control bytes at once and only touch the slots whose 7 bit hash tag match.
+ * The first EINA_HASH_FLAT_GROUP_WIDTH control bytes are mirrored after the
+ * end of the table so that a group can always be loaded without wrapping.
+ */
+
+typedef unsigned int Eina_Hash_Flat_Mask;
+
+#ifdef __SSE2__
+static inline Eina_Hash_Flat_Mask
+_eina_hash_flat_group_match(const signed char *ctrl, signed char tag)
+{
+   __m128i group = _mm_loadu_si128((const __m128i *)ctrl);
+
+   return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(tag), group));
+}
+
+static inline Eina_Hash_Flat_Mask
+_eina_hash_flat_group_match_free(const signed char *ctrl)
+{
+   /* Empty and deleted slots are the only ones with the high bit set. */
+   return _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)ctrl));
+}
+#else
+static inline Eina_Hash_Flat_Mask
+_eina_hash_flat_group_match(const signed char *ctrl, signed char tag)
+{
+   Eina_Hash_Flat_Mask mask = 0;
+   unsigned int i;
+
+   for (i = 0; i < EINA_HASH_FLAT_GROUP_WIDTH; i++)
+     mask |= (Eina_Hash_Flat_Mask)(ctrl[i] == tag) << i;
+   return mask;
+}
+
+static inline Eina_Hash_Flat_Mask
+_eina_hash_flat_group_match_free(const signed char *ctrl)
+{
+   Eina_Hash_Flat_Mask mask = 0;
+   unsigned int i;
+
+   for (i = 0; i < EINA_HASH_FLAT_GROUP_WIDTH; i++)
+     mask |= (Eina_Hash_Flat_Mask)(ctrl[i] < 0) << i;
+   return mask;
+}
+#endif
+
+static inline Eina_Hash_Flat_Mask
+_eina_hash_flat_group_match_empty(const signed char *ctrl)
+{
+   return _eina_hash_flat_group_match(ctrl, EINA_HASH_FLAT_EMPTY);
+}
+
+static inline unsigned int
+_eina_hash_flat_mask_trailing(Eina_Hash_Flat_Mask mask)
+{
+#ifdef __GNUC__
+   return __builtin_ctz(mask);
+#else
+   unsigned int i = 0;
+
+   while (!(mask & 1))
+     {
+        mask >>= 1;
+        i++;
+     }
+   return i;
+#endif
+}
+
+static inline unsigned int
+_eina_hash_flat_mask_leading(Eina_Hash_Flat_Mask mask)
+{
+   unsigned int i = 0;
+
+   while (!(mask & (1U << (EINA_HASH_FLAT_GROUP_WIDTH - 1))))
+     {
+        mask <<= 1;
+        i++;
+     }
+   return i;
+}
+
+static inline unsigned int
+_eina_hash_flat_mix(int key_hash)
+{
+   /* The user provided hash can be weak (int32/pointer), spread its bits
+    * as both the probe start and the control tag depend on them. */
+   unsigned int h = (unsigned int)key_hash;
+
+   h ^= h >> 16;
+   h *= 0x7feb352dU;
+   h ^= h >> 15;
+   h *= 0x846ca68bU;
+   h ^= h >> 16;
+   return h;
+}
+
+static inline void
+_eina_hash_flat_ctrl_set(Eina_Hash *hash, int idx, signed char tag)
+{
+   hash->ctrl[idx] = tag;
+   if (idx < EINA_HASH_FLAT_GROUP_WIDTH)
+     hash->ctrl[hash->size + idx] = tag;
+}
+
+static inline int
+_eina_hash_flat_max_load(int size)
+{
+   return size - size / 8;
+}
+
+static void
+_eina_hash_flat_slot_free(Eina_Hash *hash, Eina_Hash_Flat_Slot *slot)
+{
+   if (hash->data_free_cb)
+     hash->data_free_cb(slot->tuple.data);
+   if (slot->key_owned)
+     free((void *)slot->tuple.key);
+}
+
+static int
+_eina_hash_flat_free_slot_find(const Eina_Hash *hash, unsigned int h)
+{
+   unsigned int pos, step = 0;
+
+   pos = (h >> 7) & hash->mask;
+   for (;;)
+     {
+        Eina_Hash_Flat_Mask mask;
+
+        mask = _eina_hash_flat_group_match_free(hash->ctrl + pos);
+        if (mask)
+          return (pos + _eina_hash_flat_mask_trailing(mask)) & hash->mask;
+
+        step += EINA_HASH_FLAT_GROUP_WIDTH;
+        pos = (pos + step) & hash->mask;
+     }
+}
+
+static Eina_Bool
+_eina_hash_flat_resize(Eina_Hash *hash, int size)
+{
+   Eina_Hash_Flat_Slot *old_slots = hash->slots;
+   signed char *old_ctrl = hash->ctrl;
+   int old_size = hash->size;
+   void *table;
+   int i;
+
+   table = malloc(size * sizeof (Eina_Hash_Flat_Slot) +
+                  size + EINA_HASH_FLAT_GROUP_WIDTH);
+   if (!table) return EINA_FALSE;
+
+   hash->slots = table;
+   hash->ctrl = (signed char *)(hash->slots + size);
+   hash->size = size;
+   hash->mask = size - 1;
+   hash->growth_left = _eina_hash_flat_max_load(size) - hash->population;
+   memset(hash->ctrl, EINA_HASH_FLAT_EMPTY, size + EINA_HASH_FLAT_GROUP_WIDTH);
+
+   for (i = 0; i < old_size; i++)
+     {
+        Eina_Hash_Flat_Slot *slot;
+        unsigned int h;
+        int idx;
+
+        if (old_ctrl[i] < 0) continue;
+
+        h = _eina_hash_flat_mix(old_slots[i].hash);
+        idx = _eina_hash_flat_free_slot_find(hash, h);
+        _eina_hash_flat_ctrl_set(hash, idx, h & 0x7F);
+
+        slot = hash->slots + idx;
+        *slot = old_slots[i];
+        if (slot->key_inlined)
+          slot->tuple.key = &slot->key_inline;
+     }
+
+   free(old_slots);
+   return EINA_TRUE;
+}
+
+static Eina_Bool
+_eina_hash_flat_add(Eina_Hash *hash,
+                    const void *key, int key_length, int alloc_length,
+                    int key_hash,
+                    const void *data)
+{
+   Eina_Hash_Flat_Slot *slot;
+   unsigned int h;
+   int idx;
+
+   if (hash->growth_left <= 0)
+     {
+        int size = hash->size ? hash->size : EINA_HASH_FLAT_GROUP_WIDTH;
+
+        /* Only grow when the table is really full, otherwise rehashing in
+         * place is enough to get rid of the deleted markers. */
+        if (hash->population >= _eina_hash_flat_max_load(size) / 2)
+          size *= 2;
+        if (!_eina_hash_flat_resize(hash, size))
+          return EINA_FALSE;
+     }
+
+   h = _eina_hash_flat_mix(key_hash);
+   idx = _eina_hash_flat_free_slot_find(hash, h);
+   slot = hash->slots + idx;
+
+   slot->key_owned = EINA_FALSE;
+   slot->key_inlined = EINA_FALSE;
+   if (alloc_length > (int)sizeof (slot->key_inline))
+     {
+        void *copy = malloc(alloc_length);
+
+        if (!copy) return EINA_FALSE;
+        memcpy(copy, key, alloc_length);
+        slot->tuple.key = copy;
+        slot->key_owned = EINA_TRUE;
+     }
+   else if (alloc_length > 0)
+     {
+        memcpy(&slot->key_inline, key, alloc_length);
+        slot->tuple.key = &slot->key_inline;
+        slot->key_inlined = EINA_TRUE;
+     }
+   else
+     slot->tuple.key = key;
+
+   slot->tuple.key_length = key_length;
+   slot->tuple.data = (void *)data;
+   slot->hash = key_hash;
+
+   /* Reusing a deleted slot doesn't consume any growth. */
+   if (hash->ctrl[idx] == EINA_HASH_FLAT_EMPTY)
+     hash->growth_left--;
+   _eina_hash_flat_ctrl_set(hash, idx, h & 0x7F);
+   hash->population++;
+
+   return EINA_TRUE;
+}
+
+static inline Eina_Hash_Flat_Slot *
+_eina_hash_flat_find(const Eina_Hash *hash,
+                     const Eina_Hash_Tuple *tuple,
+                     int key_hash)
+{
+   unsigned int pos, step = 0;
+   unsigned int h;
+   signed char tag;
+
+   if (!hash->slots)
+     return NULL;
+
+   h = _eina_hash_flat_mix(key_hash);
+   tag = h & 0x7F;
+   pos = (h >> 7) & hash->mask;
+   for (;;)
+     {
+        Eina_Hash_Flat_Mask mask;
+
+        mask = _eina_hash_flat_group_match(hash->ctrl + pos, tag);
+        while (mask)
+          {
+             Eina_Hash_Flat_Slot *slot;
+
+             slot = hash->slots +
+               ((pos + _eina_hash_flat_mask_trailing(mask)) & hash->mask);
+             if (slot->hash == key_hash &&
+                 hash->key_cmp_cb(slot->tuple.key, slot->tuple.key_length,
+                                  tuple->key, tuple->key_length) == 0 &&
+                 (!tuple->data || tuple->data == slot->tuple.data))
+               return slot;
+
+             mask &= mask - 1;
+          }
+
+        if (_eina_hash_flat_group_match_empty(hash->ctrl + pos))
+          return NULL;
+
+        step += EINA_HASH_FLAT_GROUP_WIDTH;
+        pos = (pos + step) & hash->mask;
+     }
+}
+
+static inline Eina_Hash_Flat_Slot *
+_eina_hash_flat_find_by_data(const Eina_Hash *hash, const void *data)
+{
+   int i;
+
+   for (i = 0; i < hash->size; i++)
+     if (hash->ctrl[i] >= 0 && hash->slots[i].tuple.data == data)
+       return hash->slots + i;
+
+   return NULL;
+}
+
+static Eina_Bool
+_eina_hash_flat_del(Eina_Hash *hash, Eina_Hash_Flat_Slot *slot)
+{
+   Eina_Hash_Flat_Mask empty_before, empty_after;
+   int idx = slot - hash->slots;
+   int before = (idx - EINA_HASH_FLAT_GROUP_WIDTH) & hash->mask;
+
+   _eina_hash_flat_slot_free(hash, slot);
+
+   /* If no probe could ever have gone past this slot without seeing an
+    * empty one, it can go back to empty instead of becoming a tombstone. */
+   empty_before = _eina_hash_flat_group_match_empty(hash->ctrl + before);
+   empty_after = _eina_hash_flat_group_match_empty(hash->ctrl + idx);
+   if (empty_before && empty_after &&
+       _eina_hash_flat_mask_trailing(empty_after) +
+       _eina_hash_flat_mask_leading(empty_before) < EINA_HASH_FLAT_GROUP_WIDTH)
+     {
+        _eina_hash_flat_ctrl_set(hash, idx, EINA_HASH_FLAT_EMPTY);
+        hash->growth_left++;
+     }
+   else
+     _eina_hash_flat_ctrl_set(hash, idx, EINA_HASH_FLAT_DELETED);
+
+   hash->population--;
+   return EINA_TRUE;
+}
+
+static void
+_eina_hash_flat_free_buckets(Eina_Hash *hash)
+{
+   int i;
+
+   if (!hash->slots) return;
+
+   for (i = 0; i < hash->size; i++)
+     if (hash->ctrl[i] >= 0)
+       _eina_hash_flat_slot_free(hash, hash->slots + i);
+
+   free(hash->slots);
+   hash->slots = NULL;
+   hash->ctrl = NULL;
+   hash->size = 0;
+   hash->mask = 0;
+   hash->growth_left = 0;
+   hash->population = 0;
+}
+
 static inline int
 _eina_hash_hash_rbtree_cmp_hash(const Eina_Hash_Head *hash_head,
                                 const int *hash,
@@ -218,6 +596,10 @@ eina_hash_add_alloc_by_hash(Eina_Hash *hash,
    EINA_SAFETY_ON_NULL_RETURN_VAL(data, EINA_FALSE);
    EINA_MAGIC_CHECK_HASH(hash);
 
+   if (hash->flat)
+     return _eina_hash_flat_add(hash, key, key_length, alloc_length,
+                                key_hash, data);
+
    /* Apply eina mask to hash. */
    hash_num = key_hash & hash->mask;
    key_hash >>= hash->buckets_power_size;
@@ -348,6 +730,25 @@ _eina_hash_find_by_hash(const Eina_Hash *hash,
    return hash_element;
 }
 
+static inline Eina_Hash_Tuple *
+_eina_hash_find_tuple(const Eina_Hash *hash,
+                      Eina_Hash_Tuple *tuple,
+                      int key_hash,
+                      Eina_Hash_Head **hash_head)
+{
+   Eina_Hash_Element *hash_element;
+
+   if (hash->flat)
+     {
+        *hash_head = NULL;
+        return (Eina_Hash_Tuple *)_eina_hash_flat_find(hash, tuple, key_hash);
+     }
+
+   hash_element = _eina_hash_find_by_hash(hash, tuple, key_hash, hash_head);
+   if (!hash_element) return NULL;
+   return &hash_element->tuple;
+}
+
 static inline Eina_Hash_Element *
 _eina_hash_find_by_data(const Eina_Hash *hash,
                         const void *data,
@@ -434,6 +835,21 @@ _eina_hash_del_by_hash_el(Eina_Hash *hash,
    return EINA_TRUE;
 }
 
+static Eina_Bool
+_eina_hash_del_tuple(Eina_Hash *hash,
+                     Eina_Hash_Tuple *tuple,
+                     Eina_Hash_Head *hash_head,
+                     int key_hash)
+{
+   if (hash->flat)
+     return _eina_hash_flat_del(hash, (Eina_Hash_Flat_Slot *)tuple);
+
+   return _eina_hash_del_by_hash_el(hash,
+                                    (Eina_Hash_Element *)
+                                    ((char *)tuple - offsetof(Eina_Hash_Element, tuple)),
+                                    hash_head, key_hash);
+}
+
 static Eina_Bool
 _eina_hash_del_by_key_hash(Eina_Hash *hash,
                            const void *key,
@@ -441,26 +857,26 @@ _eina_hash_del_by_key_hash(Eina_Hash *hash,
                            int key_hash,
                            const void *data)
 {
-   Eina_Hash_Element *hash_element;
    Eina_Hash_Head *hash_head;
+   Eina_Hash_Tuple *found;
    Eina_Hash_Tuple tuple;
 
    EINA_SAFETY_ON_NULL_RETURN_VAL(hash, EINA_FALSE);
    EINA_SAFETY_ON_NULL_RETURN_VAL(key, EINA_FALSE);
    EINA_MAGIC_CHECK_HASH(hash);
 
-   if (!hash->buckets)
+   if (!hash->buckets && !hash->slots)
      return EINA_FALSE;
 
    tuple.key = (void *)key;
    tuple.key_length = key_length;
    tuple.data = (void *)data;
 
-   hash_element = _eina_hash_find_by_hash(hash, &tuple, key_hash, &hash_head);
-   if (!hash_element)
+   found = _eina_hash_find_tuple(hash, &tuple, key_hash, &hash_head);
+   if (!found)
      return EINA_FALSE;
 
-   return _eina_hash_del_by_hash_el(hash, hash_element, hash_head, key_hash);
+   return _eina_hash_del_tuple(hash, found, hash_head, key_hash);
 }
 
 static void
@@ -479,7 +895,7 @@ _eina_hash_del_by_key(Eina_Hash *hash, const void *key, const void *data)
    EINA_SAFETY_ON_NULL_RETURN_VAL(key, EINA_FALSE);
    EINA_MAGIC_CHECK_HASH(hash);
 
-   if (!hash->buckets)
+   if (!hash->buckets && !hash->slots)
      return EINA_FALSE;
 
    _eina_hash_compute(hash, key, &key_length, &key_hash);
@@ -578,46 +994,39 @@ _eina_foreach_cb(const Eina_Hash *hash,
 static void *
 _eina_hash_iterator_data_get_content(Eina_Iterator_Hash *it)
 {
-   Eina_Hash_Element *stuff;
+   Eina_Hash_Tuple *stuff;
 
    EINA_MAGIC_CHECK_HASH_ITERATOR(it, NULL);
 
-   stuff = it->hash_element;
+   stuff = it->tuple;
 
    if (!stuff)
      return NULL;
 
-   return stuff->tuple.data;
+   return stuff->data;
 }
 
 static void *
 _eina_hash_iterator_key_get_content(Eina_Iterator_Hash *it)
 {
-   Eina_Hash_Element *stuff;
+   Eina_Hash_Tuple *stuff;
 
    EINA_MAGIC_CHECK_HASH_ITERATOR(it, NULL);
 
-   stuff = it->hash_element;
+   stuff = it->tuple;
 
    if (!stuff)
      return NULL;
 
-   return (void *)stuff->tuple.key;
+   return (void *)stuff->key;
 }
 
 static Eina_Hash_Tuple *
 _eina_hash_iterator_tuple_get_content(Eina_Iterator_Hash *it)
 {
-   Eina_Hash_Element *stuff;
-
    EINA_MAGIC_CHECK_HASH_ITERATOR(it, NULL);
 
-   stuff = it->hash_element;
-
-   if (!stuff)
-     return NULL;
-
-   return &stuff->tuple;
+   return it->tuple;
 }
 
 static Eina_Bool
@@ -691,11 +1100,33 @@ _eina_hash_iterator_next(Eina_Iterator_Hash *it, void **data)
    it->bucket = bucket;
 
    if (ok)
-     *data = it->get_content(it);
+     {
+        it->tuple = &it->hash_element->tuple;
+        *data = it->get_content(it);
+     }
 
    return ok;
 }
 
+static Eina_Bool
+_eina_hash_flat_iterator_next(Eina_Iterator_Hash *it, void **data)
+{
+   const Eina_Hash *hash = it->hash;
+
+   while (it->bucket < hash->size)
+     {
+        int idx = it->bucket++;
+
+        if (hash->ctrl[idx] < 0) continue;
+
+        it->tuple = &hash->slots[idx].tuple;
+        *data = it->get_content(it);
+        return EINA_TRUE;
+     }
+
+   return EINA_FALSE;
+}
+
 static void *
 _eina_hash_iterator_get_container(Eina_Iterator_Hash *it)
 {
@@ -769,12 +1200,43 @@ eina_hash_new(Eina_Key_Length key_length_cb,
    new->mask = new->size - 1;
    new->buckets_power_size = buckets_power_size;
 
+   new->slots = NULL;
+   new->ctrl = NULL;
+   new->growth_left = 0;
+   new->flat = EINA_FALSE;
+
    return new;
 
 on_error:
    return NULL;
 }
 
+EAPI Eina_Hash *
+eina_hash_flat_new(Eina_Key_Length key_length_cb,
+                   Eina_Key_Cmp key_cmp_cb,
+                   Eina_Key_Hash key_hash_cb,
+                   Eina_Free_Cb data_free_cb)
+{
+   Eina_Hash *new;
+
+   EINA_SAFETY_ON_NULL_RETURN_VAL(key_cmp_cb, NULL);
+   EINA_SAFETY_ON_NULL_RETURN_VAL(key_hash_cb, NULL);
+
+   new = calloc(1, sizeof (Eina_Hash));
+   if (!new)
+     return NULL;
+
+   EINA_MAGIC_SET(new, EINA_MAGIC_HASH);
+
+   new->key_length_cb = key_length_cb;
+   new->key_cmp_cb = key_cmp_cb;
+   new->key_hash_cb = key_hash_cb;
+   new->data_free_cb = data_free_cb;
+   new->flat = EINA_TRUE;
+
+   return new;
+}
+
 EAPI Eina_Hash *
 eina_hash_string_djb2_new(Eina_Free_Cb data_free_cb)
 {
@@ -853,6 +1315,52 @@ eina_hash_stringshared_new(Eina_Free_Cb data_free_cb)
                         EINA_HASH_BUCKET_SIZE);
 }
 
+EAPI Eina_Hash *
+eina_hash_flat_string_new(Eina_Free_Cb data_free_cb)
+{
+   return eina_hash_flat_new(EINA_KEY_LENGTH(_eina_string_key_length),
+                             EINA_KEY_CMP(_eina_string_key_cmp),
+                             EINA_KEY_HASH(eina_hash_superfast),
+                             data_free_cb);
+}
+
+EAPI Eina_Hash *
+eina_hash_flat_int32_new(Eina_Free_Cb data_free_cb)
+{
+   return eina_hash_flat_new(EINA_KEY_LENGTH(_eina_int32_key_length),
+                             EINA_KEY_CMP(_eina_int32_key_cmp),
+                             EINA_KEY_HASH(eina_hash_int32),
+                             data_free_cb);
+}
+
+EAPI Eina_Hash *
+eina_hash_flat_int64_new(Eina_Free_Cb data_free_cb)
+{
+   return eina_hash_flat_new(EINA_KEY_LENGTH(_eina_int64_key_length),
+                             EINA_KEY_CMP(_eina_int64_key_cmp),
+                             EINA_KEY_HASH(eina_hash_int64),
+                             data_free_cb);
+}
+
+EAPI Eina_Hash *
+eina_hash_flat_pointer_new(Eina_Free_Cb data_free_cb)
+{
+#ifdef EFL64
+   return eina_hash_flat_int64_new(data_free_cb);
+#else
+   return eina_hash_flat_int32_new(data_free_cb);
+#endif
+}
+
+EAPI Eina_Hash *
+eina_hash_flat_stringshared_new(Eina_Free_Cb data_free_cb)
+{
+   return eina_hash_flat_new(NULL,
+                             EINA_KEY_CMP(_eina_stringshared_key_cmp),
+                             EINA_KEY_HASH(_eina_stringshared_hash),
+                             data_free_cb);
+}
+
 EAPI int
 eina_hash_population(const Eina_Hash *hash)
 {
@@ -872,7 +1380,9 @@ eina_hash_free(Eina_Hash *hash)
 
    EINA_MAGIC_CHECK_HASH(hash);
 
-   if (hash->buckets)
+   if (hash->flat)
+     _eina_hash_flat_free_buckets(hash);
+   else if (hash->buckets)
      {
         for (i = 0; i < hash->size; i++)
           eina_rbtree_delete(hash->buckets[i], EINA_RBTREE_FREE_CB(_eina_hash_head_free), hash);
@@ -890,7 +1400,9 @@ eina_hash_free_buckets(Eina_Hash *hash)
 
    EINA_MAGIC_CHECK_HASH(hash);
 
-   if (hash->buckets)
+   if (hash->flat)
+     _eina_hash_flat_free_buckets(hash);
+   else if (hash->buckets)
      {
         for (i = 0; i < hash->size; i++)
           eina_rbtree_delete(hash->buckets[i],
@@ -992,6 +1504,15 @@ eina_hash_del_by_data(Eina_Hash *hash, const void *data)
    EINA_SAFETY_ON_NULL_RETURN_VAL(data, EINA_FALSE);
    EINA_MAGIC_CHECK_HASH(hash);
 
+   if (hash->flat)
+     {
+        Eina_Hash_Flat_Slot *slot;
+
+        slot = _eina_hash_flat_find_by_data(hash, data);
+        if (!slot) goto error;
+        return _eina_hash_flat_del(hash, slot);
+     }
+
    hash_element = _eina_hash_find_by_data(hash, data, &key_hash, &hash_head);
    if (!hash_element)
      goto error;
@@ -1044,7 +1565,7 @@ eina_hash_find_by_hash(const Eina_Hash *hash,
                        int key_hash)
 {
    Eina_Hash_Head *hash_head;
-   Eina_Hash_Element *hash_element;
+   Eina_Hash_Tuple *found;
    Eina_Hash_Tuple tuple;
 
    if (!hash)
@@ -1057,9 +1578,9 @@ eina_hash_find_by_hash(const Eina_Hash *hash,
    tuple.key_length = key_length;
    tuple.data = NULL;
 
-   hash_element = _eina_hash_find_by_hash(hash, &tuple, key_hash, &hash_head);
-   if (hash_element)
-     return hash_element->tuple.data;
+   found = _eina_hash_find_tuple(hash, &tuple, key_hash, &hash_head);
+   if (found)
+     return found->data;
 
    return NULL;
 }
@@ -1090,7 +1611,7 @@ eina_hash_modify_by_hash(Eina_Hash *hash,
                          const void *data)
 {
    Eina_Hash_Head *hash_head;
-   Eina_Hash_Element *hash_element;
+   Eina_Hash_Tuple *found;
    void *old_data = NULL;
    Eina_Hash_Tuple tuple;
 
@@ -1103,11 +1624,11 @@ eina_hash_modify_by_hash(Eina_Hash *hash,
    tuple.key_length = key_length;
    tuple.data = NULL;
 
-   hash_element = _eina_hash_find_by_hash(hash, &tuple, key_hash, &hash_head);
-   if (hash_element)
+   found = _eina_hash_find_tuple(hash, &tuple, key_hash, &hash_head);
+   if (found)
      {
-        old_data = hash_element->tuple.data;
-        hash_element->tuple.data = (void *)data;
+        old_data = found->data;
+        found->data = (void *)data;
      }
 
    return old_data;
@@ -1118,7 +1639,7 @@ eina_hash_set(Eina_Hash *hash, const void *key, const void *data)
 {
    Eina_Hash_Tuple tuple;
    Eina_Hash_Head *hash_head;
-   Eina_Hash_Element *hash_element;
+   Eina_Hash_Tuple *found;
    int key_length;
    int key_hash;
 
@@ -1133,22 +1654,22 @@ eina_hash_set(Eina_Hash *hash, const void *key, const void *data)
    tuple.key_length = key_length;
    tuple.data = NULL;
 
-   hash_element = _eina_hash_find_by_hash(hash, &tuple, key_hash, &hash_head);
-   if (hash_element)
+   found = _eina_hash_find_tuple(hash, &tuple, key_hash, &hash_head);
+   if (found)
      {
         void *old_data = NULL;
 
-        old_data = hash_element->tuple.data;
+        old_data = found->data;
 
         if (data)
           {
-             hash_element->tuple.data = (void *)data;
+             found->data = (void *)data;
           }
         else
           {
              Eina_Free_Cb cb = hash->data_free_cb;
              hash->data_free_cb = NULL;
-             _eina_hash_del_by_hash_el(hash, hash_element, hash_head, key_hash);
+             _eina_hash_del_tuple(hash, found, hash_head, key_hash);
              hash->data_free_cb = cb;
           }
 
@@ -1253,7 +1774,10 @@ eina_hash_iterator_data_new(const Eina_Hash *hash)
    it->get_content = FUNC_ITERATOR_GET_CONTENT(_eina_hash_iterator_data_get_content);
 
    it->iterator.version = EINA_ITERATOR_VERSION;
-   it->iterator.next = FUNC_ITERATOR_NEXT(_eina_hash_iterator_next);
+   if (hash->flat)
+     it->iterator.next = FUNC_ITERATOR_NEXT(_eina_hash_flat_iterator_next);
+   else
+     it->iterator.next = FUNC_ITERATOR_NEXT(_eina_hash_iterator_next);
    it->iterator.get_container = FUNC_ITERATOR_GET_CONTAINER(
        _eina_hash_iterator_get_container);
    it->iterator.free = FUNC_ITERATOR_FREE(_eina_hash_iterator_free);
@@ -1280,7 +1804,10 @@ eina_hash_iterator_key_new(const Eina_Hash *hash)
        _eina_hash_iterator_key_get_content);
 
    it->iterator.version = EINA_ITERATOR_VERSION;
-   it->iterator.next = FUNC_ITERATOR_NEXT(_eina_hash_iterator_next);
+   if (hash->flat)
+     it->iterator.next = FUNC_ITERATOR_NEXT(_eina_hash_flat_iterator_next);
+   else
+     it->iterator.next = FUNC_ITERATOR_NEXT(_eina_hash_iterator_next);
    it->iterator.get_container = FUNC_ITERATOR_GET_CONTAINER(
        _eina_hash_iterator_get_container);
    it->iterator.free = FUNC_ITERATOR_FREE(_eina_hash_iterator_free);
@@ -1307,7 +1834,10 @@ eina_hash_iterator_tuple_new(const Eina_Hash *hash)
        _eina_hash_iterator_tuple_get_content);
 
    it->iterator.version = EINA_ITERATOR_VERSION;
-   it->iterator.next = FUNC_ITERATOR_NEXT(_eina_hash_iterator_next);
+   if (hash->flat)
+     it->iterator.next = FUNC_ITERATOR_NEXT(_eina_hash_flat_iterator_next);
+   else
+     it->iterator.next = FUNC_ITERATOR_NEXT(_eina_hash_iterator_next);
    it->iterator.get_container = FUNC_ITERATOR_GET_CONTAINER(
        _eina_hash_iterator_get_container);
    it->iterator.free = FUNC_ITERATOR_FREE(_eina_hash_iterator_free);
@@ -1379,7 +1909,7 @@ eina_hash_list_append(Eina_Hash *hash, const void *key, const void *data)
 {
    Eina_Hash_Tuple tuple;
    Eina_Hash_Head *hash_head;
-   Eina_Hash_Element *hash_element;
+   Eina_Hash_Tuple *found;
    int key_length;
    int key_hash;
 
@@ -1395,9 +1925,9 @@ eina_hash_list_append(Eina_Hash *hash, const void *key, const void *data)
    tuple.key_length = key_length;
    tuple.data = NULL;
 
-   hash_element = _eina_hash_find_by_hash(hash, &tuple, key_hash, &hash_head);
-   if (hash_element)
-      hash_element->tuple.data = eina_list_append(hash_element->tuple.data, data);
+   found = _eina_hash_find_tuple(hash, &tuple, key_hash, &hash_head);
+   if (found)
+      found->data = eina_list_append(found->data, data);
    else
      eina_hash_add_alloc_by_hash(hash,
                             key,
@@ -1412,7 +1942,7 @@ eina_hash_list_prepend(Eina_Hash *hash, const void *key, const void *data)
 {
    Eina_Hash_Tuple tuple;
    Eina_Hash_Head *hash_head;
-   Eina_Hash_Element *hash_element;
+   Eina_Hash_Tuple *found;
    int key_length;
    int key_hash;
 
@@ -1428,9 +1958,9 @@ eina_hash_list_prepend(Eina_Hash *hash, const void *key, const void *data)
    tuple.key_length = key_length;
    tuple.data = NULL;
 
-   hash_element = _eina_hash_find_by_hash(hash, &tuple, key_hash, &hash_head);
-   if (hash_element)
-      hash_element->tuple.data = eina_list_prepend(hash_element->tuple.data, data);
+   found = _eina_hash_find_tuple(hash, &tuple, key_hash, &hash_head);
+   if (found)
+      found->data = eina_list_prepend(found->data, data);
    else
      eina_hash_add_alloc_by_hash(hash,
                             key,
@@ -1445,7 +1975,7 @@ eina_hash_list_remove(Eina_Hash *hash, const void *key, const void *data)
 {
    Eina_Hash_Tuple tuple;
    Eina_Hash_Head *hash_head;
-   Eina_Hash_Element *hash_element;
+   Eina_Hash_Tuple *found;
    int key_length;
    int key_hash;
 
@@ -1461,9 +1991,9 @@ eina_hash_list_remove(Eina_Hash *hash, const void *key, const void *data)
    tuple.key_length = key_length;
    tuple.data = NULL;
 
-   hash_element = _eina_hash_find_by_hash(hash, &tuple, key_hash, &hash_head);
-   if (!hash_element) return;
-   hash_element->tuple.data = eina_list_remove(hash_element->tuple.data, data);
-   if (!hash_element->tuple.data)
-     _eina_hash_del_by_hash_el(hash, hash_element, hash_head, key_hash);
+   found = _eina_hash_find_tuple(hash, &tuple, key_hash, &hash_head);
+   if (!found) return;
+   found->data = eina_list_remove(found->data, data);
+   if (!found->data)
+     _eina_hash_del_tuple(hash, found, hash_head, key_hash);
 }
@@ -532,6 +532,115 @@ EAPI Eina_Hash *eina_hash_pointer_new(Eina_Free_Cb data_free_cb);
  */
 EAPI Eina_Hash *eina_hash_stringshared_new(Eina_Free_Cb data_free_cb);
 
+/**
+ * @brief Creates a new hash table using the flat, open addressing backend.
+ *
+ * @param[in] key_length_cb The function called when getting the size of the key.
+ * @param[in] key_cmp_cb The function called when comparing the keys.
+ * @param[in] key_hash_cb The function called when getting the values.
+ * @param[in] data_free_cb The function called on each value when the hash table is
+ * freed, or when an item is deleted from it. @c NULL can be passed as a
+ * callback.
+ * @return The new hash table, or @c NULL on failure.
+ *
+ * This function creates a hash table that behaves like one returned by
+ * eina_hash_new() and can be used with the whole Eina_Hash API, but stores
+ * its entries in a single array probed with groups of control bytes
+ * (SwissTable-like) instead of buckets of red black trees. Lookups touch a
+ * lot less memory and adding an entry doesn't require an allocation unless
+ * a copied key is bigger than 8 bytes. The table grows by itself, so no
+ * bucket size is needed.
+ *
+ * Contrary to the default backend, pointers to keys and tuples returned by
+ * the hash (e.g. from an iterator) are only valid until the next addition.
+ * If @p key_cmp_cb or @p key_hash_cb are @c NULL, @c NULL is returned.
+ *
+ * @since 1.22
+ */
+EAPI Eina_Hash *eina_hash_flat_new(Eina_Key_Length key_length_cb,
+                                   Eina_Key_Cmp    key_cmp_cb,
+                                   Eina_Key_Hash   key_hash_cb,
+                                   Eina_Free_Cb    data_free_cb) EINA_MALLOC EINA_WARN_UNUSED_RESULT EINA_ARG_NONNULL(2, 3);
+
+/**
+ * @brief Creates a new flat hash table for use with strings.
+ *
+ * @param[in] data_free_cb The function called on each value when the hash table
+ * is freed, or when an item is deleted from it. @c NULL can be passed as
+ * callback.
+ * @return The new hash table, or @c NULL on failure.
+ *
+ * This is the flat counterpart of eina_hash_string_superfast_new().
+ *
+ * @since 1.22
+ * @see eina_hash_flat_new()
+ */
+EAPI Eina_Hash *eina_hash_flat_string_new(Eina_Free_Cb data_free_cb);
+
+/**
+ * @brief Creates a new flat hash table for use with 32bit integers.
+ *
+ * @param[in] data_free_cb The function called on each value when the hash table
+ * is freed, or when an item is deleted from it. @c NULL can be passed as
+ * callback.
+ * @return The new hash table, or @c NULL on failure.
+ *
+ * This is the flat counterpart of eina_hash_int32_new(). Keys are stored
+ * inside the table.
+ *
+ * @since 1.22
+ * @see eina_hash_flat_new()
+ */
+EAPI Eina_Hash *eina_hash_flat_int32_new(Eina_Free_Cb data_free_cb);
+
+/**
+ * @brief Creates a new flat hash table for use with 64bit integers.
+ *
+ * @param[in] data_free_cb The function called on each value when the hash table
+ * is freed, or when an item is deleted from it. @c NULL can be passed as
+ * callback.
+ * @return The new hash table, or @c NULL on failure.
+ *
+ * This is the flat counterpart of eina_hash_int64_new(). Keys are stored
+ * inside the table.
+ *
+ * @since 1.22
+ * @see eina_hash_flat_new()
+ */
+EAPI Eina_Hash *eina_hash_flat_int64_new(Eina_Free_Cb data_free_cb);
+
+/**
+ * @brief Creates a new flat hash table for use with pointers.
+ *
+ * @param[in] data_free_cb The function called on each value when the hash table
+ * is freed, or when an item is deleted from it. @c NULL can be passed as
+ * callback.
+ * @return The new hash table, or @c NULL on failure.
+ *
+ * This is the flat counterpart of eina_hash_pointer_new(). Keys are stored
+ * inside the table.
+ *
+ * @since 1.22
+ * @see eina_hash_flat_new()
+ */
+EAPI Eina_Hash *eina_hash_flat_pointer_new(Eina_Free_Cb data_free_cb);
+
+/**
+ * @brief Creates a new flat hash table optimized for stringshared values.
+ *
+ * @param[in] data_free_cb The function called on each value when the hash table
+ * is freed, or when an item is deleted from it. @c NULL can be passed as
+ * callback.
+ * @return The new hash table, or @c NULL on failure.
+ *
+ * This is the flat counterpart of eina_hash_stringshared_new(), the same
+ * restrictions on the keys apply.
+ *
+ * @since 1.22
+ * @see eina_hash_flat_new()
+ */
+EAPI Eina_Hash *eina_hash_flat_stringshared_new(Eina_Free_Cb data_free_cb);
+
 /**
  * @brief Adds an entry to the given hash table.
  *
@@ -56,6 +56,11 @@ struct _Eina_Mempool_Backend
     * @see eina_mempool_from
     */
    Eina_Bool (*from)(void *data, void *element);
+   /** Function to release all the elements of the mempool at once; can be
+    * NULL if the feature isn't available in the backend.
+    * @see eina_mempool_reset
+    */
+   void (*reset)(void *data);
 };
 
 struct _Eina_Mempool_Backend_ABI1
@@ -74,6 +79,7 @@ struct _Eina_Mempool_Backend_ABI2
 {
    void (*repack)(void *data, Eina_Mempool_Repack_Cb cb, void *cb_data);
    Eina_Bool (*from)(void *data, void *element);
+   void (*reset)(void *data);
 };
 
 struct _Eina_Mempool
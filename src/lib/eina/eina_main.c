@@ -153,6 +153,7 @@ extern Eina_Lock       _sysmon_lock;
    S(cow);
    S(cpu);
    S(thread_queue);
+   S(parallel);
    S(rbtree);
    S(file);
    S(safepointer);
@@ -202,6 +203,7 @@ static const struct eina_desc_setup _eina_desc_setup[] = {
    S(cow),
    S(cpu),
    S(thread_queue),
+   S(parallel),
    S(rbtree),
    S(file),
    S(safepointer),
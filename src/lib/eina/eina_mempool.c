@@ -91,12 +91,13 @@ _new_va(const char *name,
    SBP(shutdown);
 #undef SBP
 
-   if (be->repack || be->from)
+   if (be->repack || be->from || be->reset)
      {
         mp->backend2 = calloc(1, sizeof (Eina_Mempool_Backend_ABI2));
         if (!mp->backend2) goto on_error;
         mp->backend2->repack = be->repack;
         mp->backend2->from = be->from;
+        mp->backend2->reset = be->reset;
      }
 
    mp->backend_data = mp->backend.init(context, options, args);
@@ -127,6 +128,11 @@ Eina_Bool pass_through_init(void);
 void      pass_through_shutdown(void);
 #endif
 
+#ifdef EINA_STATIC_BUILD_ARENA
+Eina_Bool arena_init(void);
+void      arena_shutdown(void);
+#endif
+
 /**
  * @endcond
  */
@@ -209,6 +215,9 @@ eina_mempool_init(void)
 #ifdef EINA_STATIC_BUILD_PASS_THROUGH
    pass_through_init();
 #endif
+#ifdef EINA_STATIC_BUILD_ARENA
+   arena_init();
+#endif
 
    return EINA_TRUE;
 
@@ -231,6 +240,9 @@ eina_mempool_shutdown(void)
 #endif
 #ifdef EINA_STATIC_BUILD_PASS_THROUGH
    pass_through_shutdown();
+#endif
+#ifdef EINA_STATIC_BUILD_ARENA
+   arena_shutdown();
 #endif
    /* dynamic backends */
    eina_module_list_free(_modules);
@@ -300,6 +312,15 @@ EAPI void eina_mempool_gc(Eina_Mempool *mp)
    mp->backend.garbage_collect(mp->backend_data);
 }
 
+EAPI void eina_mempool_reset(Eina_Mempool *mp)
+{
+   EINA_SAFETY_ON_NULL_RETURN(mp);
+   EINA_SAFETY_ON_NULL_RETURN(mp->backend2);
+   EINA_SAFETY_ON_NULL_RETURN(mp->backend2->reset);
+   DBG("mp=%p", mp);
+   mp->backend2->reset(mp->backend_data);
+}
+
 EAPI void eina_mempool_statistics(Eina_Mempool *mp)
 {
    EINA_SAFETY_ON_NULL_RETURN(mp);
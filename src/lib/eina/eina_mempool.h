@@ -35,13 +35,19 @@
  * chunk of memory with malloc() and splits the result into chunks of the
  * requested size that are pushed inside a stack. When requested, it
  * takes this pointer from the stack to give them to whoever wants
- * them.
+ * them. When created with the "magazine" option, every thread also keeps
+ * a small cache of free items, so that allocating and freeing from the
+ * same thread does not need to take the pool lock most of the time.
  * @li @c pass_through: it just call malloc() and free(). It may be
  * faster on some computers than using our own allocators (like having
  * a huge L2 cache, over 4MB).
  * @li @c one_big: It calls malloc() just one time for the requested number
  * of items. This is useful when you know in advance how many objects of some
  * type live during the life of the mempool.
+ * @li @c arena: It hands out memory by bumping a pointer inside big chunks
+ * and ignores individual frees. Everything is released at once with
+ * eina_mempool_reset(), which makes it a good fit for short lived data
+ * that is rebuilt every frame.
  *
  * @{
  */
@@ -80,8 +86,8 @@ EAPI extern Eina_Error EINA_ERROR_NOT_MEMPOOL_MODULE;
  *
  * @param[in] name Name of the mempool kind to use.
  * @param[in] context Identifier of the mempool created (for debug purposes).
- * @param[in] options Unused. Use the variable arguments list instead to pass options to the mempool.
- * @param[in] ... Additional options to pass to the allocator; depends entirely on the type of mempool ("int pool size" for chained and "int item_size" for one_big.
+ * @param[in] options Backend specific string of options, can be NULL ("magazine" for chained). Use the variable arguments list to pass the sizing options to the mempool.
+ * @param[in] ... Additional options to pass to the allocator; depends entirely on the type of mempool ("int item_size, int pool_size" for chained and one_big, "int item_size, int item_count" to size the chunks of arena).
  * @return Newly allocated mempool instance, NULL otherwise.
  */
 EAPI Eina_Mempool  *eina_mempool_add(const char *name, const char *context, const char *options, ...) EINA_MALLOC EINA_WARN_UNUSED_RESULT EINA_ARG_NONNULL(1);
@@ -178,6 +184,19 @@ EAPI void           eina_mempool_repack(Eina_Mempool *mp, Eina_Mempool_Repack_Cb
  */
 EAPI void           eina_mempool_gc(Eina_Mempool *mp) EINA_ARG_NONNULL(1);
 
+/**
+ * @brief Releases all the elements of the mempool at once.
+ *
+ * @param[in] mp The mempool
+ *
+ * @details Every pointer previously returned by @p mp becomes invalid and
+ *          the memory is kept for the next allocations. This is only
+ *          implemented by backends designed for it, like @c arena.
+ *
+ * @since 1.22
+ */
+EAPI void           eina_mempool_reset(Eina_Mempool *mp) EINA_ARG_NONNULL(1);
+
 /**
  * @brief Check if a pointer is a valid element from the mempool
  *
@@ -0,0 +1,369 @@
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "eina_config.h"
+#include "eina_private.h"
+#include "eina_inlist.h"
+#include "eina_lock.h"
+#include "eina_thread.h"
+#include "eina_cpu.h"
+#include "eina_safety_checks.h"
+#include "eina_parallel.h"
+
+#ifdef __ATOMIC_RELAXED
+#define ATOMIC 1
+#endif
+
+// no point in more than that, the range would be cut too thin
+#define THREADS_MAX 64
+
+// size of the buffer on the caller's stack holding the partial results of
+// eina_parallel_reduce(), one slot per thread working on it
+#define REDUCE_BUFFER 1024
+
+typedef struct _Eina_Parallel_Job Eina_Parallel_Job;
+
+struct _Eina_Parallel_Job
+{
+   EINA_INLIST;
+
+   Eina_Parallel_Range_Cb cb;
+   Eina_Parallel_Reduce_Cb reduce;
+   const void *data;
+
+   unsigned int next; // first index not handed out yet
+   unsigned int end;
+   unsigned int grain;
+   unsigned int helpers; // threads other than the caller working on it
+
+   // reduce only, slot 0 keeps the identity value
+   unsigned char *slots;
+   unsigned int size;
+   unsigned int stride;
+   unsigned int slots_used;
+   unsigned int slots_max;
+};
+
+static Eina_Lock _eina_parallel_lock;
+static Eina_Condition _eina_parallel_cond; // wakes up the workers
+static Eina_Condition _eina_parallel_done; // wakes up the callers
+static Eina_Inlist *_eina_parallel_jobs = NULL;
+static Eina_Thread _eina_parallel_workers[THREADS_MAX];
+static unsigned int _eina_parallel_workers_count = 0;
+static unsigned int _eina_parallel_workers_max = 0;
+static unsigned int _eina_parallel_idle = 0;
+static Eina_Bool _eina_parallel_started = EINA_FALSE;
+static Eina_Bool _eina_parallel_exit = EINA_FALSE;
+#ifndef ATOMIC
+static Eina_Spinlock _eina_parallel_claim_lock;
+#endif
+
+static inline unsigned int
+_eina_parallel_next_get(Eina_Parallel_Job *job)
+{
+#ifdef ATOMIC
+   return __atomic_load_n(&job->next, __ATOMIC_RELAXED);
+#else
+   unsigned int next;
+
+   eina_spinlock_take(&_eina_parallel_claim_lock);
+   next = job->next;
+   eina_spinlock_release(&_eina_parallel_claim_lock);
+   return next;
+#endif
+}
+
+static inline Eina_Bool
+_eina_parallel_claim(Eina_Parallel_Job *job, unsigned int *start, unsigned int *end)
+{
+   unsigned int s, e;
+
+#ifdef ATOMIC
+   s = __atomic_load_n(&job->next, __ATOMIC_RELAXED);
+   do
+     {
+        if (s >= job->end) return EINA_FALSE;
+        // never step over end, next could wrap around otherwise
+        e = (job->end - s > job->grain) ? s + job->grain : job->end;
+     }
+   while (!__atomic_compare_exchange_n(&job->next, &s, e, EINA_TRUE,
+                                       __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+#else
+   eina_spinlock_take(&_eina_parallel_claim_lock);
+   s = job->next;
+   e = (job->end - s > job->grain) ? s + job->grain : job->end;
+   job->next = e;
+   eina_spinlock_release(&_eina_parallel_claim_lock);
+   if (s >= e) return EINA_FALSE;
+#endif
+
+   *start = s;
+   *end = e;
+   return EINA_TRUE;
+}
+
+static void
+_eina_parallel_job_work(Eina_Parallel_Job *job, void *result)
+{
+   unsigned int start, end;
+
+   while (_eina_parallel_claim(job, &start, &end))
+     {
+        if (job->reduce)
+          job->reduce((void *)job->data, start, end, result);
+        else
+          job->cb((void *)job->data, start, end);
+     }
+}
+
+static void *
+_eina_parallel_worker(void *data EINA_UNUSED, Eina_Thread t EINA_UNUSED)
+{
+   eina_lock_take(&_eina_parallel_lock);
+   while (!_eina_parallel_exit)
+     {
+        Eina_Parallel_Job *job, *found = NULL;
+        void *result = NULL;
+
+        EINA_INLIST_FOREACH(_eina_parallel_jobs, job)
+          {
+             if (_eina_parallel_next_get(job) >= job->end) continue;
+             if (job->reduce)
+               {
+                  if (job->slots_used >= job->slots_max) continue;
+                  result = job->slots + job->stride * job->slots_used++;
+                  memcpy(result, job->slots, job->size);
+               }
+             found = job;
+             break;
+          }
+
+        if (!found)
+          {
+             _eina_parallel_idle++;
+             eina_condition_wait(&_eina_parallel_cond);
+             _eina_parallel_idle--;
+             continue;
+          }
+
+        found->helpers++;
+        eina_lock_release(&_eina_parallel_lock);
+
+        _eina_parallel_job_work(found, result);
+
+        eina_lock_take(&_eina_parallel_lock);
+        if (!--found->helpers)
+          eina_condition_broadcast(&_eina_parallel_done);
+     }
+   eina_lock_release(&_eina_parallel_lock);
+
+   return NULL;
+}
+
+// called with the lock held
+static void
+_eina_parallel_start(void)
+{
+   unsigned int i;
+
+   _eina_parallel_started = EINA_TRUE;
+   for (i = 0; i < _eina_parallel_workers_max; i++)
+     {
+        if (!eina_thread_create(&_eina_parallel_workers[i],
+                                EINA_THREAD_NORMAL, -1,
+                                _eina_parallel_worker, NULL))
+          break;
+        eina_thread_name_set(_eina_parallel_workers[i], "Eparallel");
+     }
+   _eina_parallel_workers_count = i;
+}
+
+static void
+_eina_parallel_run(Eina_Parallel_Job *job, void *result)
+{
+   unsigned int chunks, i;
+
+   eina_lock_take(&_eina_parallel_lock);
+   if (!_eina_parallel_started) _eina_parallel_start();
+
+   // the newest job goes first, if it is a nested loop the thread waiting
+   // on it is one of ours
+   _eina_parallel_jobs = eina_inlist_prepend(_eina_parallel_jobs,
+                                             EINA_INLIST_GET(job));
+
+   // only wake up as many workers as there is work for
+   chunks = (job->end - job->next - 1) / job->grain;
+   if (chunks >= _eina_parallel_idle)
+     eina_condition_broadcast(&_eina_parallel_cond);
+   else
+     for (i = 0; i < chunks; i++)
+       eina_condition_signal(&_eina_parallel_cond);
+   eina_lock_release(&_eina_parallel_lock);
+
+   _eina_parallel_job_work(job, result);
+
+   eina_lock_take(&_eina_parallel_lock);
+   _eina_parallel_jobs = eina_inlist_remove(_eina_parallel_jobs,
+                                            EINA_INLIST_GET(job));
+   while (job->helpers)
+     eina_condition_wait(&_eina_parallel_done);
+   eina_lock_release(&_eina_parallel_lock);
+}
+
+static inline unsigned int
+_eina_parallel_grain(unsigned int start, unsigned int end, unsigned int grain)
+{
+   if (grain) return grain;
+
+   // a few chunks per thread so that a slow one does not hold the others
+   grain = (end - start) / ((_eina_parallel_workers_max + 1) * 4);
+   return grain ? grain : 1;
+}
+
+Eina_Bool
+eina_parallel_init(void)
+{
+   const char *s;
+   int threads;
+
+   threads = eina_cpu_count();
+   s = getenv("EINA_PARALLEL_THREADS");
+   if (s && (atoi(s) > 0)) threads = atoi(s);
+   if (threads > THREADS_MAX) threads = THREADS_MAX;
+   if (threads < 1) threads = 1;
+   _eina_parallel_workers_max = threads - 1;
+
+   _eina_parallel_exit = EINA_FALSE;
+   _eina_parallel_started = EINA_FALSE;
+   _eina_parallel_workers_count = 0;
+
+   if (!eina_lock_new(&_eina_parallel_lock)) return EINA_FALSE;
+   if (!eina_condition_new(&_eina_parallel_cond, &_eina_parallel_lock))
+     goto on_cond_error;
+   if (!eina_condition_new(&_eina_parallel_done, &_eina_parallel_lock))
+     goto on_done_error;
+#ifndef ATOMIC
+   if (!eina_spinlock_new(&_eina_parallel_claim_lock))
+     goto on_claim_error;
+#endif
+
+   return EINA_TRUE;
+
+#ifndef ATOMIC
+ on_claim_error:
+   eina_condition_free(&_eina_parallel_done);
+#endif
+ on_done_error:
+   eina_condition_free(&_eina_parallel_cond);
+ on_cond_error:
+   eina_lock_free(&_eina_parallel_lock);
+   return EINA_FALSE;
+}
+
+Eina_Bool
+eina_parallel_shutdown(void)
+{
+   unsigned int i;
+
+   eina_lock_take(&_eina_parallel_lock);
+   _eina_parallel_exit = EINA_TRUE;
+   eina_condition_broadcast(&_eina_parallel_cond);
+   eina_lock_release(&_eina_parallel_lock);
+
+   for (i = 0; i < _eina_parallel_workers_count; i++)
+     eina_thread_join(_eina_parallel_workers[i]);
+   _eina_parallel_workers_count = 0;
+
+#ifndef ATOMIC
+   eina_spinlock_free(&_eina_parallel_claim_lock);
+#endif
+   eina_condition_free(&_eina_parallel_done);
+   eina_condition_free(&_eina_parallel_cond);
+   eina_lock_free(&_eina_parallel_lock);
+
+   return EINA_TRUE;
+}
+
+EAPI void
+eina_parallel_for(unsigned int start, unsigned int end, unsigned int grain,
+                  Eina_Parallel_Range_Cb cb, const void *data)
+{
+   Eina_Parallel_Job job;
+
+   EINA_SAFETY_ON_NULL_RETURN(cb);
+   if (start >= end) return;
+
+   grain = _eina_parallel_grain(start, end, grain);
+   if ((!_eina_parallel_workers_max) || (end - start <= grain))
+     {
+        cb((void *)data, start, end);
+        return;
+     }
+
+   memset(&job, 0, sizeof (job));
+   job.cb = cb;
+   job.data = data;
+   job.next = start;
+   job.end = end;
+   job.grain = grain;
+
+   _eina_parallel_run(&job, NULL);
+}
+
+EAPI void
+eina_parallel_reduce(unsigned int start, unsigned int end, unsigned int grain,
+                     Eina_Parallel_Reduce_Cb cb, Eina_Parallel_Join_Cb join,
+                     void *result, unsigned int result_size,
+                     const void *data)
+{
+   union {
+      unsigned char bytes[REDUCE_BUFFER];
+      long double ld;
+      void *ptr;
+   } slots;
+   Eina_Parallel_Job job;
+   unsigned int i;
+
+   EINA_SAFETY_ON_NULL_RETURN(cb);
+   EINA_SAFETY_ON_NULL_RETURN(join);
+   EINA_SAFETY_ON_NULL_RETURN(result);
+   EINA_SAFETY_ON_FALSE_RETURN(result_size > 0);
+   EINA_SAFETY_ON_FALSE_RETURN(result_size <= REDUCE_BUFFER / 2);
+   if (start >= end) return;
+
+   grain = _eina_parallel_grain(start, end, grain);
+   if ((!_eina_parallel_workers_max) || (end - start <= grain))
+     {
+        cb((void *)data, start, end, result);
+        return;
+     }
+
+   memset(&job, 0, sizeof (job));
+   job.reduce = cb;
+   job.data = data;
+   job.next = start;
+   job.end = end;
+   job.grain = grain;
+   job.slots = slots.bytes;
+   job.size = result_size;
+   job.stride = (result_size + 15) & ~15;
+   job.slots_max = REDUCE_BUFFER / job.stride;
+   job.slots_used = 1;
+   memcpy(slots.bytes, result, result_size);
+
+   // the caller accumulates straight into result
+   _eina_parallel_run(&job, result);
+
+   for (i = 1; i < job.slots_used; i++)
+     join((void *)data, result, slots.bytes + job.stride * i);
+}
+
+EAPI unsigned int
+eina_parallel_threads_get(void)
+{
+   return _eina_parallel_workers_max + 1;
+}
@@ -0,0 +1,111 @@
+#ifndef EINA_PARALLEL_H_
+#define EINA_PARALLEL_H_
+
+#include "eina_types.h"
+
+/**
+ * @defgroup Eina_Parallel_Group Parallel loops
+ * @ingroup Eina_Tools_Group
+ *
+ * @brief Split a loop over an index range between the CPUs.
+ *
+ * The range is cut in chunks of @c grain indexes that are handed to a
+ * pool of worker threads sized from eina_cpu_count(). The calling thread
+ * works on the range too and the call only returns when the whole range
+ * has been processed, so the callbacks can use memory living on the
+ * caller's stack. The pool is started on first use and then kept around,
+ * a call does not allocate any memory.
+ *
+ * Calls can be nested: a callback can itself call eina_parallel_for() and
+ * the threads that are idle will help with the inner loop.
+ *
+ * The callbacks run in parallel on different parts of the range, they
+ * must not touch data shared between chunks without locking. Setting the
+ * environment variable @c EINA_PARALLEL_THREADS limits the number of
+ * threads working on a loop, the caller included.
+ *
+ * @{
+ */
+
+/**
+ * @typedef Eina_Parallel_Range_Cb
+ * @brief Process the indexes from @p start to @p end (excluded).
+ *
+ * @since 1.22
+ */
+typedef void (*Eina_Parallel_Range_Cb)(void *data, unsigned int start, unsigned int end);
+
+/**
+ * @typedef Eina_Parallel_Reduce_Cb
+ * @brief Accumulate the indexes from @p start to @p end (excluded) in
+ * @p result.
+ *
+ * @since 1.22
+ */
+typedef void (*Eina_Parallel_Reduce_Cb)(void *data, unsigned int start, unsigned int end, void *result);
+
+/**
+ * @typedef Eina_Parallel_Join_Cb
+ * @brief Merge the partial result @p other in @p result.
+ *
+ * @since 1.22
+ */
+typedef void (*Eina_Parallel_Join_Cb)(void *data, void *result, const void *other);
+
+/**
+ * @brief Run @p cb over a range, in parallel.
+ *
+ * @param[in] start The first index of the range.
+ * @param[in] end The index after the last one of the range.
+ * @param[in] grain The number of indexes given to @p cb at once, @c 0 to
+ *            let Eina pick one.
+ * @param[in] cb The callback processing a part of the range.
+ * @param[in] data The data given to @p cb.
+ *
+ * Small ranges, or a process that can only use one CPU, are run directly
+ * by the calling thread.
+ *
+ * @since 1.22
+ */
+EAPI void eina_parallel_for(unsigned int start, unsigned int end, unsigned int grain,
+                            Eina_Parallel_Range_Cb cb, const void *data);
+
+/**
+ * @brief Reduce a range to a single value, in parallel.
+ *
+ * @param[in] start The first index of the range.
+ * @param[in] end The index after the last one of the range.
+ * @param[in] grain The number of indexes given to @p cb at once, @c 0 to
+ *            let Eina pick one.
+ * @param[in] cb The callback accumulating a part of the range.
+ * @param[in] join The callback merging two partial results.
+ * @param[in,out] result The identity value of the reduction on input, the
+ *                result on output.
+ * @param[in] result_size The size of @p result, at most 512 bytes.
+ * @param[in] data The data given to @p cb and @p join.
+ *
+ * Each thread starts from a copy of the value in @p result and the
+ * partial results are merged with @p join at the end, in no particular
+ * order: the reduction must be associative and commutative.
+ *
+ * @since 1.22
+ */
+EAPI void eina_parallel_reduce(unsigned int start, unsigned int end, unsigned int grain,
+                               Eina_Parallel_Reduce_Cb cb, Eina_Parallel_Join_Cb join,
+                               void *result, unsigned int result_size,
+                               const void *data);
+
+/**
+ * @brief Get the number of threads that can work on a loop.
+ *
+ * @return The number of threads, the caller included.
+ *
+ * @since 1.22
+ */
+EAPI unsigned int eina_parallel_threads_get(void);
+
+/**
+ * @}
+ */
+
+#endif
@@ -28,9 +28,15 @@
 # include <errno.h>
 #endif
 
+#include "eina_config.h"
 #include "eina_sched.h"
 #include "eina_log.h"
 
+#if defined(EINA_HAVE_PTHREAD_AFFINITY) && !defined(__linux__)
+# include <pthread_np.h>
+# define cpu_set_t cpuset_t
+#endif
+
 #define RTNICENESS 1
 #define NICENESS 5
 
@@ -82,3 +88,37 @@ eina_sched_prio_drop(void)
      }
 # endif
 }
+
+EAPI Eina_Bool
+eina_sched_affinity_set(int cpu)
+{
+#ifdef EINA_HAVE_PTHREAD_AFFINITY
+   cpu_set_t set;
+   int ret;
+
+   CPU_ZERO(&set);
+   if (cpu >= 0)
+     {
+        if (cpu >= CPU_SETSIZE) return EINA_FALSE;
+        CPU_SET(cpu, &set);
+     }
+   else
+     {
+        int i;
+
+        for (i = 0; i < CPU_SETSIZE; i++)
+          CPU_SET(i, &set);
+     }
+
+   ret = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+   if (ret)
+     {
+        EINA_LOG_DBG("Unable to set the affinity of the thread to cpu %i", cpu);
+        return EINA_FALSE;
+     }
+   return EINA_TRUE;
+#else
+   (void)cpu;
+   return EINA_FALSE;
+#endif
+}
@@ -46,6 +46,19 @@
  */
 EAPI void eina_sched_prio_drop(void);
 
+/**
+ * @brief Binds the current thread to a CPU.
+ * @details Worker threads use it to keep a job close to the data it works
+ *          on. Passing @c -1 lets the thread run on every CPU again.
+ *
+ * @param[in] cpu The CPU to run on, or @c -1 for no affinity
+ * @return #EINA_TRUE on success, #EINA_FALSE if the system does not
+ *         support it or refused it
+ *
+ * @since 1.22
+ */
+EAPI Eina_Bool eina_sched_affinity_set(int cpu);
+
 /**
  * @}
  */
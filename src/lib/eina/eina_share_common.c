@@ -98,6 +98,10 @@ extern int _eina_share_stringshare_log_dom;
 #define EINA_SHARE_COMMON_BUCKET_IDX(h) ((h >> 8) & EINA_SHARE_COMMON_MASK)
 #define EINA_SHARE_COMMON_NODE_HASH(h) (h & EINA_SHARE_COMMON_MASK)
 
+#ifdef __ATOMIC_RELAXED
+#define ATOMIC 1
+#endif
+
 static const char EINA_MAGIC_SHARE_STR[] = "Eina Share";
 static const char EINA_MAGIC_SHARE_HEAD_STR[] = "Eina Share Head";
 
@@ -132,6 +136,7 @@ struct _Eina_Share_Common_Population
 #endif
 
 typedef struct _Eina_Share_Common Eina_Share_Common;
+typedef struct _Eina_Share_Common_Bucket Eina_Share_Common_Bucket;
 typedef struct _Eina_Share_Common_Node Eina_Share_Common_Node;
 typedef struct _Eina_Share_Common_Head Eina_Share_Common_Head;
 
@@ -146,9 +151,17 @@ struct _Eina_Share
 #endif
 };
 
+/* Every bucket has its own lock, so threads adding or removing strings
+ * only contend when their strings hash to the same bucket. */
+struct _Eina_Share_Common_Bucket
+{
+   Eina_Share_Common_Head *head;
+   Eina_Spinlock lock;
+};
+
 struct _Eina_Share_Common
 {
-   Eina_Share_Common_Head *buckets[EINA_SHARE_COMMON_BUCKETS];
+   Eina_Share_Common_Bucket buckets[EINA_SHARE_COMMON_BUCKETS];
 
    EINA_MAGIC
 };
@@ -181,6 +194,8 @@ struct _Eina_Share_Common_Head
 
 Eina_Bool _share_common_threads_activated = EINA_FALSE;
 
+/* Only protects the population statistics, the strings themselves are
+ * protected by their bucket lock. */
 static Eina_Spinlock _mutex_big;
 
 #ifdef EINA_STRINGSHARE_USAGE
@@ -312,15 +327,9 @@ static void _eina_share_common_population_shutdown(EINA_UNUSED Eina_Share *share
 }
 static void _eina_share_common_population_stats(EINA_UNUSED Eina_Share *share) {
 }
-static void eina_share_common_population_nolock_add(EINA_UNUSED Eina_Share *share,
-                                                    EINA_UNUSED int slen) {
-}
 void eina_share_common_population_add(EINA_UNUSED Eina_Share *share,
                                       EINA_UNUSED int slen) {
 }
-static void eina_share_common_population_nolock_del(EINA_UNUSED Eina_Share *share,
-                                                    EINA_UNUSED int slen) {
-}
 void eina_share_common_population_del(EINA_UNUSED Eina_Share *share,
                                       EINA_UNUSED int slen) {
 }
@@ -340,6 +349,45 @@ static void _eina_share_common_population_head_del(
 }
 #endif
 
+static inline void
+_eina_share_common_node_ref(Eina_Share_Common_Node *node)
+{
+#ifdef ATOMIC
+   __atomic_add_fetch(&node->references, 1, __ATOMIC_RELAXED);
+#else
+   node->references++;
+#endif
+}
+
+#ifdef ATOMIC
+/* Drops a reference as long as it isn't the last one. Safe without any lock
+ * as the caller owns one of the references, so the node can't go away. */
+static inline Eina_Bool
+_eina_share_common_node_unref_fast(Eina_Share_Common_Node *node)
+{
+   unsigned int refs = __atomic_load_n(&node->references, __ATOMIC_RELAXED);
+
+   while (refs > 1)
+     {
+        if (__atomic_compare_exchange_n(&node->references, &refs, refs - 1,
+                                        EINA_TRUE, __ATOMIC_RELEASE,
+                                        __ATOMIC_RELAXED))
+          return EINA_TRUE;
+     }
+   return EINA_FALSE;
+}
+#endif
+
+static inline unsigned int
+_eina_share_common_node_unref(Eina_Share_Common_Node *node)
+{
+#ifdef ATOMIC
+   return __atomic_sub_fetch(&node->references, 1, __ATOMIC_ACQ_REL);
+#else
+   return --node->references;
+#endif
+}
+
 static int
 _eina_share_common_cmp(const Eina_Share_Common_Head *ed,
                        const int *hash,
@@ -610,6 +658,7 @@ eina_share_common_init(Eina_Share **_share,
                        const char *node_magic_STR)
 {
    Eina_Share *share;
+   unsigned int i;
 
    share = *_share = calloc(1, sizeof(Eina_Share));
    if (!share) goto on_error;
@@ -625,6 +674,9 @@ eina_share_common_init(Eina_Share **_share,
 #undef EMS
    EINA_MAGIC_SET(share->share, EINA_MAGIC_SHARE);
 
+   for (i = 0; i < EINA_SHARE_COMMON_BUCKETS; i++)
+     eina_spinlock_new(&share->share->buckets[i].lock);
+
    _eina_share_common_population_init(share);
 
    /* below is the common part among other all eina_share_common user */
@@ -663,11 +715,15 @@ eina_share_common_shutdown(Eina_Share **_share)
    /* remove any string still in the table */
    for (i = 0; i < EINA_SHARE_COMMON_BUCKETS; i++)
      {
-        eina_rbtree_delete(EINA_RBTREE_GET(
-                              share->share->buckets[i]),
+        Eina_Share_Common_Bucket *bucket = share->share->buckets + i;
+
+        eina_spinlock_take(&bucket->lock);
+        eina_rbtree_delete(EINA_RBTREE_GET(bucket->head),
                            EINA_RBTREE_FREE_CB(
                               _eina_share_common_head_free), NULL);
-        share->share->buckets[i] = NULL;
+        bucket->head = NULL;
+        eina_spinlock_release(&bucket->lock);
+        eina_spinlock_free(&bucket->lock);
      }
    MAGIC_FREE(share->share);
 
@@ -735,7 +791,8 @@ eina_share_common_add_length(Eina_Share *share,
                              unsigned int slen,
                              unsigned int null_size)
 {
-   Eina_Share_Common_Head **p_bucket, *ed;
+   Eina_Share_Common_Bucket *bucket;
+   Eina_Share_Common_Head *ed;
    Eina_Share_Common_Node *el;
    int hash;
 
@@ -749,39 +806,39 @@ eina_share_common_add_length(Eina_Share *share,
 
    hash = eina_hash_superfast(str, slen);
 
-   eina_spinlock_take(&_mutex_big);
-   p_bucket = share->share->buckets + EINA_SHARE_COMMON_BUCKET_IDX(hash);
+   bucket = share->share->buckets + EINA_SHARE_COMMON_BUCKET_IDX(hash);
+   eina_spinlock_take(&bucket->lock);
 
-   ed = _eina_share_common_find_hash(*p_bucket, EINA_SHARE_COMMON_NODE_HASH(hash));
+   ed = _eina_share_common_find_hash(bucket->head, EINA_SHARE_COMMON_NODE_HASH(hash));
    if (!ed)
      {
         const char *s = _eina_share_common_add_head(share,
-                                                    p_bucket,
+                                                    &bucket->head,
                                                     hash,
                                                     str,
                                                     slen,
                                                     null_size);
-        eina_spinlock_release(&_mutex_big);
+        eina_spinlock_release(&bucket->lock);
         return s;
      }
 
-   EINA_MAGIC_CHECK_SHARE_COMMON_HEAD(ed, eina_spinlock_release(&_mutex_big), NULL);
+   EINA_MAGIC_CHECK_SHARE_COMMON_HEAD(ed, eina_spinlock_release(&bucket->lock), NULL);
 
    el = _eina_share_common_head_find(ed, str, slen);
    if (el)
      {
         EINA_MAGIC_CHECK_SHARE_COMMON_NODE
           (el, share->node_magic,
-           eina_spinlock_release(&_mutex_big); return NULL);
-        el->references++;
-        eina_spinlock_release(&_mutex_big);
+           eina_spinlock_release(&bucket->lock); return NULL);
+        _eina_share_common_node_ref(el);
+        eina_spinlock_release(&bucket->lock);
         return el->str;
      }
 
    el = _eina_share_common_node_alloc(slen, null_size);
    if (!el)
      {
-                                           eina_spinlock_release(&_mutex_big);
+        eina_spinlock_release(&bucket->lock);
         return NULL;
      }
 
@@ -790,7 +847,7 @@ eina_share_common_add_length(Eina_Share *share,
    ed->head = el;
    _eina_share_common_population_head_add(share, ed);
 
-   eina_spinlock_release(&_mutex_big);
+   eina_spinlock_release(&bucket->lock);
 
    return el->str;
 }
@@ -803,18 +860,28 @@ eina_share_common_ref(Eina_Share *share, const char *str)
    if (!str)
       return NULL;
 
-   eina_spinlock_take(&_mutex_big);
    node = _eina_share_common_node_from_str(str, share->node_magic);
    if (!node)
-     {
-        eina_spinlock_release(&_mutex_big);
-        return str;
-     }
-   node->references++;
-
-   eina_share_common_population_nolock_add(share, node->length);
+     return str;
+
+#ifdef ATOMIC
+   /* The caller owns a reference, so the node is alive and only its
+    * reference counter needs to be updated. */
+   _eina_share_common_node_ref(node);
+#else
+   {
+      Eina_Share_Common_Bucket *bucket;
+      int hash;
+
+      hash = eina_hash_superfast(node->str, node->length);
+      bucket = share->share->buckets + EINA_SHARE_COMMON_BUCKET_IDX(hash);
+      eina_spinlock_take(&bucket->lock);
+      _eina_share_common_node_ref(node);
+      eina_spinlock_release(&bucket->lock);
+   }
+#endif
 
-   eina_spinlock_release(&_mutex_big);
+   eina_share_common_population_add(share, node->length);
 
    return str;
 }
@@ -824,35 +891,43 @@ Eina_Bool
 eina_share_common_del(Eina_Share *share, const char *str)
 {
    unsigned int slen;
+   Eina_Share_Common_Bucket *bucket;
    Eina_Share_Common_Head *ed;
-   Eina_Share_Common_Head **p_bucket;
    Eina_Share_Common_Node *node;
+   int hash;
 
    if (!str)
       return EINA_TRUE;
 
-   eina_spinlock_take(&_mutex_big);
-
    node = _eina_share_common_node_from_str(str, share->node_magic);
    if (!node)
-      goto on_error;
+      return EINA_FALSE;
 
    slen = node->length;
-   eina_share_common_population_nolock_del(share, slen);
-   if (node->references > 1)
+   eina_share_common_population_del(share, slen);
+
+#ifdef ATOMIC
+   if (_eina_share_common_node_unref_fast(node))
+     return EINA_TRUE;
+#endif
+
+   /* Possibly the last reference, the bucket has to be locked before
+    * dropping it, as a concurrent add could be resurrecting the string. */
+   hash = eina_hash_superfast(node->str, slen);
+   bucket = share->share->buckets + EINA_SHARE_COMMON_BUCKET_IDX(hash);
+   eina_spinlock_take(&bucket->lock);
+
+   if (_eina_share_common_node_unref(node) > 0)
      {
-        node->references--;
-        eina_spinlock_release(&_mutex_big);
+        eina_spinlock_release(&bucket->lock);
         return EINA_TRUE;
      }
 
-   node->references = 0;
-
    ed = _eina_share_common_head_from_node(node);
    if (!ed)
       goto on_error;
 
-   EINA_MAGIC_CHECK_SHARE_COMMON_HEAD(ed, eina_spinlock_release(&_mutex_big), EINA_FALSE);
+   EINA_MAGIC_CHECK_SHARE_COMMON_HEAD(ed, eina_spinlock_release(&bucket->lock), EINA_FALSE);
 
    if (node != &ed->builtin_node)
      {
@@ -862,19 +937,16 @@ eina_share_common_del(Eina_Share *share, const char *str)
      }
 
    if (!ed->head || ed->head->references == 0)
-     {
-        p_bucket = share->share->buckets + EINA_SHARE_COMMON_BUCKET_IDX(ed->hash);
-        _eina_share_common_del_head(p_bucket, ed);
-     }
+     _eina_share_common_del_head(&bucket->head, ed);
    else
       _eina_share_common_population_head_del(share, ed);
 
-   eina_spinlock_release(&_mutex_big);
+   eina_spinlock_release(&bucket->lock);
 
    return EINA_TRUE;
 
 on_error:
-   eina_spinlock_release(&_mutex_big);
+   eina_spinlock_release(&bucket->lock);
    /* possible segfault happened before here, but... */
    return EINA_FALSE;
 }
@@ -908,19 +980,24 @@ eina_share_common_dump(Eina_Share *share, void (*additional_dump)(
    di.dups = 0;
    di.unique = 0;
 
-   eina_spinlock_take(&_mutex_big);
    for (i = 0; i < EINA_SHARE_COMMON_BUCKETS; i++)
      {
-        if (!share->share->buckets[i])
+        Eina_Share_Common_Bucket *bucket = share->share->buckets + i;
+
+        eina_spinlock_take(&bucket->lock);
+        if (!bucket->head)
           {
+             eina_spinlock_release(&bucket->lock);
              continue;
           }
 
-        it = eina_rbtree_iterator_prefix(
-              (Eina_Rbtree *)share->share->buckets[i]);
+        it = eina_rbtree_iterator_prefix((Eina_Rbtree *)bucket->head);
         eina_iterator_foreach(it, EINA_EACH_CB(eina_iterator_array_check), &di);
         eina_iterator_free(it);
+        eina_spinlock_release(&bucket->lock);
      }
+
+   eina_spinlock_take(&_mutex_big);
    if (additional_dump)
       additional_dump(&di);
 
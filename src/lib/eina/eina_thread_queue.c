@@ -34,6 +34,8 @@
 #endif
 
 typedef struct _Eina_Thread_Queue_Msg_Block Eina_Thread_Queue_Msg_Block;
+typedef struct _Eina_Thread_Queue_Ring Eina_Thread_Queue_Ring;
+typedef struct _Eina_Thread_Queue_Cell Eina_Thread_Queue_Cell;
 
 struct _Eina_Thread_Queue
 {
@@ -49,6 +51,7 @@ struct _Eina_Thread_Queue
 #endif
    int                           pending; // how many messages left to read
    int                           fd; // optional fd to write byte to on msg
+   Eina_Thread_Queue_Ring       *ring; // bounded ring instead of blocks
 };
 
 struct _Eina_Thread_Queue_Msg_Block
@@ -67,6 +70,41 @@ struct _Eina_Thread_Queue_Msg_Block
    Eina_Thread_Queue_Msg         data[1]; // data in memory beyond struct end
 };
 
+#ifdef ATOMIC
+// a bounded ring of fixed size cells for many writers and many readers.
+// every cell carries a sequence number telling who may touch it next: a
+// writer at position pos may claim it when seq == pos, a reader when
+// seq == pos + 1, and the reader hands it back for the next round with
+// seq == pos + mask + 1. the positions are only moved with a cas so no
+// lock is taken unless a thread has to sleep on a full or empty ring.
+#define CACHE_LINE 64
+
+struct _Eina_Thread_Queue_Cell
+{
+   unsigned int                  seq; // position this cell is ready for
+   int                           pad;
+   Eina_Thread_Queue_Msg         data[1]; // message, 8 byte aligned
+};
+
+struct _Eina_Thread_Queue_Ring
+{
+   unsigned char                *cells; // cache line aligned cell array
+   void                         *mem; // what was allocated for cells
+   unsigned int                  mask; // number of cells - 1
+   int                           stride; // bytes from one cell to the next
+   int                           size; // biggest message a cell holds
+   Eina_Semaphore                sem_space; // writers sleeping on a full ring
+   // writers and readers each get their own cache line
+   char                          pad0[CACHE_LINE];
+   unsigned int                  write_pos;
+   int                           write_waiters;
+   char                          pad1[CACHE_LINE];
+   unsigned int                  read_pos;
+   int                           read_waiters;
+   char                          pad2[CACHE_LINE];
+};
+#endif
+
 // the minimum size of any message block holding 1 or more messages
 #define MIN_SIZE ((int)(4096 - sizeof(Eina_Thread_Queue_Msg_Block) + sizeof(Eina_Thread_Queue_Msg)))
 
@@ -172,6 +210,48 @@ _eina_thread_queue_wake(Eina_Thread_Queue *thq)
      ERR("Thread queue semaphore release/wakeup faile - bad things will happen");
 }
 
+static void
+_eina_thread_queue_wake_many(Eina_Thread_Queue *thq, int count)
+{
+   // eina_semaphore_release() ignores its count, post once per message
+   while (count-- > 0) _eina_thread_queue_wake(thq);
+}
+
+// tell the parent queue and the fd about count new messages
+static void
+_eina_thread_queue_notify(Eina_Thread_Queue *thq, int count)
+{
+   if (thq->parent)
+     {
+        Eina_Thread_Queue_Msg_Sub msgs[64];
+        int i, n;
+
+        for (i = 0; i < (int)EINA_C_ARRAY_LENGTH(msgs); i++)
+          msgs[i].queue = thq;
+        for (i = 0; i < count; i += n)
+          {
+             n = MIN(count - i, (int)EINA_C_ARRAY_LENGTH(msgs));
+             eina_thread_queue_send_batch(thq->parent, msgs,
+                                          sizeof(Eina_Thread_Queue_Msg_Sub), n);
+          }
+     }
+   if (thq->fd >= 0)
+     {
+        char dummy[64] = { 0 };
+        int n;
+
+        for (; count > 0; count -= n)
+          {
+             n = MIN(count, (int)sizeof(dummy));
+             if (write(thq->fd, dummy, n) != n)
+               {
+                  ERR("Eina Threadqueue write to fd %i failed", thq->fd);
+                  break;
+               }
+          }
+     }
+}
+
 // how to allocate or release memory within one of the message blocks for
 // an arbitrary sized bit of message data. the size always includes the
 // message header which tells you the size of that message
@@ -318,6 +398,187 @@ _eina_thread_queue_msg_fetch_done(Eina_Thread_Queue_Msg_Block *blk)
      _eina_thread_queue_msg_block_free(blk);
 }
 
+#ifdef ATOMIC
+static inline Eina_Thread_Queue_Cell *
+_eina_thread_queue_ring_cell(Eina_Thread_Queue_Ring *ring, unsigned int pos)
+{
+   return (Eina_Thread_Queue_Cell *)(ring->cells + (size_t)(pos & ring->mask) * ring->stride);
+}
+
+// claim up to max cells in a row that are ready for a writer (write is
+// EINA_TRUE) or for a reader, returns how many were claimed from *start
+static int
+_eina_thread_queue_ring_claim(Eina_Thread_Queue_Ring *ring, Eina_Bool write,
+                              int max, unsigned int *start)
+{
+   unsigned int *ppos = write ? &(ring->write_pos) : &(ring->read_pos);
+   unsigned int pos, seq;
+   int n, diff = 0;
+
+   pos = __atomic_load_n(ppos, __ATOMIC_RELAXED);
+   for (;;)
+     {
+        for (n = 0; n < max; n++)
+          {
+             seq = __atomic_load_n(&(_eina_thread_queue_ring_cell(ring, pos + n)->seq),
+                                   __ATOMIC_ACQUIRE);
+             diff = (int)(seq - (pos + n + !write));
+             if (diff != 0) break;
+          }
+        if (n == 0)
+          {
+             // full for a writer or empty for a reader
+             if (diff < 0) return 0;
+             // someone else took this position, look again
+             pos = __atomic_load_n(ppos, __ATOMIC_RELAXED);
+             continue;
+          }
+        if (__atomic_compare_exchange_n(ppos, &pos, pos + n, EINA_TRUE,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+          break;
+     }
+   *start = pos;
+   return n;
+}
+
+// sleep until the other side moved, waiters is how it knows we sleep
+static Eina_Bool
+_eina_thread_queue_ring_sleep(Eina_Thread_Queue_Ring *ring, Eina_Semaphore *sem,
+                              int *waiters, Eina_Bool write)
+{
+   unsigned int pos, seq;
+   Eina_Bool ret = EINA_TRUE;
+
+   __atomic_add_fetch(waiters, 1, __ATOMIC_SEQ_CST);
+   __atomic_thread_fence(__ATOMIC_SEQ_CST);
+   // look once more now that we are visible, so a wakeup can not be lost
+   pos = __atomic_load_n(write ? &(ring->write_pos) : &(ring->read_pos),
+                         __ATOMIC_RELAXED);
+   seq = __atomic_load_n(&(_eina_thread_queue_ring_cell(ring, pos)->seq),
+                         __ATOMIC_ACQUIRE);
+   if ((int)(seq - (pos + !write)) < 0)
+     ret = eina_semaphore_lock(sem);
+   __atomic_sub_fetch(waiters, 1, __ATOMIC_SEQ_CST);
+   return ret;
+}
+
+static void
+_eina_thread_queue_ring_wake(Eina_Semaphore *sem, int *waiters, int count)
+{
+   int n;
+
+   __atomic_thread_fence(__ATOMIC_SEQ_CST);
+   n = __atomic_load_n(waiters, __ATOMIC_SEQ_CST);
+   // a thread that woke up with nothing to do will just sleep again
+   for (n = MIN(n, count); n > 0; n--)
+     eina_semaphore_release(sem, 1);
+}
+
+static Eina_Thread_Queue_Ring *
+_eina_thread_queue_ring_new(int slots, int size)
+{
+   Eina_Thread_Queue_Ring *ring;
+   unsigned int count, i;
+
+   ring = calloc(1, sizeof(Eina_Thread_Queue_Ring));
+   if (!ring) return NULL;
+
+   for (count = 2; count < (unsigned int)slots; count <<= 1);
+   ring->mask = count - 1;
+   ring->size = ((size + 7) >> 3) << 3;
+   ring->stride = offsetof(Eina_Thread_Queue_Cell, data) + ring->size;
+   ring->stride = ((ring->stride + CACHE_LINE - 1) / CACHE_LINE) * CACHE_LINE;
+
+   ring->mem = malloc((size_t)count * ring->stride + CACHE_LINE);
+   if (!ring->mem) goto on_error;
+   ring->cells = (unsigned char *)
+     (((uintptr_t)ring->mem + CACHE_LINE - 1) & ~(uintptr_t)(CACHE_LINE - 1));
+   for (i = 0; i < count; i++)
+     _eina_thread_queue_ring_cell(ring, i)->seq = i;
+
+   if (!eina_semaphore_new(&(ring->sem_space), 0)) goto on_error;
+   return ring;
+
+ on_error:
+   free(ring->mem);
+   free(ring);
+   return NULL;
+}
+
+static void
+_eina_thread_queue_ring_free(Eina_Thread_Queue_Ring *ring)
+{
+   eina_semaphore_free(&(ring->sem_space));
+   free(ring->mem);
+   free(ring);
+}
+
+// claim cells to write to, sleeping while the ring is full
+static int
+_eina_thread_queue_ring_send(Eina_Thread_Queue_Ring *ring, int max, unsigned int *start)
+{
+   int n;
+
+   while (!(n = _eina_thread_queue_ring_claim(ring, EINA_TRUE, max, start)))
+     {
+        if (!_eina_thread_queue_ring_sleep(ring, &(ring->sem_space),
+                                           &(ring->write_waiters), EINA_TRUE))
+          return 0;
+     }
+   return n;
+}
+
+static void
+_eina_thread_queue_ring_send_done(Eina_Thread_Queue *thq, unsigned int start, int count)
+{
+   Eina_Thread_Queue_Ring *ring = thq->ring;
+   int i;
+
+   for (i = 0; i < count; i++)
+     __atomic_store_n(&(_eina_thread_queue_ring_cell(ring, start + i)->seq),
+                      start + i + 1, __ATOMIC_RELEASE);
+   __atomic_add_fetch(&(thq->pending), count, __ATOMIC_RELAXED);
+   _eina_thread_queue_ring_wake(&(thq->sem), &(ring->read_waiters), count);
+   _eina_thread_queue_notify(thq, count);
+}
+
+// claim cells to read from, sleeping while the ring is empty if asked to
+static int
+_eina_thread_queue_ring_fetch(Eina_Thread_Queue *thq, int max, Eina_Bool block,
+                              unsigned int *start)
+{
+   Eina_Thread_Queue_Ring *ring = thq->ring;
+   int n;
+
+   while (!(n = _eina_thread_queue_ring_claim(ring, EINA_FALSE, max, start)))
+     {
+        if (!block) return 0;
+        if (!_eina_thread_queue_ring_sleep(ring, &(thq->sem),
+                                           &(ring->read_waiters), EINA_FALSE))
+          return 0;
+     }
+   __atomic_sub_fetch(&(thq->pending), n, __ATOMIC_RELAXED);
+   return n;
+}
+
+static void
+_eina_thread_queue_ring_fetch_done(Eina_Thread_Queue_Ring *ring, unsigned int start, int count)
+{
+   int i;
+
+   for (i = 0; i < count; i++)
+     __atomic_store_n(&(_eina_thread_queue_ring_cell(ring, start + i)->seq),
+                      start + i + ring->mask + 1, __ATOMIC_RELEASE);
+   _eina_thread_queue_ring_wake(&(ring->sem_space), &(ring->write_waiters), count);
+}
+
+// the allocref of a ring message is its cell, its position is in seq
+static inline unsigned int
+_eina_thread_queue_ring_pos(Eina_Thread_Queue_Cell *cell, Eina_Bool written)
+{
+   return __atomic_load_n(&(cell->seq), __ATOMIC_RELAXED) - written;
+}
+#endif
 
 //////////////////////////////////////////////////////////////////////////////
 Eina_Bool
@@ -374,11 +635,38 @@ eina_thread_queue_new(void)
    return thq;
 }
 
+EAPI Eina_Thread_Queue *
+eina_thread_queue_ring_new(int slots, int size)
+{
+   Eina_Thread_Queue *thq;
+
+   EINA_SAFETY_ON_TRUE_RETURN_VAL(slots < 1, NULL);
+   EINA_SAFETY_ON_TRUE_RETURN_VAL(size < (int)sizeof(Eina_Thread_Queue_Msg), NULL);
+
+   thq = eina_thread_queue_new();
+#ifdef ATOMIC
+   if (!thq) return NULL;
+   thq->ring = _eina_thread_queue_ring_new(slots, size);
+   if (!thq->ring)
+     {
+        ERR("Allocation of a thread queue ring of %i messages failed", slots);
+        eina_thread_queue_free(thq);
+        return NULL;
+     }
+#endif
+   // without atomics the block queue is still safe with many threads
+   return thq;
+}
+
 EAPI void
 eina_thread_queue_free(Eina_Thread_Queue *thq)
 {
    if (!thq) return;
 
+#ifdef ATOMIC
+   if (thq->ring) _eina_thread_queue_ring_free(thq->ring);
+#endif
+
 #ifndef ATOMIC
    eina_spinlock_free(&(thq->lock_pending));
 #endif
@@ -394,6 +682,24 @@ eina_thread_queue_send(Eina_Thread_Queue *thq, int size, void **allocref)
    Eina_Thread_Queue_Msg *msg;
    Eina_Thread_Queue_Msg_Block *blk;
 
+#ifdef ATOMIC
+   if (thq->ring)
+     {
+        Eina_Thread_Queue_Cell *cell;
+        unsigned int pos;
+
+        if (size > thq->ring->size)
+          {
+             ERR("Message of %i bytes is too big for this thread queue ring", size);
+             return NULL;
+          }
+        if (!_eina_thread_queue_ring_send(thq->ring, 1, &pos)) return NULL;
+        cell = _eina_thread_queue_ring_cell(thq->ring, pos);
+        cell->data[0].size = thq->ring->size;
+        *allocref = cell;
+        return cell->data;
+     }
+#endif
    RWLOCK_LOCK(&(thq->lock_write));
    msg = _eina_thread_queue_msg_alloc(thq, size, &blk);
    RWLOCK_UNLOCK(&(thq->lock_write));
@@ -411,27 +717,17 @@ eina_thread_queue_send(Eina_Thread_Queue *thq, int size, void **allocref)
 EAPI void
 eina_thread_queue_send_done(Eina_Thread_Queue *thq, void *allocref)
 {
-   _eina_thread_queue_msg_alloc_done(allocref);
-   _eina_thread_queue_wake(thq);
-   if (thq->parent)
-     {
-        void *ref;
-        Eina_Thread_Queue_Msg_Sub *msg;
-
-        msg = eina_thread_queue_send(thq->parent,
-                                     sizeof(Eina_Thread_Queue_Msg_Sub), &ref);
-        if (msg)
-          {
-             msg->queue = thq;
-             eina_thread_queue_send_done(thq->parent, ref);
-          }
-     }
-   if (thq->fd >= 0)
+#ifdef ATOMIC
+   if (thq->ring)
      {
-        char dummy = 0;
-        if (write(thq->fd, &dummy, 1) != 1)
-          ERR("Eina Threadqueue write to fd %i failed", thq->fd);
+        _eina_thread_queue_ring_send_done
+          (thq, _eina_thread_queue_ring_pos(allocref, EINA_FALSE), 1);
+        return;
      }
+#endif
+   _eina_thread_queue_msg_alloc_done(allocref);
+   _eina_thread_queue_wake(thq);
+   _eina_thread_queue_notify(thq, 1);
 }
 
 EAPI void *
@@ -440,6 +736,18 @@ eina_thread_queue_wait(Eina_Thread_Queue *thq, void **allocref)
    Eina_Thread_Queue_Msg *msg;
    Eina_Thread_Queue_Msg_Block *blk;
 
+#ifdef ATOMIC
+   if (thq->ring)
+     {
+        Eina_Thread_Queue_Cell *cell;
+        unsigned int pos;
+
+        if (!_eina_thread_queue_ring_fetch(thq, 1, EINA_TRUE, &pos)) return NULL;
+        cell = _eina_thread_queue_ring_cell(thq->ring, pos);
+        *allocref = cell;
+        return cell->data;
+     }
+#endif
    _eina_thread_queue_wait(thq);
    RWLOCK_LOCK(&(thq->lock_read));
    msg = _eina_thread_queue_msg_fetch(thq, &blk);
@@ -456,8 +764,16 @@ eina_thread_queue_wait(Eina_Thread_Queue *thq, void **allocref)
 }
 
 EAPI void
-eina_thread_queue_wait_done(Eina_Thread_Queue *thq EINA_UNUSED, void *allocref)
+eina_thread_queue_wait_done(Eina_Thread_Queue *thq, void *allocref)
 {
+#ifdef ATOMIC
+   if (thq->ring)
+     {
+        _eina_thread_queue_ring_fetch_done
+          (thq->ring, _eina_thread_queue_ring_pos(allocref, EINA_TRUE), 1);
+        return;
+     }
+#endif
    _eina_thread_queue_msg_fetch_done(allocref);
 }
 
@@ -467,6 +783,18 @@ eina_thread_queue_poll(Eina_Thread_Queue *thq, void **allocref)
    Eina_Thread_Queue_Msg *msg;
    Eina_Thread_Queue_Msg_Block *blk;
 
+#ifdef ATOMIC
+   if (thq->ring)
+     {
+        Eina_Thread_Queue_Cell *cell;
+        unsigned int pos;
+
+        if (!_eina_thread_queue_ring_fetch(thq, 1, EINA_FALSE, &pos)) return NULL;
+        cell = _eina_thread_queue_ring_cell(thq->ring, pos);
+        *allocref = cell;
+        return cell->data;
+     }
+#endif
    RWLOCK_LOCK(&(thq->lock_read));
    msg = _eina_thread_queue_msg_fetch(thq, &blk);
    RWLOCK_UNLOCK(&(thq->lock_read));
@@ -485,6 +813,128 @@ eina_thread_queue_poll(Eina_Thread_Queue *thq, void **allocref)
    return msg;
 }
 
+EAPI int
+eina_thread_queue_send_batch(Eina_Thread_Queue *thq, const void *msgs, int size, int count)
+{
+   const char *src = msgs;
+   int i;
+
+   EINA_SAFETY_ON_NULL_RETURN_VAL(msgs, 0);
+   EINA_SAFETY_ON_TRUE_RETURN_VAL(size < (int)sizeof(Eina_Thread_Queue_Msg), 0);
+   if (count <= 0) return 0;
+
+#ifdef ATOMIC
+   if (thq->ring)
+     {
+        Eina_Thread_Queue_Ring *ring = thq->ring;
+        unsigned int pos;
+        int n, j;
+
+        if (size > ring->size)
+          {
+             ERR("Message of %i bytes is too big for this thread queue ring", size);
+             return 0;
+          }
+        // every run of cells we get is published with a single wakeup
+        for (i = 0; i < count; i += n)
+          {
+             n = _eina_thread_queue_ring_send(ring, count - i, &pos);
+             if (!n) break;
+             for (j = 0; j < n; j++)
+               {
+                  Eina_Thread_Queue_Msg *msg = _eina_thread_queue_ring_cell(ring, pos + j)->data;
+
+                  memcpy(msg, src + (size_t)(i + j) * size, size);
+                  msg->size = ring->size;
+               }
+             _eina_thread_queue_ring_send_done(thq, pos, n);
+          }
+        return i;
+     }
+#endif
+
+   RWLOCK_LOCK(&(thq->lock_write));
+   for (i = 0; i < count; i++)
+     {
+        Eina_Thread_Queue_Msg *msg;
+        Eina_Thread_Queue_Msg_Block *blk;
+        int msize;
+
+        msg = _eina_thread_queue_msg_alloc(thq, size, &blk);
+        msize = msg->size;
+        memcpy(msg, src + (size_t)i * size, size);
+        msg->size = msize;
+        _eina_thread_queue_msg_alloc_done(blk);
+     }
+   RWLOCK_UNLOCK(&(thq->lock_write));
+#ifdef ATOMIC
+   __atomic_add_fetch(&(thq->pending), count, __ATOMIC_RELAXED);
+#else
+   eina_spinlock_take(&(thq->lock_pending));
+   thq->pending += count;
+   eina_spinlock_release(&(thq->lock_pending));
+#endif
+   _eina_thread_queue_wake_many(thq, count);
+   _eina_thread_queue_notify(thq, count);
+   return count;
+}
+
+static int
+_eina_thread_queue_fetch_batch(Eina_Thread_Queue *thq, void *msgs, int size, int max, Eina_Bool block)
+{
+   char *dst = msgs;
+   void *ref;
+   int i;
+
+   EINA_SAFETY_ON_NULL_RETURN_VAL(msgs, 0);
+   EINA_SAFETY_ON_TRUE_RETURN_VAL(size < (int)sizeof(Eina_Thread_Queue_Msg), 0);
+   if (max <= 0) return 0;
+
+#ifdef ATOMIC
+   if (thq->ring)
+     {
+        Eina_Thread_Queue_Ring *ring = thq->ring;
+        unsigned int pos;
+        int n;
+
+        n = _eina_thread_queue_ring_fetch(thq, max, block, &pos);
+        for (i = 0; i < n; i++)
+          {
+             Eina_Thread_Queue_Msg *msg = _eina_thread_queue_ring_cell(ring, pos + i)->data;
+
+             memcpy(dst + (size_t)i * size, msg, MIN(size, msg->size));
+          }
+        _eina_thread_queue_ring_fetch_done(ring, pos, n);
+        return n;
+     }
+#endif
+
+   // the block queue has to take the messages one by one
+   for (i = 0; i < max; i++)
+     {
+        Eina_Thread_Queue_Msg *msg;
+
+        if ((i == 0) && (block)) msg = eina_thread_queue_wait(thq, &ref);
+        else msg = eina_thread_queue_poll(thq, &ref);
+        if (!msg) break;
+        memcpy(dst + (size_t)i * size, msg, MIN(size, msg->size));
+        eina_thread_queue_wait_done(thq, ref);
+     }
+   return i;
+}
+
+EAPI int
+eina_thread_queue_wait_batch(Eina_Thread_Queue *thq, void *msgs, int size, int max)
+{
+   return _eina_thread_queue_fetch_batch(thq, msgs, size, max, EINA_TRUE);
+}
+
+EAPI int
+eina_thread_queue_poll_batch(Eina_Thread_Queue *thq, void *msgs, int size, int max)
+{
+   return _eina_thread_queue_fetch_batch(thq, msgs, size, max, EINA_FALSE);
+}
+
 EAPI int
 eina_thread_queue_pending_get(const Eina_Thread_Queue *thq)
 {
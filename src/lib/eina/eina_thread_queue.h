@@ -76,6 +76,27 @@ struct _Eina_Thread_Queue_Msg_Sub
 EAPI Eina_Thread_Queue *
 eina_thread_queue_new(void);
 
+/**
+ * @brief Creates a new bounded thread queue.
+ *
+ * @param[in] slots How many messages the queue can hold before senders block
+ * @param[in] size The biggest message size, in bytes, including standard header
+ * @return A valid new thread queue, or NULL on failure
+ *
+ * This creates a thread queue made of a fixed ring of @p slots messages
+ * (rounded up to a power of 2) of at most @p size bytes each. Any number
+ * of threads can send and fetch messages at the same time without taking
+ * a lock, which avoids the contention the default queue has when many
+ * threads use it. When the ring is full eina_thread_queue_send() blocks
+ * until a message is fetched, so a thread must never send to a bounded
+ * queue it is the only reader of. Sending a message bigger than @p size
+ * fails. The queue is used and freed as any other thread queue.
+ *
+ * @since 1.22
+ */
+EAPI Eina_Thread_Queue *
+eina_thread_queue_ring_new(int slots, int size);
+
 /**
  * @brief Frees a thread queue.
  *
@@ -175,6 +196,61 @@ eina_thread_queue_wait_done(Eina_Thread_Queue *thq, void *allocref) EINA_ARG_NON
 EAPI void *
 eina_thread_queue_poll(Eina_Thread_Queue *thq, void **allocref) EINA_ARG_NONNULL(1, 2);
 
+/**
+ * @brief Sends a batch of messages down a thread queue.
+ *
+ * @param[in,out] thq The thread queue to send the messages on
+ * @param[in] msgs An array of @p count messages of @p size bytes each
+ * @param[in] size The size, in bytes, of each message, including standard header
+ * @param[in] count The number of messages in @p msgs
+ * @return The number of messages sent
+ *
+ * This copies the messages into the queue as if each one was sent with
+ * eina_thread_queue_send() and eina_thread_queue_send_done(), but takes
+ * the queue locks and wakes up listeners only once for the whole batch.
+ * The size field of the message headers is filled in by the queue.
+ *
+ * @since 1.22
+ */
+EAPI int
+eina_thread_queue_send_batch(Eina_Thread_Queue *thq, const void *msgs, int size, int count) EINA_ARG_NONNULL(1, 2);
+
+/**
+ * @brief Fetches a batch of messages from a thread queue.
+ *
+ * @param[in,out] thq The thread queue to fetch the messages from
+ * @param[out] msgs An array with room for @p max messages of @p size bytes each
+ * @param[in] size The size, in bytes, of each message in @p msgs
+ * @param[in] max The maximum number of messages to fetch
+ * @return The number of messages fetched
+ *
+ * This waits for at least one message like eina_thread_queue_wait() and
+ * then copies up to @p max of the messages already in the queue into
+ * @p msgs. Messages bigger than @p size are truncated. There is no need to
+ * call eina_thread_queue_wait_done() afterwards.
+ *
+ * @since 1.22
+ */
+EAPI int
+eina_thread_queue_wait_batch(Eina_Thread_Queue *thq, void *msgs, int size, int max) EINA_ARG_NONNULL(1, 2);
+
+/**
+ * @brief Fetches a batch of messages from a thread queue, if any are present.
+ *
+ * @param[in,out] thq The thread queue to fetch the messages from
+ * @param[out] msgs An array with room for @p max messages of @p size bytes each
+ * @param[in] size The size, in bytes, of each message in @p msgs
+ * @param[in] max The maximum number of messages to fetch
+ * @return The number of messages fetched, 0 if the queue was empty
+ *
+ * This is the same as eina_thread_queue_wait_batch(), but it never
+ * blocks.
+ *
+ * @since 1.22
+ */
+EAPI int
+eina_thread_queue_poll_batch(Eina_Thread_Queue *thq, void *msgs, int size, int max) EINA_ARG_NONNULL(1, 2);
+
 /**
  * @brief Gets the number of messages on a queue as yet unfetched.
  *
@@ -23,6 +23,7 @@
 
 #include "eina_config.h"
 #include "eina_private.h"
+#include "eina_cpu.h"
 #include <string.h>
 
 /* undefs EINA_ARG_NONULL() so NULL checks are not compiled out! */
@@ -302,14 +303,615 @@ eina_unicode_utf8_get_prev(const char *buf, int *iindex)
    return r;
 }
 
+/* Bulk UTF-8 helpers
+ *
+ * They only accept strict UTF-8 (RFC 3629: no overlong forms, no surrogates,
+ * nothing above U+10FFFF). On such input eina_unicode_utf8_next_get() decodes
+ * to the exact same code points, so the callers below can use them as a fast
+ * path and keep the scalar decoder for anything else, error replacement
+ * included.
+ *
+ * x86 picks its path at runtime from eina_cpu_features: AVX2 validates 32
+ * bytes at a time with the lookup tables from "Validating UTF-8 In Less
+ * Than One Instruction Per Byte" (Keiser & Lemire), SSE2 skips ASCII runs and
+ * checks the rest one sequence at a time. NEON is part of aarch64 so it is
+ * always used there.
+ */
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+  (defined(__clang__) || (__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9)))
+# include <immintrin.h>
+# define EINA_UNICODE_X86 1
+# define EINA_UNICODE_SSE2 __attribute__((target("sse2")))
+# define EINA_UNICODE_AVX2 __attribute__((target("avx2")))
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+# include <arm_neon.h>
+# define EINA_UNICODE_NEON 1
+#endif
+
+#define EINA_UTF8_IS_CONT(x) (((x) & 0xC0) == 0x80)
+
+/* Returns the length of the strict sequence starting at s[i], 0 if invalid */
+static inline int
+_eina_unicode_utf8_seq_check(const unsigned char *s, size_t len, size_t i)
+{
+   unsigned char c = s[i];
+   unsigned char c1;
+
+   if (c < 0x80) return 1;
+   if (c < 0xC2) return 0; // continuation or overlong 2 bytes lead
+   if (c < 0xE0)
+     {
+        if ((len - i < 2) || !EINA_UTF8_IS_CONT(s[i + 1])) return 0;
+        return 2;
+     }
+   if (c < 0xF0)
+     {
+        if (len - i < 3) return 0;
+        c1 = s[i + 1];
+        if (!EINA_UTF8_IS_CONT(c1) || !EINA_UTF8_IS_CONT(s[i + 2])) return 0;
+        if ((c == 0xE0) && (c1 < 0xA0)) return 0; // overlong
+        if ((c == 0xED) && (c1 > 0x9F)) return 0; // surrogate
+        return 3;
+     }
+   if (c < 0xF5)
+     {
+        if (len - i < 4) return 0;
+        c1 = s[i + 1];
+        if (!EINA_UTF8_IS_CONT(c1) || !EINA_UTF8_IS_CONT(s[i + 2]) ||
+            !EINA_UTF8_IS_CONT(s[i + 3])) return 0;
+        if ((c == 0xF0) && (c1 < 0x90)) return 0; // overlong
+        if ((c == 0xF4) && (c1 > 0x8F)) return 0; // above U+10FFFF
+        return 4;
+     }
+   return 0;
+}
+
+/* Decodes one sequence already known to be valid */
+static inline Eina_Unicode
+_eina_unicode_utf8_seq_decode(const unsigned char *s, size_t *i)
+{
+   const unsigned char *p = s + *i;
+
+   if (p[0] < 0xE0)
+     {
+        *i += 2;
+        return ((p[0] & 0x1F) << 6) | (p[1] & 0x3F);
+     }
+   if (p[0] < 0xF0)
+     {
+        *i += 3;
+        return ((p[0] & 0x0F) << 12) | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+     }
+   *i += 4;
+   return ((p[0] & 0x07) << 18) | ((p[1] & 0x3F) << 12) |
+     ((p[2] & 0x3F) << 6) | (p[3] & 0x3F);
+}
+
+static size_t
+_eina_unicode_utf8_ascii_len_generic(const unsigned char *s, size_t len)
+{
+   size_t i = 0;
+
+   for (; i + sizeof (uint64_t) <= len; i += sizeof (uint64_t))
+     {
+        uint64_t w;
+
+        memcpy(&w, s + i, sizeof (w));
+        if (w & 0x8080808080808080ULL) break;
+     }
+   while ((i < len) && (s[i] < 0x80)) i++;
+   return i;
+}
+
+static size_t
+_eina_unicode_utf8_cont_count_generic(const unsigned char *s, size_t len)
+{
+   size_t i, n = 0;
+
+   for (i = 0; i < len; i++)
+     n += EINA_UTF8_IS_CONT(s[i]);
+   return n;
+}
+
+static size_t
+_eina_unicode_utf8_ascii_widen_generic(const unsigned char *s, size_t len,
+                                       Eina_Unicode *out)
+{
+   size_t i;
+
+   for (i = 0; (i < len) && (s[i] < 0x80); i++)
+     out[i] = s[i];
+   return i;
+}
+
+#ifdef EINA_UNICODE_X86
+EINA_UNICODE_SSE2 static size_t
+_eina_unicode_utf8_ascii_len_sse2(const unsigned char *s, size_t len)
+{
+   size_t i;
+
+   for (i = 0; i + 16 <= len; i += 16)
+     {
+        int m = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(s + i)));
+
+        if (m) return i + __builtin_ctz(m);
+     }
+   return i + _eina_unicode_utf8_ascii_len_generic(s + i, len - i);
+}
+
+EINA_UNICODE_SSE2 static size_t
+_eina_unicode_utf8_cont_count_sse2(const unsigned char *s, size_t len)
+{
+   const __m128i limit = _mm_set1_epi8(-64);
+   size_t i, n = 0;
+
+   // continuation bytes are the only ones below -64 when signed
+   for (i = 0; i + 16 <= len; i += 16)
+     {
+        __m128i in = _mm_loadu_si128((const __m128i *)(s + i));
+
+        n += __builtin_popcount(_mm_movemask_epi8(_mm_cmplt_epi8(in, limit)));
+     }
+   return n + _eina_unicode_utf8_cont_count_generic(s + i, len - i);
+}
+
+EINA_UNICODE_SSE2 static size_t
+_eina_unicode_utf8_ascii_widen_sse2(const unsigned char *s, size_t len,
+                                    Eina_Unicode *out)
+{
+   const __m128i zero = _mm_setzero_si128();
+   size_t i;
+
+   for (i = 0; i + 16 <= len; i += 16)
+     {
+        __m128i in = _mm_loadu_si128((const __m128i *)(s + i));
+        __m128i lo, hi;
+
+        if (_mm_movemask_epi8(in)) break;
+        lo = _mm_unpacklo_epi8(in, zero);
+        hi = _mm_unpackhi_epi8(in, zero);
+        _mm_storeu_si128((__m128i *)(out + i), _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128((__m128i *)(out + i + 4), _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128((__m128i *)(out + i + 8), _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128((__m128i *)(out + i + 12), _mm_unpackhi_epi16(hi, zero));
+     }
+   return i + _eina_unicode_utf8_ascii_widen_generic(s + i, len - i, out + i);
+}
+
+EINA_UNICODE_AVX2 static size_t
+_eina_unicode_utf8_ascii_len_avx2(const unsigned char *s, size_t len)
+{
+   size_t i;
+
+   for (i = 0; i + 32 <= len; i += 32)
+     {
+        unsigned int m = _mm256_movemask_epi8(_mm256_loadu_si256((const __m256i *)(s + i)));
+
+        if (m) return i + __builtin_ctz(m);
+     }
+   return i + _eina_unicode_utf8_ascii_len_generic(s + i, len - i);
+}
+
+EINA_UNICODE_AVX2 static size_t
+_eina_unicode_utf8_cont_count_avx2(const unsigned char *s, size_t len)
+{
+   const __m256i limit = _mm256_set1_epi8(-64);
+   size_t i, n = 0;
+
+   for (i = 0; i + 32 <= len; i += 32)
+     {
+        __m256i in = _mm256_loadu_si256((const __m256i *)(s + i));
+
+        n += __builtin_popcount(_mm256_movemask_epi8(_mm256_cmpgt_epi8(limit, in)));
+     }
+   return n + _eina_unicode_utf8_cont_count_generic(s + i, len - i);
+}
+
+EINA_UNICODE_AVX2 static size_t
+_eina_unicode_utf8_ascii_widen_avx2(const unsigned char *s, size_t len,
+                                    Eina_Unicode *out)
+{
+   size_t i;
+
+   for (i = 0; i + 32 <= len; i += 32)
+     {
+        __m256i in = _mm256_loadu_si256((const __m256i *)(s + i));
+        __m128i lo, hi;
+
+        if (_mm256_movemask_epi8(in)) break;
+        lo = _mm256_castsi256_si128(in);
+        hi = _mm256_extracti128_si256(in, 1);
+        _mm256_storeu_si256((__m256i *)(out + i), _mm256_cvtepu8_epi32(lo));
+        _mm256_storeu_si256((__m256i *)(out + i + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+        _mm256_storeu_si256((__m256i *)(out + i + 16), _mm256_cvtepu8_epi32(hi));
+        _mm256_storeu_si256((__m256i *)(out + i + 24), _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+     }
+   // stay in this function for the tail, going through the SSE2 one on
+   // every short ASCII run costs more than it saves
+   for (; (i < len) && (s[i] < 0x80); i++)
+     out[i] = s[i];
+   return i;
+}
+#endif
+
+/* Error classes of the lookup validator, each table entry tells which
+ * errors the high or low nibble of a byte pair can be part of. */
+#define U8_TOO_SHORT  0x01
+#define U8_TOO_LONG   0x02
+#define U8_OVERLONG_3 0x04
+#define U8_TOO_LARGE  0x08
+#define U8_SURROGATE  0x10
+#define U8_OVERLONG_2 0x20
+#define U8_TOO_LARGE_1000 0x40
+#define U8_OVERLONG_4 0x40
+#define U8_TWO_CONTS  0x80
+#define U8_CARRY (U8_TOO_SHORT | U8_TOO_LONG | U8_TWO_CONTS)
+
+#define U8_BYTE_1_HIGH \
+  U8_TOO_LONG, U8_TOO_LONG, U8_TOO_LONG, U8_TOO_LONG, \
+  U8_TOO_LONG, U8_TOO_LONG, U8_TOO_LONG, U8_TOO_LONG, \
+  U8_TWO_CONTS, U8_TWO_CONTS, U8_TWO_CONTS, U8_TWO_CONTS, \
+  U8_TOO_SHORT | U8_OVERLONG_2, \
+  U8_TOO_SHORT, \
+  U8_TOO_SHORT | U8_OVERLONG_3 | U8_SURROGATE, \
+  U8_TOO_SHORT | U8_TOO_LARGE | U8_TOO_LARGE_1000 | U8_OVERLONG_4
+
+#define U8_BYTE_1_LOW \
+  U8_CARRY | U8_OVERLONG_3 | U8_OVERLONG_2 | U8_OVERLONG_4, \
+  U8_CARRY | U8_OVERLONG_2, \
+  U8_CARRY, \
+  U8_CARRY, \
+  U8_CARRY | U8_TOO_LARGE, \
+  U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000, \
+  U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000, \
+  U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000, \
+  U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000, \
+  U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000, \
+  U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000, \
+  U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000, \
+  U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000, \
+  U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000 | U8_SURROGATE, \
+  U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000, \
+  U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000
+
+#define U8_BYTE_2_HIGH \
+  U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT, \
+  U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT, \
+  U8_TOO_LONG | U8_OVERLONG_2 | U8_TWO_CONTS | U8_OVERLONG_3 | U8_TOO_LARGE_1000 | U8_OVERLONG_4, \
+  U8_TOO_LONG | U8_OVERLONG_2 | U8_TWO_CONTS | U8_OVERLONG_3 | U8_TOO_LARGE, \
+  U8_TOO_LONG | U8_OVERLONG_2 | U8_TWO_CONTS | U8_SURROGATE | U8_TOO_LARGE, \
+  U8_TOO_LONG | U8_OVERLONG_2 | U8_TWO_CONTS | U8_SURROGATE | U8_TOO_LARGE, \
+  U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT
+
+#if defined(EINA_UNICODE_X86) || defined(EINA_UNICODE_NEON)
+static const unsigned char _eina_utf8_byte_1_high[16] = { U8_BYTE_1_HIGH };
+static const unsigned char _eina_utf8_byte_1_low[16] = { U8_BYTE_1_LOW };
+static const unsigned char _eina_utf8_byte_2_high[16] = { U8_BYTE_2_HIGH };
+/* the last bytes of a block must not start a sequence longer than what is left */
+static const unsigned char _eina_utf8_max_value[32] = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+};
+#endif
+
+static Eina_Bool
+_eina_unicode_utf8_validate_generic(const unsigned char *s, size_t len,
+                                    size_t (*ascii_len)(const unsigned char *s, size_t len))
+{
+   size_t i = 0;
+
+   while (i < len)
+     {
+        int n;
+
+        if (s[i] < 0x80)
+          {
+             i += ascii_len(s + i, len - i);
+             if (i >= len) break;
+          }
+        n = _eina_unicode_utf8_seq_check(s, len, i);
+        if (!n) return EINA_FALSE;
+        i += n;
+     }
+   return EINA_TRUE;
+}
+
+#ifdef EINA_UNICODE_X86
+EINA_UNICODE_AVX2 static Eina_Bool
+_eina_unicode_utf8_validate_avx2(const unsigned char *s, size_t len)
+{
+   const __m256i b1h = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)_eina_utf8_byte_1_high));
+   const __m256i b1l = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)_eina_utf8_byte_1_low));
+   const __m256i b2h = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)_eina_utf8_byte_2_high));
+   const __m256i max = _mm256_loadu_si256((const __m256i *)_eina_utf8_max_value);
+   const __m256i nibble = _mm256_set1_epi8(0x0F);
+   __m256i prev = _mm256_setzero_si256();
+   __m256i error = _mm256_setzero_si256();
+   __m256i incomplete = _mm256_setzero_si256();
+   unsigned char tail[32];
+   size_t i;
+
+   for (i = 0; i < len; i += 32)
+     {
+        __m256i in, shifted, prev1, prev2, prev3, sc, must23;
+
+        if (len - i < 32)
+          {
+             // pad the end with ASCII
+             memset(tail, 0, sizeof (tail));
+             memcpy(tail, s + i, len - i);
+             in = _mm256_loadu_si256((const __m256i *)tail);
+          }
+        else
+          in = _mm256_loadu_si256((const __m256i *)(s + i));
+
+        if (!_mm256_movemask_epi8(in))
+          {
+             error = _mm256_or_si256(error, incomplete);
+             incomplete = _mm256_setzero_si256();
+             prev = in;
+             continue;
+          }
+
+        shifted = _mm256_permute2x128_si256(prev, in, 0x21);
+        prev1 = _mm256_alignr_epi8(in, shifted, 15);
+        prev2 = _mm256_alignr_epi8(in, shifted, 14);
+        prev3 = _mm256_alignr_epi8(in, shifted, 13);
+
+        sc = _mm256_shuffle_epi8(b1h, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+        sc = _mm256_and_si256(sc, _mm256_shuffle_epi8(b1l, _mm256_and_si256(prev1, nibble)));
+        sc = _mm256_and_si256(sc, _mm256_shuffle_epi8(b2h, _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble)));
+
+        // third and fourth bytes of a sequence must be continuations
+        must23 = _mm256_or_si256(_mm256_subs_epu8(prev2, _mm256_set1_epi8(0xE0 - 0x80)),
+                                 _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xF0 - 0x80)));
+        must23 = _mm256_and_si256(must23, _mm256_set1_epi8((char)0x80));
+
+        error = _mm256_or_si256(error, _mm256_xor_si256(must23, sc));
+        incomplete = _mm256_subs_epu8(in, max);
+        prev = in;
+     }
+
+   error = _mm256_or_si256(error, incomplete);
+   return _mm256_testz_si256(error, error);
+}
+#endif
+
+#ifdef EINA_UNICODE_NEON
+static size_t
+_eina_unicode_utf8_ascii_len_neon(const unsigned char *s, size_t len)
+{
+   size_t i;
+
+   for (i = 0; i + 16 <= len; i += 16)
+     if (vmaxvq_u8(vld1q_u8(s + i)) >= 0x80) break;
+   return i + _eina_unicode_utf8_ascii_len_generic(s + i, len - i);
+}
+
+static size_t
+_eina_unicode_utf8_cont_count_neon(const unsigned char *s, size_t len)
+{
+   const int8x16_t limit = vdupq_n_s8(-64);
+   size_t i, n = 0;
+
+   for (i = 0; i + 16 <= len; i += 16)
+     {
+        uint8x16_t cont = vcltq_s8(vreinterpretq_s8_u8(vld1q_u8(s + i)), limit);
+
+        n += vaddvq_u8(vshrq_n_u8(cont, 7));
+     }
+   return n + _eina_unicode_utf8_cont_count_generic(s + i, len - i);
+}
+
+static size_t
+_eina_unicode_utf8_ascii_widen_neon(const unsigned char *s, size_t len,
+                                    Eina_Unicode *out)
+{
+   size_t i;
+
+   for (i = 0; i + 16 <= len; i += 16)
+     {
+        uint8x16_t in = vld1q_u8(s + i);
+        uint16x8_t lo, hi;
+
+        if (vmaxvq_u8(in) >= 0x80) break;
+        lo = vmovl_u8(vget_low_u8(in));
+        hi = vmovl_u8(vget_high_u8(in));
+        vst1q_u32((uint32_t *)(out + i), vmovl_u16(vget_low_u16(lo)));
+        vst1q_u32((uint32_t *)(out + i + 4), vmovl_u16(vget_high_u16(lo)));
+        vst1q_u32((uint32_t *)(out + i + 8), vmovl_u16(vget_low_u16(hi)));
+        vst1q_u32((uint32_t *)(out + i + 12), vmovl_u16(vget_high_u16(hi)));
+     }
+   return i + _eina_unicode_utf8_ascii_widen_generic(s + i, len - i, out + i);
+}
+
+static Eina_Bool
+_eina_unicode_utf8_validate_neon(const unsigned char *s, size_t len)
+{
+   const uint8x16_t b1h = vld1q_u8(_eina_utf8_byte_1_high);
+   const uint8x16_t b1l = vld1q_u8(_eina_utf8_byte_1_low);
+   const uint8x16_t b2h = vld1q_u8(_eina_utf8_byte_2_high);
+   const uint8x16_t max = vld1q_u8(_eina_utf8_max_value + 16);
+   const uint8x16_t nibble = vdupq_n_u8(0x0F);
+   uint8x16_t prev = vdupq_n_u8(0);
+   uint8x16_t error = vdupq_n_u8(0);
+   uint8x16_t incomplete = vdupq_n_u8(0);
+   unsigned char tail[16];
+   size_t i;
+
+   for (i = 0; i < len; i += 16)
+     {
+        uint8x16_t in, prev1, prev2, prev3, sc, must23;
+
+        if (len - i < 16)
+          {
+             memset(tail, 0, sizeof (tail));
+             memcpy(tail, s + i, len - i);
+             in = vld1q_u8(tail);
+          }
+        else
+          in = vld1q_u8(s + i);
+
+        if (vmaxvq_u8(in) < 0x80)
+          {
+             error = vorrq_u8(error, incomplete);
+             incomplete = vdupq_n_u8(0);
+             prev = in;
+             continue;
+          }
+
+        prev1 = vextq_u8(prev, in, 15);
+        prev2 = vextq_u8(prev, in, 14);
+        prev3 = vextq_u8(prev, in, 13);
+
+        sc = vqtbl1q_u8(b1h, vshrq_n_u8(prev1, 4));
+        sc = vandq_u8(sc, vqtbl1q_u8(b1l, vandq_u8(prev1, nibble)));
+        sc = vandq_u8(sc, vqtbl1q_u8(b2h, vshrq_n_u8(in, 4)));
+
+        must23 = vorrq_u8(vqsubq_u8(prev2, vdupq_n_u8(0xE0 - 0x80)),
+                          vqsubq_u8(prev3, vdupq_n_u8(0xF0 - 0x80)));
+        must23 = vandq_u8(must23, vdupq_n_u8(0x80));
+
+        error = vorrq_u8(error, veorq_u8(must23, sc));
+        incomplete = vqsubq_u8(in, max);
+        prev = in;
+     }
+
+   error = vorrq_u8(error, incomplete);
+   return vmaxvq_u8(error) == 0;
+}
+#endif
+
+static size_t
+_eina_unicode_utf8_ascii_len(const unsigned char *s, size_t len)
+{
+#ifdef EINA_UNICODE_X86
+   if (eina_cpu_features_get() & EINA_CPU_AVX2)
+     return _eina_unicode_utf8_ascii_len_avx2(s, len);
+   if (eina_cpu_features_get() & EINA_CPU_SSE2)
+     return _eina_unicode_utf8_ascii_len_sse2(s, len);
+#elif defined(EINA_UNICODE_NEON)
+   return _eina_unicode_utf8_ascii_len_neon(s, len);
+#endif
+   return _eina_unicode_utf8_ascii_len_generic(s, len);
+}
+
+static Eina_Bool
+_eina_unicode_utf8_validate(const unsigned char *s, size_t len)
+{
+#ifdef EINA_UNICODE_X86
+   if (eina_cpu_features_get() & EINA_CPU_AVX2)
+     return _eina_unicode_utf8_validate_avx2(s, len);
+#elif defined(EINA_UNICODE_NEON)
+   return _eina_unicode_utf8_validate_neon(s, len);
+#endif
+   return _eina_unicode_utf8_validate_generic(s, len, _eina_unicode_utf8_ascii_len);
+}
+
+static size_t
+_eina_unicode_utf8_cont_count(const unsigned char *s, size_t len)
+{
+#ifdef EINA_UNICODE_X86
+   if (eina_cpu_features_get() & EINA_CPU_AVX2)
+     return _eina_unicode_utf8_cont_count_avx2(s, len);
+   if (eina_cpu_features_get() & EINA_CPU_SSE2)
+     return _eina_unicode_utf8_cont_count_sse2(s, len);
+#elif defined(EINA_UNICODE_NEON)
+   return _eina_unicode_utf8_cont_count_neon(s, len);
+#endif
+   return _eina_unicode_utf8_cont_count_generic(s, len);
+}
+
+static size_t
+_eina_unicode_utf8_ascii_widen(const unsigned char *s, size_t len,
+                               Eina_Unicode *out)
+{
+#ifdef EINA_UNICODE_X86
+   if (eina_cpu_features_get() & EINA_CPU_AVX2)
+     return _eina_unicode_utf8_ascii_widen_avx2(s, len, out);
+   if (eina_cpu_features_get() & EINA_CPU_SSE2)
+     return _eina_unicode_utf8_ascii_widen_sse2(s, len, out);
+#elif defined(EINA_UNICODE_NEON)
+   return _eina_unicode_utf8_ascii_widen_neon(s, len, out);
+#endif
+   return _eina_unicode_utf8_ascii_widen_generic(s, len, out);
+}
+
+/* Input must have been validated */
+static size_t
+_eina_unicode_utf8_decode_valid(const unsigned char *s, size_t len,
+                                Eina_Unicode *out)
+{
+   size_t i = 0, n = 0;
+
+   while (i < len)
+     {
+        if (s[i] < 0x80)
+          {
+             size_t ascii = _eina_unicode_utf8_ascii_widen(s + i, len - i, out + n);
+
+             i += ascii;
+             n += ascii;
+             if (i >= len) break;
+          }
+        out[n++] = _eina_unicode_utf8_seq_decode(s, &i);
+     }
+   return n;
+}
+
+EAPI Eina_Bool
+eina_unicode_utf8_validate(const char *buf, size_t len)
+{
+   EINA_SAFETY_ON_NULL_RETURN_VAL(buf, EINA_FALSE);
+
+   return _eina_unicode_utf8_validate((const unsigned char *)buf, len);
+}
+
+EAPI size_t
+eina_unicode_utf8_ascii_len(const char *buf, size_t len)
+{
+   EINA_SAFETY_ON_NULL_RETURN_VAL(buf, 0);
+
+   return _eina_unicode_utf8_ascii_len((const unsigned char *)buf, len);
+}
+
+EAPI int
+eina_unicode_utf8_count(const char *buf, size_t len)
+{
+   EINA_SAFETY_ON_NULL_RETURN_VAL(buf, -1);
+
+   if (!_eina_unicode_utf8_validate((const unsigned char *)buf, len))
+     return -1;
+   return len - _eina_unicode_utf8_cont_count((const unsigned char *)buf, len);
+}
+
+EAPI int
+eina_unicode_utf8_decode(const char *buf, size_t len, Eina_Unicode *out)
+{
+   EINA_SAFETY_ON_NULL_RETURN_VAL(buf, -1);
+   EINA_SAFETY_ON_NULL_RETURN_VAL(out, -1);
+
+   if (!_eina_unicode_utf8_validate((const unsigned char *)buf, len))
+     return -1;
+   return _eina_unicode_utf8_decode_valid((const unsigned char *)buf, len, out);
+}
+
 EAPI int
 eina_unicode_utf8_get_len(const char *buf)
 {
    /* returns the number of utf8 characters (not bytes) in the string */
    int i = 0, len = 0;
+   size_t bytes;
 
    EINA_SAFETY_ON_NULL_RETURN_VAL(buf, 0);
 
+   bytes = strlen(buf);
+   if (_eina_unicode_utf8_validate((const unsigned char *)buf, bytes))
+     return bytes - _eina_unicode_utf8_cont_count((const unsigned char *)buf, bytes);
+
    while (eina_unicode_utf8_next_get(buf, &i))
         len++;
 
@@ -319,13 +921,27 @@ eina_unicode_utf8_get_len(const char *buf)
 EAPI Eina_Unicode *
 eina_unicode_utf8_to_unicode(const char *utf, int *_len)
 {
-   /* FIXME: Should optimize! */
    int len, i;
    int ind;
+   size_t bytes;
    Eina_Unicode *buf, *uind;
 
    EINA_SAFETY_ON_NULL_RETURN_VAL(utf, NULL);
 
+   bytes = strlen(utf);
+   if (_eina_unicode_utf8_validate((const unsigned char *)utf, bytes))
+     {
+        len = bytes - _eina_unicode_utf8_cont_count((const unsigned char *)utf, bytes);
+        if (_len) *_len = len;
+        buf = malloc(sizeof(Eina_Unicode) * (len + 1));
+        if (!buf) return buf;
+
+        _eina_unicode_utf8_decode_valid((const unsigned char *)utf, bytes, buf);
+        buf[len] = 0;
+        return buf;
+     }
+
+   /* Slow path, keeps the replacement of invalid bytes */
    len = eina_unicode_utf8_get_len(utf);
    if (_len) *_len = len;
    buf = malloc(sizeof(Eina_Unicode) * (len + 1));
@@ -222,6 +222,67 @@ EAPI char * eina_unicode_unicode_to_utf8_range(const Eina_Unicode *uni, int ulen
  */
 EAPI char * eina_unicode_unicode_to_utf8(const Eina_Unicode *uni, int *_len) EINA_WARN_UNUSED_RESULT EINA_ARG_NONNULL(1) EINA_MALLOC;
 
+/**
+ * @brief Checks that a buffer is valid UTF-8.
+ *
+ * Validation is strict (RFC 3629): overlong forms, surrogates and code
+ * points above U+10FFFF are rejected. Nul bytes are accepted, as any other
+ * ASCII character. When available, SIMD instructions are used to check
+ * the buffer a block at a time.
+ *
+ * @param[in] buf The buffer to check.
+ * @param[in] len The number of bytes in @p buf.
+ * @return #EINA_TRUE if the @p len bytes of @p buf are valid UTF-8.
+ *
+ * @since 1.22
+ */
+EAPI Eina_Bool eina_unicode_utf8_validate(const char *buf, size_t len) EINA_ARG_NONNULL(1) EINA_PURE;
+
+/**
+ * @brief Gets the length of the ASCII run at the start of a buffer.
+ *
+ * This allows to fast-forward over the part of a string that can be
+ * handled byte by byte.
+ *
+ * @param[in] buf The buffer to look at.
+ * @param[in] len The number of bytes in @p buf.
+ * @return The index of the first byte of @p buf that is not ASCII, @p len
+ *         if there is none.
+ *
+ * @since 1.22
+ */
+EAPI size_t eina_unicode_utf8_ascii_len(const char *buf, size_t len) EINA_ARG_NONNULL(1) EINA_PURE;
+
+/**
+ * @brief Counts the code points of a valid UTF-8 buffer.
+ *
+ * @param[in] buf The buffer to count.
+ * @param[in] len The number of bytes in @p buf.
+ * @return The number of code points in @p buf, -1 if it is not valid
+ *         UTF-8 as defined by eina_unicode_utf8_validate().
+ *
+ * @see eina_unicode_utf8_get_len()
+ * @since 1.22
+ */
+EAPI int eina_unicode_utf8_count(const char *buf, size_t len) EINA_ARG_NONNULL(1) EINA_PURE;
+
+/**
+ * @brief Decodes a valid UTF-8 buffer into a caller provided array.
+ *
+ * Unlike eina_unicode_utf8_to_unicode(), no replacement is done for
+ * invalid input and the result is not nul terminated.
+ *
+ * @param[in] buf The buffer to decode.
+ * @param[in] len The number of bytes in @p buf.
+ * @param[out] out Where to write the code points, it must be able to hold
+ *             eina_unicode_utf8_count() (or @p len) entries.
+ * @return The number of code points written, -1 if @p buf is not valid
+ *         UTF-8 as defined by eina_unicode_utf8_validate().
+ *
+ * @since 1.22
+ */
+EAPI int eina_unicode_utf8_decode(const char *buf, size_t len, Eina_Unicode *out) EINA_ARG_NONNULL(1, 3);
+
 #include "eina_inline_unicode.x"
 
 /**
@@ -154,6 +154,33 @@ extern "C" {
    eo_debug my_app
  * @endverbatim
  *
+ * @section eo_data_layout Object Data Layout
+ *
+ * An object is one block of memory: the Eo header followed by the private
+ * data of each class it inherits from. Setting @c EO_DATA_STATS counts the
+ * accesses to the data of each class and prints, at shutdown, the layout of
+ * the objects of every class that was used: the offset, size and padding of
+ * each data block and whether it is hot or cold. A block is hot when it
+ * gets at least 1% of the accesses to the data of its object. This works
+ * with the regular libeo, but it makes method calls slower.
+ *
+ * @verbatim
+   export EO_DATA_STATS=1
+   my_app
+ * @endverbatim
+ *
+ * The data of regular classes is at the same offset in all of their
+ * subclasses, only the data of mixins can move. @c EO_DATA_PROFILE names a
+ * file holding the access counts: classes created while it is set put the
+ * data of their most used mixins first, and a run with @c EO_DATA_STATS
+ * set saves its counts there at shutdown.
+ *
+ * @verbatim
+   export EO_DATA_PROFILE=~/.cache/my_app.eo_profile
+   EO_DATA_STATS=1 my_app  # record
+   my_app                  # use
+ * @endverbatim
+ *
  * @section eo_main_intro_example Introductory Example
  *
  * @ref Eo_Tutorial
@@ -1007,6 +1034,20 @@ EAPI Eina_Bool efl_object_init(void);
  */
 EAPI Eina_Bool efl_object_shutdown(void);
 
+/**
+ * @brief Get how many calls could not use the cache of their call site.
+ *
+ * Each call site remembers the class of the last object it was called on,
+ * with the function and object data it resolved to. Calling it again on an
+ * object of the same class skips the method lookup. This counts the calls
+ * that had to do the full lookup since efl_object_init().
+ *
+ * @return The number of cache misses
+ *
+ * @since 1.22
+ */
+EAPI unsigned long long efl_object_call_cache_misses_get(void);
+
 #ifdef EFL_BETA_API_SUPPORT
 
 /**
@@ -1206,6 +1247,15 @@ typedef struct _Efl_Object_Op_Call_Data
    void         *extn4; // for future use to avoid ABI issues
 } Efl_Object_Op_Call_Data;
 
+// per call site cache of the last resolution, see _efl_object_call_resolve_cached()
+typedef struct _Efl_Object_Call_Cache
+{
+   unsigned int  seq; // odd while it is being filled
+   const void   *klass; // class of the object the entry is valid for
+   void         *func;
+   ptrdiff_t     data_offset; // -1 if the call has no object data
+} Efl_Object_Call_Cache;
+
 // to pass the internal function call to EFL_FUNC_BODY (as Func parameter)
 #define EFL_FUNC_CALL(...) __VA_ARGS__
 
@@ -1226,14 +1276,15 @@ typedef struct _Efl_Object_Op_Call_Data
 #define EFL_FUNC_COMMON_OP(Obj, Name, DefRet) \
    static Efl_Object_Op ___op = 0; \
    static unsigned int ___generation = 0; \
+   static Efl_Object_Call_Cache ___cache = { 0, NULL, NULL, 0 }; \
    Efl_Object_Op_Call_Data ___call; \
    _Eo_##Name##_func _func_;                                            \
    if (EINA_UNLIKELY((___op == EFL_NOOP) ||                       \
                      (___generation != _efl_object_init_generation))) \
      goto __##Name##_op_create; /* yes a goto - see below */ \
    __##Name##_op_create_done: EINA_HOT; \
-   if (EINA_UNLIKELY(!_efl_object_call_resolve( \
-      (Eo *) Obj, #Name, &___call, ___op, __FILE__, __LINE__))) \
+   if (EINA_UNLIKELY(!_efl_object_call_resolve_cached( \
+      (Eo *) Obj, #Name, &___call, &___cache, ___op, __FILE__, __LINE__))) \
       goto __##Name##_failed; \
    _func_ = (_Eo_##Name##_func) ___call.func;
 
@@ -1249,6 +1300,7 @@ typedef struct _Efl_Object_Op_Call_Data
 __##Name##_op_create: EINA_COLD; \
    ___op = _efl_object_op_api_id_get(EFL_FUNC_COMMON_OP_FUNC(Name), Obj, #Name, __FILE__, __LINE__); \
    ___generation = _efl_object_init_generation; \
+   ___cache.klass = NULL; /* classes are gone after a shutdown */ \
    if (EINA_UNLIKELY(___op == EFL_NOOP)) goto __##Name##_failed; \
    goto __##Name##_op_create_done; \
 __##Name##_failed: EINA_COLD; \
@@ -1340,6 +1392,123 @@ __##Name##_failed: EINA_COLD; \
 #define EFL_FUNC_BODYV_CONST_FALLBACK(Name, Ret, DefRet, FallbackCall, Arguments, ...) _EFL_OBJECT_FUNC_BODYV(Name, const Eo *, Ret, DefRet, FallbackCall, EFL_FUNC_CALL(Arguments), __VA_ARGS__)
 #define EFL_VOID_FUNC_BODYV_CONST_FALLBACK(Name, FallbackCall, Arguments, ...) _EFL_OBJECT_VOID_FUNC_BODYV(Name, const Eo *, FallbackCall, EFL_FUNC_CALL(Arguments), __VA_ARGS__)
 
+// The following macros are generated for the methods of final classes. Impl
+// is the implementation of the method in the class Klass, it is called
+// directly when the object is of that exact class and has no override,
+// every other call takes the regular path.
+
+#define EFL_FUNC_DIRECT_OP(Obj, Name, Klass) \
+   Efl_Object_Op_Call_Data ___direct; \
+   if (EINA_LIKELY(_efl_object_call_resolve_direct((Eo *) Obj, Klass, &___direct, #Name, __FILE__, __LINE__)))
+
+// an invalid object has already been reported, do not do it twice
+#define EFL_FUNC_DIRECT_OP_END(Obj, DefRet) \
+   if (EINA_UNLIKELY(Obj && !___direct.eo_id)) return DefRet;
+
+#define _EFL_OBJECT_FUNC_BODY_DIRECT(Name, ObjType, Klass, Impl, Ret, DefRet) \
+  Ret \
+  Name(ObjType obj) \
+  { \
+     typedef Ret (*_Eo_##Name##_func)(Eo *, void *obj_data); \
+     Ret _r; \
+     EFL_FUNC_DIRECT_OP(obj, Name, Klass) \
+       { \
+          _EFL_OBJECT_API_BEFORE_HOOK \
+          _r = _EFL_OBJECT_API_CALL_HOOK(Impl(___direct.eo_id, ___direct.data)); \
+          _efl_object_call_end(&___direct); \
+          _EFL_OBJECT_API_AFTER_HOOK \
+          return _r; \
+       } \
+     EFL_FUNC_DIRECT_OP_END(obj, DefRet) \
+     EFL_FUNC_COMMON_OP(obj, Name, DefRet); \
+     _EFL_OBJECT_API_BEFORE_HOOK \
+     _r = _EFL_OBJECT_API_CALL_HOOK(_func_(___call.eo_id, ___call.data)); \
+     _efl_object_call_end(&___call); \
+     _EFL_OBJECT_API_AFTER_HOOK \
+     return _r; \
+     EFL_FUNC_COMMON_OP_END(obj, Name, DefRet, ); \
+  }
+
+#define _EFL_OBJECT_VOID_FUNC_BODY_DIRECT(Name, ObjType, Klass, Impl) \
+  void \
+  Name(ObjType obj) \
+  { \
+     typedef void (*_Eo_##Name##_func)(Eo *, void *obj_data); \
+     EFL_FUNC_DIRECT_OP(obj, Name, Klass) \
+       { \
+          _EFL_OBJECT_API_BEFORE_HOOK \
+          _EFL_OBJECT_API_CALL_HOOK(Impl(___direct.eo_id, ___direct.data)); \
+          _efl_object_call_end(&___direct); \
+          _EFL_OBJECT_API_AFTER_HOOK \
+          return; \
+       } \
+     EFL_FUNC_DIRECT_OP_END(obj, ) \
+     EFL_FUNC_COMMON_OP(obj, Name, ); \
+     _EFL_OBJECT_API_BEFORE_HOOK \
+     _EFL_OBJECT_API_CALL_HOOK(_func_(___call.eo_id, ___call.data)); \
+     _efl_object_call_end(&___call); \
+     _EFL_OBJECT_API_AFTER_HOOK \
+     return; \
+     EFL_FUNC_COMMON_OP_END(obj, Name, , ); \
+  }
+
+#define _EFL_OBJECT_FUNC_BODYV_DIRECT(Name, ObjType, Klass, Impl, Ret, DefRet, Arguments, ...) \
+  Ret \
+  Name(ObjType obj, __VA_ARGS__) \
+  { \
+     typedef Ret (*_Eo_##Name##_func)(Eo *, void *obj_data, __VA_ARGS__); \
+     Ret _r; \
+     EFL_FUNC_DIRECT_OP(obj, Name, Klass) \
+       { \
+          _EFL_OBJECT_API_BEFORE_HOOK \
+          _r = _EFL_OBJECT_API_CALL_HOOK(Impl(___direct.eo_id, ___direct.data, Arguments)); \
+          _efl_object_call_end(&___direct); \
+          _EFL_OBJECT_API_AFTER_HOOK \
+          return _r; \
+       } \
+     EFL_FUNC_DIRECT_OP_END(obj, DefRet) \
+     EFL_FUNC_COMMON_OP(obj, Name, DefRet); \
+     _EFL_OBJECT_API_BEFORE_HOOK \
+     _r = _EFL_OBJECT_API_CALL_HOOK(_func_(___call.eo_id, ___call.data, Arguments)); \
+     _efl_object_call_end(&___call); \
+     _EFL_OBJECT_API_AFTER_HOOK \
+     return _r; \
+     EFL_FUNC_COMMON_OP_END(obj, Name, DefRet, ); \
+  }
+
+#define _EFL_OBJECT_VOID_FUNC_BODYV_DIRECT(Name, ObjType, Klass, Impl, Arguments, ...) \
+  void \
+  Name(ObjType obj, __VA_ARGS__) \
+  { \
+     typedef void (*_Eo_##Name##_func)(Eo *, void *obj_data, __VA_ARGS__); \
+     EFL_FUNC_DIRECT_OP(obj, Name, Klass) \
+       { \
+          _EFL_OBJECT_API_BEFORE_HOOK \
+          _EFL_OBJECT_API_CALL_HOOK(Impl(___direct.eo_id, ___direct.data, Arguments)); \
+          _efl_object_call_end(&___direct); \
+          _EFL_OBJECT_API_AFTER_HOOK \
+          return; \
+       } \
+     EFL_FUNC_DIRECT_OP_END(obj, ) \
+     EFL_FUNC_COMMON_OP(obj, Name, ); \
+     _EFL_OBJECT_API_BEFORE_HOOK \
+     _EFL_OBJECT_API_CALL_HOOK(_func_(___call.eo_id, ___call.data, Arguments)); \
+     _efl_object_call_end(&___call); \
+     _EFL_OBJECT_API_AFTER_HOOK \
+     return; \
+     EFL_FUNC_COMMON_OP_END(obj, Name, , ); \
+  }
+
+#define EFL_FUNC_BODY_DIRECT(Name, Klass, Impl, Ret, DefRet) _EFL_OBJECT_FUNC_BODY_DIRECT(Name, Eo *, Klass, Impl, Ret, DefRet)
+#define EFL_VOID_FUNC_BODY_DIRECT(Name, Klass, Impl) _EFL_OBJECT_VOID_FUNC_BODY_DIRECT(Name, Eo *, Klass, Impl)
+#define EFL_FUNC_BODYV_DIRECT(Name, Klass, Impl, Ret, DefRet, Arguments, ...) _EFL_OBJECT_FUNC_BODYV_DIRECT(Name, Eo *, Klass, Impl, Ret, DefRet, EFL_FUNC_CALL(Arguments), __VA_ARGS__)
+#define EFL_VOID_FUNC_BODYV_DIRECT(Name, Klass, Impl, Arguments, ...) _EFL_OBJECT_VOID_FUNC_BODYV_DIRECT(Name, Eo *, Klass, Impl, EFL_FUNC_CALL(Arguments), __VA_ARGS__)
+
+#define EFL_FUNC_BODY_CONST_DIRECT(Name, Klass, Impl, Ret, DefRet) _EFL_OBJECT_FUNC_BODY_DIRECT(Name, const Eo *, Klass, Impl, Ret, DefRet)
+#define EFL_VOID_FUNC_BODY_CONST_DIRECT(Name, Klass, Impl) _EFL_OBJECT_VOID_FUNC_BODY_DIRECT(Name, const Eo *, Klass, Impl)
+#define EFL_FUNC_BODYV_CONST_DIRECT(Name, Klass, Impl, Ret, DefRet, Arguments, ...) _EFL_OBJECT_FUNC_BODYV_DIRECT(Name, const Eo *, Klass, Impl, Ret, DefRet, EFL_FUNC_CALL(Arguments), __VA_ARGS__)
+#define EFL_VOID_FUNC_BODYV_CONST_DIRECT(Name, Klass, Impl, Arguments, ...) _EFL_OBJECT_VOID_FUNC_BODYV_DIRECT(Name, const Eo *, Klass, Impl, EFL_FUNC_CALL(Arguments), __VA_ARGS__)
+
 #ifndef _WIN32
 # define _EFL_OBJECT_OP_API_ENTRY(a) (void*)a
 #else
@@ -1355,6 +1524,15 @@ EAPI Efl_Object_Op _efl_object_op_api_id_get(const void *api_func, const Eo *obj
 // gets the real function pointer and the object data
 EAPI Eina_Bool _efl_object_call_resolve(Eo *obj, const char *func_name, Efl_Object_Op_Call_Data *call, Efl_Object_Op op, const char *file, int line);
 
+// same as above, but tries the class, function and data offset that the
+// call site resolved last time first
+EAPI Eina_Bool _efl_object_call_resolve_cached(Eo *obj, const char *func_name, Efl_Object_Op_Call_Data *call, Efl_Object_Call_Cache *cache, Efl_Object_Op op, const char *file, int line);
+
+// resolves the object for a direct call to a method of the final class
+// klass, fails if the object is of another class or has to be resolved by
+// the usual means. eo_id is set to NULL in call if the object is invalid.
+EAPI Eina_Bool _efl_object_call_resolve_direct(Eo *obj, const Efl_Class *klass, Efl_Object_Op_Call_Data *call, const char *func_name, const char *file, int line);
+
 // end of the eo call barrier, unref the obj
 EAPI void _efl_object_call_end(Efl_Object_Op_Call_Data *call);
 
@@ -1535,6 +1713,67 @@ EAPI Eo *_efl_added_get(void);
 
 EAPI Eo * _efl_add_internal_start(const char *file, int line, const Efl_Class *klass_id, Eo *parent, Eina_Bool ref, Eina_Bool is_fallback);
 
+/**
+ * @typedef Efl_Object_Bulk_Cb
+ * @brief Set up one of the objects created by efl_add_bulk().
+ *
+ * It is called after the constructor and before the finalize of the object,
+ * where efl_add() runs the ops given to it.
+ *
+ * @param data The data given to efl_add_bulk()
+ * @param obj The object being created
+ * @param index The index of @p obj in the array given to efl_add_bulk()
+ *
+ * @since 1.22
+ */
+typedef void (*Efl_Object_Bulk_Cb)(void *data, Eo *obj, unsigned int index);
+
+EAPI unsigned int _efl_add_bulk_internal(const char *file, int line, const Efl_Class *klass_id, Eo *parent, Eo **objs, unsigned int count, Efl_Object_Bulk_Cb init_cb, const void *data, Eina_Bool ref);
+
+/**
+ * @def efl_add_bulk
+ * @brief Create many objects of the same class and add them to a parent.
+ *
+ * This is the same as calling #efl_add @p count times, but each step of
+ * the creation runs for all the objects before the next one, and their ids
+ * are reserved together. Each object is still allocated on its own.
+ *
+ * @param klass The class of the objects to create.
+ * @param parent The parent to set to the objects (MUST not be @c NULL)
+ * @param objs The array receiving the objects, @c NULL for those that could
+ *        not be created. All of them are @c NULL on error.
+ * @param count The number of objects to create.
+ * @param init_cb The function setting up each object, can be @c NULL.
+ * @param data The data given to @p init_cb.
+ * @return The number of objects created.
+ *
+ * @see efl_del_bulk
+ *
+ * @since 1.22
+ */
+#define efl_add_bulk(klass, parent, objs, count, init_cb, data) _efl_add_bulk_internal(__FILE__, __LINE__, klass, parent, objs, count, init_cb, data, EINA_FALSE)
+
+/**
+ * @def efl_add_ref_bulk
+ * @brief Create many objects of the same class and return a reference to
+ *        each of them.
+ *
+ * This is the same as efl_add_bulk() but each object also has a reference
+ * belonging to the caller, as with #efl_add_ref.
+ *
+ * @param klass The class of the objects to create.
+ * @param parent The parent to set to the objects (can be @c NULL).
+ * @param objs The array receiving the objects, @c NULL for those that could
+ *        not be created. All of them are @c NULL on error.
+ * @param count The number of objects to create.
+ * @param init_cb The function setting up each object, can be @c NULL.
+ * @param data The data given to @p init_cb.
+ * @return The number of objects created.
+ *
+ * @since 1.22
+ */
+#define efl_add_ref_bulk(klass, parent, objs, count, init_cb, data) _efl_add_bulk_internal(__FILE__, __LINE__, klass, parent, objs, count, init_cb, data, EINA_TRUE)
+
 /**
  * @brief Unrefs the object and reparents it to NULL.
  *
@@ -1549,6 +1788,23 @@ EAPI Eo * _efl_add_internal_start(const char *file, int line, const Efl_Class *k
  */
 EAPI void efl_del(const Eo *obj);
 
+/**
+ * @brief Call efl_del() on an array of objects.
+ *
+ * The memory of the objects destroyed from the main thread is handed to
+ * the free queue at once instead of one object at a time.
+ *
+ * @param[in] objs The objects, @c NULL ones are skipped.
+ * @param[in] count The number of objects in @p objs.
+ *
+ * @see efl_add_bulk
+ *
+ * @since 1.22
+ *
+ * @ingroup Efl_Object
+ */
+EAPI void efl_del_bulk(Eo **objs, unsigned int count);
+
 /**
  * @brief Set an override for a class
  *
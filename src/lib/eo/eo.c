@@ -86,6 +86,17 @@ static inline void _eo_log_obj_ref_op(const _Eo_Object *obj EINA_UNUSED, Eo_Ref_
 void _eo_log_obj_report(const Eo_Id id EINA_UNUSED, int log_level EINA_UNUSED, const char *func_name EINA_UNUSED, const char *file EINA_UNUSED, int line EINA_UNUSED) { }
 #endif
 
+/* EO_DATA_STATS counts the accesses to the data of each class and reports
+ * the layout of the objects at shutdown, EO_DATA_PROFILE keeps the counts
+ * around so that the next runs place the hot mixin data first. */
+static Eina_Bool _eo_data_stats = EINA_FALSE;
+static Eina_Hash *_eo_data_profile = NULL;
+static char *_eo_data_profile_file = NULL;
+static int _eo_data_log_dom = -1;
+static void _eo_data_layout_init(void);
+static void _eo_data_layout_shutdown(void);
+static Eina_List *_eo_data_mixins_sort(Eina_List *mixins);
+
 static _Efl_Class **_eo_classes = NULL;
 static Eo_Id _eo_classes_last_id = 0;
 static Eo_Id _eo_classes_alloc = 0;
@@ -445,8 +456,62 @@ efl_cast(const Eo *eo_id, const Efl_Class *cur_klass)
    return _efl_super_cast(eo_id, cur_klass, EINA_FALSE);
 }
 
-EAPI Eina_Bool
-_efl_object_call_resolve(Eo *eo_id, const char *func_name, Efl_Object_Op_Call_Data *call, Efl_Object_Op op, const char *file, int line)
+/* The evlog sampling profiler asks what the main loop is doing: remember
+ * the innermost call it is in. This is only switched on at init, so that
+ * every call_end sees what its call_resolve did. */
+static Eina_Bool _eo_evlog_sample = EINA_FALSE;
+static const char *_eo_evlog_op = NULL;
+
+static const char *
+_eo_evlog_sample_cb(void *data EINA_UNUSED)
+{
+#ifdef __ATOMIC_RELAXED
+   return __atomic_load_n(&_eo_evlog_op, __ATOMIC_RELAXED);
+#else
+   return *(const char * volatile *)&_eo_evlog_op;
+#endif
+}
+
+static inline void
+_eo_evlog_op_set(const char *op)
+{
+#ifdef __ATOMIC_RELAXED
+   __atomic_store_n(&_eo_evlog_op, op, __ATOMIC_RELAXED);
+#else
+   *(const char * volatile *)&_eo_evlog_op = op;
+#endif
+}
+
+static inline void
+_eo_evlog_op_push(Efl_Object_Op_Call_Data *call, const char *func_name)
+{
+   if (EINA_LIKELY(!_eo_evlog_sample)) return;
+
+   call->extn2 = NULL;
+   if (!eina_thread_equal(eina_thread_self(), _efl_object_main_thread))
+     return;
+   call->extn1 = (void *)_eo_evlog_op;
+   call->extn2 = call;
+   _eo_evlog_op_set(func_name);
+}
+
+static inline void
+_eo_evlog_op_pop(Efl_Object_Op_Call_Data *call)
+{
+   if (EINA_LIKELY(!_eo_evlog_sample)) return;
+   if (call->extn2 == call) _eo_evlog_op_set(call->extn1);
+}
+
+/* The body of _efl_object_call_resolve(), which the cache misses share.
+ * resolved is the object of eo_id when the caller already looked it up,
+ * the lookup is then released by the call as if it had made it. Errors
+ * are reported as coming from _efl_object_call_resolve() either way. */
+#define RESOLVE_FUNC "_efl_object_call_resolve"
+#define RESOLVE_LOG(_level, ...) \
+   eina_log_print(_eo_log_dom, _level, __FILE__, RESOLVE_FUNC, __LINE__, __VA_ARGS__)
+
+static inline Eina_Bool
+_efl_object_call_resolve_obj(Eo *eo_id, _Eo_Object *resolved, const char *func_name, Efl_Object_Op_Call_Data *call, Efl_Object_Op op, const char *file, int line)
 {
    const _Efl_Class *klass, *main_klass;
    const _Efl_Class *cur_klass = NULL;
@@ -464,12 +529,16 @@ _efl_object_call_resolve(Eo *eo_id, const char *func_name, Efl_Object_Op_Call_Da
 
    if (EINA_LIKELY(is_obj == EINA_TRUE))
      {
-        EO_OBJ_POINTER_RETURN_VAL_PROXY(eo_id, _obj, EINA_FALSE);
+        if (resolved) obj = resolved;
+        else
+          {
+             obj = _eo_obj_pointer_get((Eo_Id)eo_id, func_name, file, line);
+             if (!obj) return EINA_FALSE;
+          }
 
-        obj = _obj;
-        klass = _obj->klass;
+        klass = obj->klass;
         vtable = EO_VTABLE(obj);
-        if (EINA_UNLIKELY(_obj->cur_klass != NULL))
+        if (EINA_UNLIKELY(obj->cur_klass != NULL))
           {
              // YES this is a goto with a label to return. this is a
              // micro-optimization to move infrequent code out of the
@@ -479,7 +548,7 @@ _efl_object_call_resolve(Eo *eo_id, const char *func_name, Efl_Object_Op_Call_Da
 
 obj_super_back:
         call->obj = obj;
-        _efl_ref(_obj);
+        _efl_ref(obj);
      }
    else
      {
@@ -516,6 +585,7 @@ ok_cur_klass_back:
 
         if (is_obj) call->data = _efl_data_scope_get(obj, func->src);
 
+        _eo_evlog_op_push(call, func_name);
         return EINA_TRUE;
      }
 
@@ -546,6 +616,7 @@ end:
                   /* We reffed it above, but no longer need/use it. */
                   _efl_unref(obj);
                   EO_OBJ_DONE(emb_obj_id);
+                  _eo_evlog_op_push(call, func_name);
                   return EINA_TRUE;
                }
 composite_continue:
@@ -557,7 +628,7 @@ composite_continue:
    // If it's a do_super call.
    if (cur_klass)
      {
-        ERR("in %s:%d: func '%s' (%d) could not be resolved for class '%s' for super of '%s'.",
+        RESOLVE_LOG(EINA_LOG_LEVEL_ERR, "in %s:%d: func '%s' (%d) could not be resolved for class '%s' for super of '%s'.",
             file, line, func_name, op, main_klass->desc->name,
             cur_klass->desc->name);
         goto err;
@@ -565,14 +636,14 @@ composite_continue:
    else
      {
         /* we should not be able to take this branch */
-        ERR("in %s:%d: func '%s' (%d) could not be resolved for class '%s'.",
+        RESOLVE_LOG(EINA_LOG_LEVEL_ERR, "in %s:%d: func '%s' (%d) could not be resolved for class '%s'.",
             file, line, func_name, op, main_klass->desc->name);
         goto err;
      }
 
 err_func_src:
-   ERR("in %s:%d: you called a pure virtual func '%s' (%d) of class '%s'.",
-       file, line, func_name, op, klass->desc->name);
+   RESOLVE_LOG(EINA_LOG_LEVEL_ERR, "in %s:%d: you called a pure virtual func '%s' (%d) of class '%s'.",
+               file, line, func_name, op, klass->desc->name);
 err:
    if (is_obj)
      {
@@ -625,7 +696,8 @@ obj_super:
    goto obj_super_back;
 
 err_klass:
-   _EO_POINTER_ERR(eo_id, "in %s:%d: func '%s': obj_id=%p is an invalid ref.", file, line, func_name, eo_id);
+   _eo_pointer_error(eo_id, RESOLVE_FUNC, __FILE__, __LINE__,
+                     "in %s:%d: func '%s': obj_id=%p is an invalid ref.", file, line, func_name, eo_id);
    return EINA_FALSE;
 
 on_null:
@@ -635,13 +707,156 @@ on_null:
         efl_del_api_generation = _efl_object_init_generation;
      }
    if (op != _efl_del_api_op_id)
-     WRN("NULL passed to function %s().", func_name);
+     RESOLVE_LOG(EINA_LOG_LEVEL_WARN, "NULL passed to function %s().", func_name);
    return EINA_FALSE;
 }
 
+#undef RESOLVE_LOG
+#undef RESOLVE_FUNC
+
+EAPI Eina_Bool
+_efl_object_call_resolve(Eo *eo_id, const char *func_name, Efl_Object_Op_Call_Data *call, Efl_Object_Op op, const char *file, int line)
+{
+   return _efl_object_call_resolve_obj(eo_id, NULL, func_name, call, op, file, line);
+}
+
+static unsigned long long _eo_call_cache_misses = 0;
+
+#ifdef __ATOMIC_RELAXED
+/* The cache is a seqlock: call sites are shared between threads and a
+ * reader must never mix the fields of two entries. A writer that finds
+ * it busy just skips the update. */
+static inline Eina_Bool
+_eo_call_cache_get(const Efl_Object_Call_Cache *cache, const _Efl_Class *klass,
+                   void **func, ptrdiff_t *data_offset)
+{
+   unsigned int seq;
+
+   seq = __atomic_load_n(&cache->seq, __ATOMIC_ACQUIRE);
+   if (EINA_UNLIKELY(seq & 1)) return EINA_FALSE;
+   if (__atomic_load_n(&cache->klass, __ATOMIC_RELAXED) != klass)
+     return EINA_FALSE;
+   *func = __atomic_load_n(&cache->func, __ATOMIC_RELAXED);
+   *data_offset = __atomic_load_n(&cache->data_offset, __ATOMIC_RELAXED);
+   __atomic_thread_fence(__ATOMIC_ACQUIRE);
+   return __atomic_load_n(&cache->seq, __ATOMIC_RELAXED) == seq;
+}
+
+static inline void
+_eo_call_cache_set(Efl_Object_Call_Cache *cache, const _Efl_Class *klass,
+                   void *func, ptrdiff_t data_offset)
+{
+   unsigned int seq;
+
+   seq = __atomic_load_n(&cache->seq, __ATOMIC_RELAXED);
+   if (seq & 1) return;
+   if (!__atomic_compare_exchange_n(&cache->seq, &seq, seq + 1, EINA_FALSE,
+                                    __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+     return;
+   __atomic_thread_fence(__ATOMIC_RELEASE);
+   __atomic_store_n(&cache->klass, klass, __ATOMIC_RELAXED);
+   __atomic_store_n(&cache->func, func, __ATOMIC_RELAXED);
+   __atomic_store_n(&cache->data_offset, data_offset, __ATOMIC_RELAXED);
+   __atomic_store_n(&cache->seq, seq + 2, __ATOMIC_RELEASE);
+}
+#endif
+
+EAPI Eina_Bool
+_efl_object_call_resolve_cached(Eo *eo_id, const char *func_name, Efl_Object_Op_Call_Data *call, Efl_Object_Call_Cache *cache, Efl_Object_Op op, const char *file, int line)
+{
+#ifdef __ATOMIC_RELAXED
+   _Eo_Object *obj;
+   void *func;
+   ptrdiff_t data_offset;
+
+   // classes, super calls and objects with their own vtable are not cached
+   if (EINA_UNLIKELY(!eo_id || !_eo_is_a_obj(eo_id)))
+     return _efl_object_call_resolve(eo_id, func_name, call, op, file, line);
+
+   obj = _eo_obj_pointer_get((Eo_Id)eo_id, func_name, file, line);
+   if (EINA_UNLIKELY(!obj)) return EINA_FALSE;
+   // counting data accesses needs to know the class of the data
+   if (EINA_UNLIKELY(obj->cur_klass || obj->opt->vtable || _eo_data_stats))
+     goto no_cache;
+
+   if (EINA_LIKELY(_eo_call_cache_get(cache, obj->klass, &func, &data_offset)))
+     {
+        call->eo_id = eo_id;
+        call->obj = obj;
+        call->func = func;
+        call->data = (data_offset >= 0) ? ((char *)obj) + data_offset : NULL;
+        _efl_ref(obj);
+        _eo_evlog_op_push(call, func_name);
+        return EINA_TRUE;
+     }
+
+   __atomic_add_fetch(&_eo_call_cache_misses, 1, __ATOMIC_RELAXED);
+   if (!_efl_object_call_resolve_obj(eo_id, obj, func_name, call, op, file, line))
+     return EINA_FALSE;
+   // composite objects resolve to another object, keep them out
+   if (call->obj == obj)
+     _eo_call_cache_set(cache, obj->klass, call->func,
+                        call->data ? (char *)call->data - (char *)obj : -1);
+   return EINA_TRUE;
+
+no_cache:
+   return _efl_object_call_resolve_obj(eo_id, obj, func_name, call, op, file, line);
+#else
+   (void)cache;
+#endif
+   return _efl_object_call_resolve(eo_id, func_name, call, op, file, line);
+}
+
+EAPI Eina_Bool
+_efl_object_call_resolve_direct(Eo *eo_id, const Efl_Class *klass_id, Efl_Object_Op_Call_Data *call, const char *func_name, const char *file, int line)
+{
+   _Eo_Object *obj;
+
+   call->eo_id = eo_id;
+   // NULL and classes are handled, and reported, by the regular path
+   if (EINA_UNLIKELY(!eo_id || !_eo_is_a_obj(eo_id)))
+     return EINA_FALSE;
+
+   obj = _eo_obj_pointer_get((Eo_Id)eo_id, func_name, file, line);
+   if (EINA_UNLIKELY(!obj))
+     {
+        call->eo_id = NULL;
+        return EINA_FALSE;
+     }
+
+   // a final class has no subclass, but nothing prevents someone from
+   // calling the method on an object of another class. Super calls and
+   // overrides pick another function, counting data accesses goes through
+   // _efl_data_scope_get().
+   if (EINA_UNLIKELY((_eo_class_id_get(obj->klass) != klass_id) ||
+                     obj->cur_klass || obj->opt->vtable || _eo_data_stats))
+     {
+        _eo_obj_pointer_done((Eo_Id)eo_id);
+        return EINA_FALSE;
+     }
+
+   call->obj = obj;
+   call->func = NULL;
+   call->data = ((char *)obj) + obj->klass->data_offset;
+   _efl_ref(obj);
+   _eo_evlog_op_push(call, func_name);
+   return EINA_TRUE;
+}
+
+EAPI unsigned long long
+efl_object_call_cache_misses_get(void)
+{
+#ifdef __ATOMIC_RELAXED
+   return __atomic_load_n(&_eo_call_cache_misses, __ATOMIC_RELAXED);
+#else
+   return _eo_call_cache_misses;
+#endif
+}
+
 EAPI void
 _efl_object_call_end(Efl_Object_Op_Call_Data *call)
 {
+   _eo_evlog_op_pop(call);
    if (EINA_LIKELY(!!call->obj))
      {
         if (EINA_UNLIKELY(call->obj->auto_unref != 0))
@@ -859,12 +1074,80 @@ err_klass:
    return EINA_FALSE;
 }
 
+static inline void
+_efl_add_obj_init(_Eo_Object *obj, _Efl_Class *klass)
+{
+   obj->opt = eina_cow_alloc(efl_object_optional_cow);
+   _efl_ref(obj);
+   obj->klass = klass;
+}
+
+static inline void
+_efl_add_obj_id_done(_Eo_Object *obj)
+{
+   _eo_log_obj_ref_op(obj, EO_REF_OP_NEW);
+
+   _eo_condtor_reset(obj);
+}
+
+static inline void
+_efl_add_obj_setup(_Eo_Object *obj, _Efl_Class *klass, Eo *parent_id)
+{
+   _efl_add_obj_init(obj, klass);
+   obj->header.id = _eo_id_allocate(obj, parent_id);
+   _efl_add_obj_id_done(obj);
+}
+
+static Eo *
+_efl_add_obj_construct(_Eo_Object *obj, Eo *parent_id, const char *file, int line)
+{
+   const char *func_name = __FUNCTION__;
+   Eo *eo_id = _eo_obj_id_get(obj);
+
+   efl_ref(eo_id);
+
+   /* Reference for the parent if is_ref is done in _efl_add_end */
+   if (parent_id) efl_parent_set(eo_id, parent_id);
+
+   /* eo_id can change here. Freeing is done on the resolved object. */
+   eo_id = efl_constructor(eo_id);
+   // not likely so use goto to alleviate l1 instruction cache of rare code
+   if (!eo_id) goto err_noid;
+   // not likely so use goto to alleviate l1 instruction cache of rare code
+   else if (eo_id != _eo_obj_id_get(obj)) goto ok_nomatch;
+   return eo_id;
+
+ok_nomatch:
+     {
+        EO_OBJ_POINTER_GOTO_PROXY(eo_id, new_obj, err_newid);
+        _efl_ref(new_obj);
+        efl_ref(eo_id);
+        /* We might have two refs on the old object at this point. */
+        efl_parent_set((Eo *) obj->header.id, NULL);
+        efl_unref(_eo_obj_id_get(obj));
+        _efl_unref(obj);
+        EO_OBJ_DONE(eo_id);
+     }
+   return eo_id;
+
+err_noid:
+   ERR("in %s:%d: Object of class '%s' - Error while constructing object",
+       file, line, obj->klass->desc->name);
+   /* We might have two refs at this point. */
+   efl_parent_set((Eo *) obj->header.id, NULL);
+   efl_unref(_eo_obj_id_get(obj));
+   _efl_unref(obj);
+err_newid:
+   return NULL;
+}
+
 EAPI Eo *
 _efl_add_internal_start(const char *file, int line, const Efl_Class *klass_id, Eo *parent_id, Eina_Bool ref, Eina_Bool is_fallback)
 {
    const char *func_name = __FUNCTION__;
    _Eo_Object *obj;
    Eo_Stack_Frame *fptr = NULL;
+   Eo *eo_id;
 
    if (is_fallback) fptr = _efl_add_fallback_stack_push(NULL);
 
@@ -903,56 +1186,13 @@ _efl_add_internal_start(const char *file, int line, const Efl_Class *klass_id, E
      }
    eina_spinlock_release(&klass->objects.trash_lock);
 
-   obj->opt = eina_cow_alloc(efl_object_optional_cow);
-   _efl_ref(obj);
-   obj->klass = klass;
-
-   obj->header.id = _eo_id_allocate(obj, parent_id);
-   Eo *eo_id = _eo_obj_id_get(obj);
-
-   _eo_log_obj_ref_op(obj, EO_REF_OP_NEW);
+   _efl_add_obj_setup(obj, klass, parent_id);
+   eo_id = _efl_add_obj_construct(obj, parent_id, file, line);
 
-   _eo_condtor_reset(obj);
-
-   efl_ref(eo_id);
-
-   /* Reference for the parent if is_ref is done in _efl_add_end */
-   if (parent_id) efl_parent_set(eo_id, parent_id);
-
-   /* eo_id can change here. Freeing is done on the resolved object. */
-   eo_id = efl_constructor(eo_id);
-   // not likely so use goto to alleviate l1 instruction cache of rare code
-   if (!eo_id) goto err_noid;
-   // not likely so use goto to alleviate l1 instruction cache of rare code
-   else if (eo_id != _eo_obj_id_get(obj)) goto ok_nomatch;
-ok_nomatch_back:
-   if (is_fallback) fptr->obj = eo_id;
+   if (eo_id && is_fallback) fptr->obj = eo_id;
    if (parent_id) EO_OBJ_DONE(parent_id);
    return eo_id;
 
-ok_nomatch:
-     {
-        EO_OBJ_POINTER_GOTO_PROXY(eo_id, new_obj, err_newid);
-        _efl_ref(new_obj);
-        efl_ref(eo_id);
-        /* We might have two refs on the old object at this point. */
-        efl_parent_set((Eo *) obj->header.id, NULL);
-        efl_unref(_eo_obj_id_get(obj));
-        _efl_unref(obj);
-        EO_OBJ_DONE(eo_id);
-     }
-   goto ok_nomatch_back;
-
-err_noid:
-   ERR("in %s:%d: Object of class '%s' - Error while constructing object",
-       file, line, klass->desc->name);
-   /* We might have two refs at this point. */
-   efl_parent_set((Eo *) obj->header.id, NULL);
-   efl_unref(_eo_obj_id_get(obj));
-   _efl_unref(obj);
-err_newid:
-   if (parent_id) EO_OBJ_DONE(parent_id);
-   return NULL;
 err_noreg:
    ERR("in %s:%d: Class '%s' is not instantiate-able. Aborting.", file, line, klass->desc->name);
    if (parent_id) EO_OBJ_DONE(parent_id);
@@ -1026,6 +1266,105 @@ _efl_add_end(Eo *eo_id, Eina_Bool is_ref, Eina_Bool is_fallback)
    return ret;
 }
 
+EAPI unsigned int
+_efl_add_bulk_internal(const char *file, int line, const Efl_Class *klass_id, Eo *parent_id,
+                       Eo **objs, unsigned int count, Efl_Object_Bulk_Cb init_cb,
+                       const void *data, Eina_Bool ref)
+{
+   const char *func_name = __FUNCTION__;
+   _Eo_Object **memory;
+   unsigned int i, done = 0;
+
+   EINA_SAFETY_ON_NULL_RETURN_VAL(objs, 0);
+   if (!count) return 0;
+
+   if (class_overrides)
+     {
+        const Efl_Class *override = eina_hash_find(class_overrides, &klass_id);
+        if (override) klass_id = override;
+     }
+
+   EO_CLASS_POINTER_GOTO_PROXY(klass_id, klass, err_klass);
+
+   if (!ref && !parent_id)
+     ERR("in %s:%d: Creation of %u '%s' objects is done without parent. This should use efl_add_ref_bulk.",
+         file, line, count, klass->desc->name);
+
+   if (parent_id)
+     {
+        EO_OBJ_POINTER_GOTO_PROXY(parent_id, parent, err_parent);
+     }
+
+   if (EINA_UNLIKELY(klass->desc->type != EFL_CLASS_TYPE_REGULAR))
+     goto err_noreg;
+
+   // the objects memory is kept in objs until they get their id
+   memory = (_Eo_Object **)objs;
+
+   // take what the trash has in one go, it is only a few objects
+   eina_spinlock_take(&klass->objects.trash_lock);
+   for (i = 0; (i < count) && klass->objects.trash_count; i++)
+     {
+        memory[i] = eina_trash_pop(&klass->objects.trash);
+        if (!memory[i]) break;
+        memset(memory[i], 0, klass->obj_size);
+        klass->objects.trash_count--;
+     }
+   eina_spinlock_release(&klass->objects.trash_lock);
+   for (; i < count; i++)
+     {
+        memory[i] = calloc(1, klass->obj_size);
+        if (EINA_UNLIKELY(!memory[i])) break;
+     }
+   if (EINA_UNLIKELY(i < count))
+     {
+        ERR("in %s:%d: Could not allocate %u '%s' objects, only creating %u.",
+            file, line, count, klass->desc->name, i);
+        memset(objs + i, 0, (count - i) * sizeof(Eo *));
+        count = i;
+     }
+
+   for (i = 0; i < count; i++)
+     _efl_add_obj_init(memory[i], klass);
+   // the ids are reserved together, in a row of the same table as long as
+   // it has room
+   _eo_id_allocate_many(memory, count, parent_id);
+   for (i = 0; i < count; i++)
+     _efl_add_obj_id_done(memory[i]);
+
+   // from now on objs holds ids, NULL for the objects that failed
+   for (i = 0; i < count; i++)
+     objs[i] = _efl_add_obj_construct(memory[i], parent_id, file, line);
+
+   if (init_cb)
+     {
+        for (i = 0; i < count; i++)
+          if (objs[i]) init_cb((void *)data, objs[i], i);
+     }
+
+   for (i = 0; i < count; i++)
+     {
+        if (!objs[i]) continue;
+        objs[i] = _efl_add_end(objs[i], ref, EINA_FALSE);
+        if (objs[i]) done++;
+     }
+
+   if (parent_id) EO_OBJ_DONE(parent_id);
+   return done;
+
+err_noreg:
+   ERR("in %s:%d: Class '%s' is not instantiate-able. Aborting.", file, line, klass->desc->name);
+   if (parent_id) EO_OBJ_DONE(parent_id);
+   memset(objs, 0, count * sizeof(Eo *));
+   return 0;
+
+err_klass:
+   _EO_POINTER_ERR(klass_id, "in %s:%d: Class (%p) is an invalid ref.", file, line, klass_id);
+err_parent:
+   memset(objs, 0, count * sizeof(Eo *));
+   return 0;
+}
+
 EAPI void
 efl_reuse(const Eo *eo_id)
 {
@@ -1042,6 +1381,80 @@ efl_reuse(const Eo *eo_id)
    EO_OBJ_DONE(eo_id);
 }
 
+/* Objects freed by efl_del_bulk() in the main thread go to the free queue
+ * together, runs of objects of the same size in one call */
+#define EO_FREE_BATCH_MAX 256
+
+static struct
+{
+   void        *ptrs[EO_FREE_BATCH_MAX];
+   size_t       sizes[EO_FREE_BATCH_MAX];
+   unsigned int count;
+   unsigned int nest;
+} _eo_free_batch;
+
+static void
+_eo_free_batch_flush(void)
+{
+   unsigned int start, end;
+
+   for (start = 0; start < _eo_free_batch.count; start = end)
+     {
+        for (end = start + 1; end < _eo_free_batch.count; end++)
+          if (_eo_free_batch.sizes[end] != _eo_free_batch.sizes[start]) break;
+        eina_freeq_ptrs_main_add(_eo_free_batch.ptrs + start, end - start,
+                                 free, _eo_free_batch.sizes[start]);
+     }
+   _eo_free_batch.count = 0;
+}
+
+static inline Eina_Bool
+_eo_free_batch_add(void *ptr, size_t size)
+{
+   if (!eina_thread_equal(eina_thread_self(), _efl_object_main_thread))
+     return EINA_FALSE;
+   if (EINA_LIKELY(!_eo_free_batch.nest)) return EINA_FALSE;
+
+   if (_eo_free_batch.count == EO_FREE_BATCH_MAX) _eo_free_batch_flush();
+   _eo_free_batch.ptrs[_eo_free_batch.count] = ptr;
+   _eo_free_batch.sizes[_eo_free_batch.count] = size;
+   _eo_free_batch.count++;
+   return EINA_TRUE;
+}
+
+Eina_Bool
+_eo_free_batch_begin(void)
+{
+   if (!eina_thread_equal(eina_thread_self(), _efl_object_main_thread))
+     return EINA_FALSE;
+   _eo_free_batch.nest++;
+   return EINA_TRUE;
+}
+
+void
+_eo_free_batch_end(void)
+{
+   if (--_eo_free_batch.nest) return;
+   _eo_free_batch_flush();
+}
+
+/* Runs once no lockless reader of the shared domain can see the object
+ * anymore. */
+static void
+_eo_shared_obj_free(void *ptr)
+{
+   _Eo_Object *obj = ptr;
+
+   if (_obj_is_override(obj))
+     {
+        _vtable_func_clean_all(obj->opt->vtable);
+        free(obj->opt->vtable);
+        EO_OPTIONAL_COW_SET(obj, vtable, NULL);
+     }
+   eina_cow_free(efl_object_optional_cow, (Eina_Cow_Data *) &obj->opt);
+   free(obj);
+}
+
 void
 _eo_free(_Eo_Object *obj, Eina_Bool manual_free EINA_UNUSED)
 {
@@ -1086,6 +1499,16 @@ _eo_free(_Eo_Object *obj, Eina_Bool manual_free EINA_UNUSED)
           }
      }
 #endif
+   // lockless lookups of the shared domain may still be reading it, and
+   // the trash would hand it to a new object
+   if (EINA_UNLIKELY(((((Eo_Id) _eo_obj_id_get(obj)) >> SHIFT_DOMAIN) & MASK_DOMAIN)
+                     == EFL_ID_DOMAIN_SHARED))
+     {
+        _eo_id_release((Eo_Id) _eo_obj_id_get(obj));
+        _eo_epoch_retire(obj, _eo_shared_obj_free);
+        return;
+     }
+
    if (_obj_is_override(obj))
      {
         _vtable_func_clean_all(obj->opt->vtable);
@@ -1101,12 +1524,12 @@ _eo_free(_Eo_Object *obj, Eina_Bool manual_free EINA_UNUSED)
      {
         eina_trash_push(&klass->objects.trash, obj);
         klass->objects.trash_count++;
-     }
-   else
-     {
-        eina_freeq_ptr_main_add(obj, free, klass->obj_size);
+        obj = NULL;
      }
    eina_spinlock_release(&klass->objects.trash_lock);
+
+   if (obj && !_eo_free_batch_add(obj, klass->obj_size))
+     eina_freeq_ptr_main_add(obj, free, klass->obj_size);
 }
 /*****************************************************************************/
 
@@ -1121,9 +1544,9 @@ efl_class_get(const Eo *eo_id)
         return EFL_CLASS_CLASS;
      }
 
-   EO_OBJ_POINTER_GOTO(eo_id, obj, err_obj);
+   EO_OBJ_POINTER_READ_GOTO(eo_id, obj, err_obj);
    klass = _eo_class_id_get(obj->klass);
-   EO_OBJ_DONE(eo_id);
+   EO_OBJ_READ_DONE(eo_id);
    return klass;
 
 err_klass:
@@ -1144,9 +1567,9 @@ efl_class_name_get(const Efl_Class *eo_id)
      }
    else
      {
-        EO_OBJ_POINTER_GOTO(eo_id, obj, err_obj);
+        EO_OBJ_POINTER_READ_GOTO(eo_id, obj, err_obj);
         klass = obj->klass;
-        EO_OBJ_DONE(eo_id);
+        EO_OBJ_READ_DONE(eo_id);
      }
    return klass->desc->name;
 
@@ -1168,9 +1591,9 @@ efl_class_memory_size_get(const Efl_Class *eo_id)
      }
    else
      {
-        EO_OBJ_POINTER_GOTO(eo_id, obj, err_obj);
+        EO_OBJ_POINTER_READ_GOTO(eo_id, obj, err_obj);
         klass = obj->klass;
-        EO_OBJ_DONE(eo_id);
+        EO_OBJ_READ_DONE(eo_id);
      }
    return klass->obj_size;
 
@@ -1619,6 +2042,10 @@ efl_class_new(const Efl_Class_Description *desc, const Efl_Class *parent_id, ...
    mro = eina_list_prepend(mro, klass);
    if ((desc->type == EFL_CLASS_TYPE_MIXIN) && (desc->data_size > 0))
      mixins = eina_list_prepend(mixins, klass);
+   /* The data of regular classes is at the same offset in all the
+    * subclasses, only mixins data can be moved around. */
+   if (_eo_data_profile)
+     mixins = _eo_data_mixins_sort(mixins);
 
    /* Copy the extensions and free the list */
      {
@@ -1808,33 +2235,16 @@ efl_isa(const Eo *eo_id, const Efl_Class *klass_id)
      }
    else
      {
-        eina_lock_take(&(_eo_table_data_shared_data->obj_lock));
-
-        if ((tdata->cache.isa_id == eo_id) &&
-            (tdata->cache.klass == klass_id))
-          {
-             isa = tdata->cache.isa;
-             // since this is the cache we hope this gets a lot of hits and
-             // thus lets assume the hit is the mot important thing thus
-             // put the lock release and return here inline in the l1
-             // instruction cache hopefully already fetched
-             eina_lock_release(&(_eo_table_data_shared_data->obj_lock));
-             return isa;
-          }
-
+        // no cache, it would be shared by every thread. The vtable may be
+        // an override that efl_object_override() frees under the lock, so
+        // this is not a lockless lookup
         EO_OBJ_POINTER_GOTO(eo_id, obj, err_shared_obj);
         EO_CLASS_POINTER_GOTO(klass_id, klass, err_shared_class);
         const op_type_funcs *func = _vtable_func_get
           (EO_VTABLE(obj), klass->base_id + klass->ops_count);
 
-        // Caching the result as we do a lot of serial efl_isa due to evas_object_image using it.
-        tdata->cache.isa_id = eo_id;
-        tdata->cache.klass = klass_id;
-        // Currently implemented by reusing the LAST op id. Just marking it with
-        // _eo_class_isa_func.
-        isa = tdata->cache.isa = (func && (func->func == _eo_class_isa_func));
+        isa = (func && (func->func == _eo_class_isa_func));
         EO_OBJ_DONE(eo_id);
-        eina_lock_release(&(_eo_table_data_shared_data->obj_lock));
      }
    return isa;
 
@@ -1842,7 +2252,6 @@ err_shared_class: EINA_COLD
    _EO_POINTER_ERR(klass_id, "Class (%p) is an invalid ref.", klass_id);
    EO_OBJ_DONE(eo_id);
 err_shared_obj: EINA_COLD
-   eina_lock_release(&(_eo_table_data_shared_data->obj_lock));
    return EINA_FALSE;
 
 err_class0:
@@ -2066,6 +2475,15 @@ _efl_data_scope_safe_get(const _Eo_Object *obj, const _Efl_Class *klass)
 static inline void *
 _efl_data_scope_get(const _Eo_Object *obj, const _Efl_Class *klass)
 {
+   if (EINA_UNLIKELY(_eo_data_stats))
+     {
+#ifdef __ATOMIC_RELAXED
+        __atomic_add_fetch(&((_Efl_Class *)klass)->data_access, 1, __ATOMIC_RELAXED);
+#else
+        ((_Efl_Class *)klass)->data_access++;
+#endif
+     }
+
    if (EINA_LIKELY(klass->desc->type != EFL_CLASS_TYPE_MIXIN))
      return ((char *) obj) + klass->data_offset;
 
@@ -2162,7 +2580,7 @@ EAPI void *
 efl_data_scope_get(const Eo *obj_id, const Efl_Class *klass_id)
 {
    void *ret = NULL;
-   EO_OBJ_POINTER_RETURN_VAL(obj_id, obj, NULL);
+   EO_OBJ_POINTER_READ_RETURN_VAL(obj_id, obj, NULL);
    EO_CLASS_POINTER_GOTO(klass_id, klass, err_klass);
 
 #ifndef EO_DEBUG
@@ -2182,7 +2600,7 @@ efl_data_scope_get(const Eo *obj_id, const Efl_Class *klass_id)
 #endif
 
 err_klass:
-   EO_OBJ_DONE(obj_id);
+   EO_OBJ_READ_DONE(obj_id);
    return ret;
 }
 
@@ -2192,7 +2610,7 @@ efl_data_scope_safe_get(const Eo *obj_id, const Efl_Class *klass_id)
    void *ret = NULL;
 
    if (!obj_id) return NULL;
-   EO_OBJ_POINTER_RETURN_VAL(obj_id, obj, NULL);
+   EO_OBJ_POINTER_READ_RETURN_VAL(obj_id, obj, NULL);
    EO_CLASS_POINTER_GOTO(klass_id, klass, err_klass);
    if (obj->destructed) goto err_klass;
 
@@ -2207,7 +2625,7 @@ efl_data_scope_safe_get(const Eo *obj_id, const Efl_Class *klass_id)
      }
 
 err_klass:
-   EO_OBJ_DONE(obj_id);
+   EO_OBJ_READ_DONE(obj_id);
    return ret;
 }
 
@@ -2293,6 +2711,9 @@ efl_object_init(void)
 #endif
 
    _efl_object_main_thread = eina_thread_self();
+   _eo_call_cache_misses = 0;
+   _eo_evlog_op = NULL;
+   _eo_evlog_sample = eina_evlog_sample_cb_set(_eo_evlog_sample_cb, NULL);
 
    _eo_sz = EO_ALIGN_SIZE(sizeof(_Eo_Object));
    _eo_class_sz = EO_ALIGN_SIZE(sizeof(_Efl_Class));
@@ -2320,6 +2741,7 @@ efl_object_init(void)
      }
 
    _eo_log_obj_init();
+   _eo_data_layout_init();
 
    eina_magic_string_static_set(EO_EINA_MAGIC, EO_EINA_MAGIC_STR);
    eina_magic_string_static_set(EO_FREED_EINA_MAGIC,
@@ -2412,6 +2834,14 @@ efl_object_shutdown(void)
 
    _efl_add_fallback_shutdown();
 
+   if (_eo_evlog_sample)
+     {
+        eina_evlog_sample_cb_set(NULL, NULL);
+        _eo_evlog_sample = EINA_FALSE;
+     }
+
+   _eo_data_layout_shutdown();
+
    for (i = 0 ; i < _eo_classes_last_id ; i++, cls_itr--)
      {
         if (*cls_itr)
@@ -2432,6 +2862,7 @@ efl_object_shutdown(void)
    eina_tls_free(_eo_table_data);
    if (_eo_table_data_shared)
      {
+        _eo_epoch_shutdown();
         _eo_free_ids_tables(_eo_table_data_shared);
         _eo_table_data_shared = NULL;
         _eo_table_data_shared_data = NULL;
@@ -3383,6 +3814,230 @@ _eo_log_obj_shutdown(void)
 }
 #endif
 
+typedef struct
+{
+   const _Efl_Class *klass;
+   size_t offset;
+} Eo_Data_Block;
+
+static unsigned long long
+_eo_data_profile_count(const _Efl_Class *klass)
+{
+   const unsigned long long *count;
+
+   count = eina_hash_find(_eo_data_profile, klass->desc->name);
+   return count ? *count : 0;
+}
+
+static Eina_List *
+_eo_data_mixins_sort(Eina_List *mixins)
+{
+   const _Efl_Class *kls, *cur;
+   Eina_List *sorted = NULL, *l;
+
+   // hottest first, stable so that unknown classes keep the MRO order
+   EINA_LIST_FREE(mixins, kls)
+     {
+        unsigned long long count = _eo_data_profile_count(kls);
+
+        EINA_LIST_FOREACH(sorted, l, cur)
+          if (_eo_data_profile_count(cur) < count) break;
+        if (l) sorted = eina_list_prepend_relative_list(sorted, kls, l);
+        else sorted = eina_list_append(sorted, kls);
+     }
+
+   return sorted;
+}
+
+static void
+_eo_data_profile_load(const char *file)
+{
+   char line[512];
+   FILE *f;
+
+   _eo_data_profile = eina_hash_string_superfast_new(free);
+   if (!_eo_data_profile) return;
+
+   // a missing profile is fine, this is the run that records it
+   f = fopen(file, "r");
+   if (!f) return;
+
+   while (fgets(line, sizeof(line), f))
+     {
+        unsigned long long *count;
+        char name[256];
+        unsigned long long n;
+
+        if (sscanf(line, "%255s %llu", name, &n) != 2) continue;
+        count = malloc(sizeof(*count));
+        if (!count) break;
+        *count = n;
+        eina_hash_set(_eo_data_profile, name, count);
+     }
+   fclose(f);
+
+   EINA_LOG_DOM_DBG(_eo_data_log_dom, "loaded %d classes from data profile '%s'",
+                    eina_hash_population(_eo_data_profile), file);
+}
+
+static void
+_eo_data_profile_save(const char *file)
+{
+   size_t i;
+   FILE *f;
+
+   f = fopen(file, "w");
+   if (!f)
+     {
+        EINA_LOG_DOM_ERR(_eo_data_log_dom, "could not write data profile '%s'", file);
+        return;
+     }
+
+   for (i = 0; i < _eo_classes_last_id; i++)
+     {
+        const _Efl_Class *klass = _eo_classes[i];
+
+        if ((!klass) || (!klass->data_access)) continue;
+        fprintf(f, "%s %llu\n", klass->desc->name, klass->data_access);
+     }
+   fclose(f);
+}
+
+static int
+_eo_data_block_cmp(const void *a, const void *b)
+{
+   const Eo_Data_Block *ba = a, *bb = b;
+
+   if (ba->offset == bb->offset) return 0;
+   return (ba->offset < bb->offset) ? -1 : 1;
+}
+
+static unsigned int
+_eo_data_blocks_get(const _Efl_Class *klass, Eo_Data_Block *blocks, unsigned int max)
+{
+   const Eo_Extension_Data_Offset *extn;
+   const _Efl_Class *kls;
+   unsigned int count = 0;
+
+   for (kls = klass; kls && (count < max); kls = kls->parent)
+     {
+        if (!kls->desc->data_size) continue;
+        blocks[count].klass = kls;
+        blocks[count++].offset = kls->data_offset;
+     }
+   for (extn = klass->extn_data_off; extn && extn->klass && (count < max); extn++)
+     {
+        blocks[count].klass = extn->klass;
+        blocks[count++].offset = extn->offset;
+     }
+   qsort(blocks, count, sizeof(Eo_Data_Block), _eo_data_block_cmp);
+
+   return count;
+}
+
+/* One entry per class with instances whose data was used: the blocks in
+ * memory order with their padding and share of the accesses. A block is hot
+ * when it gets at least 1% of the accesses to the data of its object. */
+static void
+_eo_data_layout_report(void)
+{
+   Eo_Data_Block blocks[128];
+   size_t i;
+
+   for (i = 0; i < _eo_classes_last_id; i++)
+     {
+        const _Efl_Class *klass = _eo_classes[i];
+        unsigned long long total = 0;
+        unsigned int count, j, padding = 0, hot = _eo_sz, cold = 0;
+
+        if ((!klass) ||
+            (klass->desc->type == EFL_CLASS_TYPE_INTERFACE) ||
+            (klass->desc->type == EFL_CLASS_TYPE_MIXIN)) continue;
+
+        count = _eo_data_blocks_get(klass, blocks, EINA_C_ARRAY_LENGTH(blocks));
+        for (j = 0; j < count; j++)
+          total += blocks[j].klass->data_access;
+        if (!total) continue;
+
+        for (j = 0; j < count; j++)
+          {
+             size_t size = blocks[j].klass->desc->data_size;
+
+             padding += EO_ALIGN_SIZE(size) - size;
+             if (blocks[j].klass->data_access * 100 >= total) hot += size;
+             else cold += size;
+          }
+
+        EINA_LOG_DOM_INFO(_eo_data_log_dom,
+                          "%s: %u bytes, %zu header, %u padding, %u hot, %u cold",
+                          klass->desc->name, klass->obj_size, _eo_sz,
+                          padding, hot, cold);
+        for (j = 0; j < count; j++)
+          {
+             const _Efl_Class *kls = blocks[j].klass;
+             size_t size = kls->desc->data_size;
+
+             EINA_LOG_DOM_INFO(_eo_data_log_dom,
+                               "  %6zu %-40s %6zu bytes %3zu padding %12llu accesses %s",
+                               blocks[j].offset, kls->desc->name, size,
+                               EO_ALIGN_SIZE(size) - size, kls->data_access,
+                               (kls->data_access * 100 >= total) ? "hot" : "cold");
+          }
+     }
+}
+
+static void
+_eo_data_layout_init(void)
+{
+   const char *s;
+
+   _eo_data_stats = EINA_FALSE;
+   _eo_data_profile = NULL;
+   _eo_data_profile_file = NULL;
+
+   s = getenv("EO_DATA_STATS");
+   if ((s) && (s[0] != '\0') && (s[0] != '0'))
+     _eo_data_stats = EINA_TRUE;
+
+   s = getenv("EO_DATA_PROFILE");
+   if ((s) && (s[0] != '\0'))
+     _eo_data_profile_file = strdup(s);
+
+   if ((!_eo_data_stats) && (!_eo_data_profile_file)) return;
+
+   _eo_data_log_dom = eina_log_domain_register("eo_layout", EINA_COLOR_CYAN);
+   // the report is what was asked for, do not hide it
+   if ((_eo_data_stats) &&
+       (eina_log_domain_registered_level_get(_eo_data_log_dom) < EINA_LOG_LEVEL_INFO))
+     eina_log_domain_level_set("eo_layout", EINA_LOG_LEVEL_INFO);
+
+   if (_eo_data_profile_file)
+     _eo_data_profile_load(_eo_data_profile_file);
+}
+
+static void
+_eo_data_layout_shutdown(void)
+{
+   if (_eo_data_stats)
+     {
+        _eo_data_layout_report();
+        if (_eo_data_profile_file)
+          _eo_data_profile_save(_eo_data_profile_file);
+     }
+   _eo_data_stats = EINA_FALSE;
+
+   eina_hash_free(_eo_data_profile);
+   _eo_data_profile = NULL;
+   free(_eo_data_profile_file);
+   _eo_data_profile_file = NULL;
+
+   if (_eo_data_log_dom >= 0)
+     {
+        eina_log_domain_unregister(_eo_data_log_dom);
+        _eo_data_log_dom = -1;
+     }
+}
+
 typedef struct
 {
    Eina_Iterator iterator;
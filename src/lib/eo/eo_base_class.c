@@ -23,6 +23,7 @@ static int event_freeze_count = 0;
 
 typedef struct _Eo_Callback_Description  Eo_Callback_Description;
 typedef struct _Efl_Event_Callback_Frame Efl_Event_Callback_Frame;
+typedef struct _Eo_Event_Index           Eo_Event_Index;
 
 struct _Efl_Event_Callback_Frame
 {
@@ -39,6 +40,7 @@ typedef struct
    Eo                        *composite_parent;
    Eina_Inlist               *generic_data;
    Eo                      ***wrefs;
+   Eo_Event_Index            *event_index;
 } Efl_Object_Extension;
 
 struct _Efl_Object_Data
@@ -53,6 +55,7 @@ struct _Efl_Object_Data
    Efl_Event_Callback_Frame  *event_frame;
    Eo_Callback_Description  **callbacks;
    Eina_Inlist               *pending_futures;
+   uint64_t                   event_mask; // one bit per hashed event description with a callback
    unsigned int               callbacks_count;
 
    unsigned short             event_freeze_count;
@@ -62,6 +65,8 @@ struct _Efl_Object_Data
    unsigned short             event_cb_efl_event_noref_count;
    Eina_Bool                  callback_stopped : 1;
    Eina_Bool                  need_cleaning : 1;
+   Eina_Bool                  event_mask_dirty : 1; // bits of removed callbacks may still be set
+   Eina_Bool                  event_index_dirty : 1;
    Eina_Bool                  allow_parent_unref : 1; // Allows unref to zero even with a parent
    Eina_Bool                  has_destroyed_event_cb : 1; // No proper count: minor optimization triggered at destruction only
 };
@@ -207,6 +212,7 @@ _efl_object_extension_noneed(Efl_Object_Data *pd)
        (ext->comment) ||
        (ext->generic_data) ||
        (ext->wrefs) ||
+       (ext->event_index) ||
        (ext->composite_parent)) return;
    _efl_object_extension_free(pd->ext);
    pd->ext = NULL;
@@ -686,6 +692,19 @@ efl_del(const Eo *obj)
    EO_OBJ_DONE(obj);
 }
 
+EAPI void
+efl_del_bulk(Eo **objs, unsigned int count)
+{
+   Eina_Bool batch;
+   unsigned int i;
+
+   if (!objs) return;
+   batch = _eo_free_batch_begin();
+   for (i = 0; i < count; i++)
+     efl_del(objs[i]);
+   if (batch) _eo_free_batch_end();
+}
+
 void
 _efl_object_reuse(_Eo_Object *obj)
 {
@@ -1157,6 +1176,193 @@ _efl_pending_future_new(void)
 #define CB_COUNT_INC(cnt) do { if ((cnt) != 0xffff) (cnt)++; } while(0)
 #define CB_COUNT_DEC(cnt) do { if ((cnt) != 0xffff) (cnt)--; } while(0)
 
+/* Every object keeps a 64 bits mask with one bit set per event description
+ * it has a callback for, so that emitting an event nobody listens to does
+ * not walk the callbacks. Objects with many callbacks also get an index of
+ * the callbacks sorted by event description, built lazily on emission. */
+
+// below this, walking the callbacks is cheaper than keeping the index
+#define EVENT_INDEX_MIN 16
+
+typedef struct
+{
+   const Efl_Event_Description *desc;
+   unsigned int                 idx; // position in callbacks + 1
+} Eo_Event_Index_Item;
+
+struct _Eo_Event_Index
+{
+   unsigned int        count;
+   Eo_Event_Index_Item items[];
+};
+
+static inline uint64_t
+_eo_event_bit(const Efl_Event_Description *desc)
+{
+   // descriptions are static and aligned, mix the pointer to spread them
+   return 1ULL << (((uint64_t)(uintptr_t)desc * 0x9E3779B97F4A7C15ULL) >> 58);
+}
+
+static inline uint64_t
+_eo_callback_mask(const Eo_Callback_Description *cb)
+{
+   const Efl_Callback_Array_Item *it;
+   uint64_t mask = 0;
+
+   if (!cb->func_array) return _eo_event_bit(cb->items.item.desc);
+   for (it = cb->items.item_array; it->func; it++)
+     mask |= _eo_event_bit(it->desc);
+   return mask;
+}
+
+static void
+_eo_event_mask_update(Efl_Object_Data *pd)
+{
+   unsigned int i;
+
+   pd->event_mask = 0;
+   for (i = 0; i < pd->callbacks_count; i++)
+     {
+        if (pd->callbacks[i]->delete_me) continue;
+        pd->event_mask |= _eo_callback_mask(pd->callbacks[i]);
+     }
+   pd->event_mask_dirty = EINA_FALSE;
+}
+
+static void
+_eo_event_index_free(Efl_Object_Data *pd)
+{
+   if ((!pd->ext) || (!pd->ext->event_index)) return;
+   free(pd->ext->event_index);
+   pd->ext->event_index = NULL;
+   _efl_object_extension_noneed(pd);
+}
+
+/* An emission may be walking the index, it can only go away once all of
+ * them are done. */
+static inline void
+_eo_event_index_invalidate(Efl_Object_Data *pd)
+{
+   if ((!pd->ext) || (!pd->ext->event_index)) return;
+   if (pd->event_frame) pd->event_index_dirty = EINA_TRUE;
+   else _eo_event_index_free(pd);
+}
+
+static int
+_eo_event_index_cmp(const void *a, const void *b)
+{
+   const Eo_Event_Index_Item *ia = a, *ib = b;
+
+   if (ia->desc != ib->desc)
+     return ((uintptr_t)ia->desc < (uintptr_t)ib->desc) ? -1 : 1;
+   return (int)ia->idx - (int)ib->idx;
+}
+
+static Eo_Event_Index *
+_eo_event_index_build(Efl_Object_Data *pd)
+{
+   const Efl_Callback_Array_Item *it;
+   Eo_Event_Index *index;
+   unsigned int count = 0, i, j;
+
+   for (i = 0; i < pd->callbacks_count; i++)
+     {
+        if (!pd->callbacks[i]->func_array) count++;
+        else for (it = pd->callbacks[i]->items.item_array; it->func; it++) count++;
+     }
+
+   index = malloc(sizeof (Eo_Event_Index) + count * sizeof (Eo_Event_Index_Item));
+   if (!index) return NULL;
+
+   for (i = 0, j = 0; i < pd->callbacks_count; i++)
+     {
+        const Eo_Callback_Description *cb = pd->callbacks[i];
+
+        if (!cb->func_array)
+          {
+             index->items[j].desc = cb->items.item.desc;
+             index->items[j++].idx = i + 1;
+          }
+        else for (it = cb->items.item_array; it->func; it++)
+          {
+             index->items[j].desc = it->desc;
+             index->items[j++].idx = i + 1;
+          }
+     }
+   qsort(index->items, count, sizeof (Eo_Event_Index_Item), _eo_event_index_cmp);
+
+   // an array can list the same event twice, it is walked once
+   for (i = 0, j = 0; i < count; i++)
+     {
+        if (j && (index->items[j - 1].desc == index->items[i].desc) &&
+            (index->items[j - 1].idx == index->items[i].idx))
+          continue;
+        index->items[j++] = index->items[i];
+     }
+   index->count = j;
+
+   return index;
+}
+
+/* Kept out of the emission, it is only needed when callbacks change */
+static EINA_COLD Eo_Event_Index *
+_eo_event_index_update(Efl_Object_Data *pd)
+{
+   Eo_Event_Index *index;
+
+   // an outer emission might still be walking the old one
+   if (pd->event_frame) return NULL;
+   _eo_event_index_free(pd);
+   pd->event_index_dirty = EINA_FALSE;
+
+   if (!_efl_object_extension_need(pd)) return NULL;
+   index = _eo_event_index_build(pd);
+   pd->ext->event_index = index;
+   if (!index) _efl_object_extension_noneed(pd);
+   return index;
+}
+
+/* Find the callbacks listening to desc, in the order of the callbacks. */
+static inline const Eo_Event_Index_Item *
+_eo_event_index_find(Efl_Object_Data *pd, const Efl_Event_Description *desc,
+                     unsigned int *count)
+{
+   const Eo_Event_Index_Item *items;
+   Eo_Event_Index *index;
+   unsigned int start, end, middle, first;
+
+   if (pd->callbacks_count < EVENT_INDEX_MIN) return NULL;
+
+   index = pd->ext ? pd->ext->event_index : NULL;
+   if (EINA_UNLIKELY((!index) || (pd->event_index_dirty)))
+     {
+        index = _eo_event_index_update(pd);
+        if (!index) return NULL;
+     }
+
+   // both ends of the run of items for desc
+   items = index->items;
+   start = 0;
+   end = index->count;
+   while (start < end)
+     {
+        middle = start + ((end - start) / 2);
+        if ((uintptr_t)items[middle].desc < (uintptr_t)desc) start = middle + 1;
+        else end = middle;
+     }
+   first = start;
+   end = index->count;
+   while (start < end)
+     {
+        middle = start + ((end - start) / 2);
+        if (items[middle].desc == desc) start = middle + 1;
+        else end = middle;
+     }
+
+   *count = start - first;
+   return items + first;
+}
+
 static inline void
 _special_event_count_inc(Eo *obj_id, Efl_Object_Data *pd, const Efl_Callback_Array_Item *it)
 {
@@ -1218,6 +1424,8 @@ _eo_callback_remove(Eo *obj, Efl_Object_Data *pd, Eo_Callback_Description **cb)
    else _special_event_count_dec(obj, pd, &((*cb)->items.item));
 
    _eo_callback_free(*cb);
+   pd->event_mask_dirty = EINA_TRUE;
+   _eo_event_index_invalidate(pd);
 
    length = pd->callbacks_count - (cb - pd->callbacks);
    if (length > 1)
@@ -1245,6 +1453,10 @@ _eo_callback_remove_all(Efl_Object_Data *pd)
    eina_freeq_ptr_main_add(pd->callbacks, free, 0);
    pd->callbacks = NULL;
    pd->callbacks_count = 0;
+   pd->event_mask = 0;
+   pd->event_mask_dirty = EINA_FALSE;
+   pd->event_index_dirty = EINA_FALSE;
+   _eo_event_index_free(pd);
    pd->has_destroyed_event_cb = EINA_FALSE;
    pd->event_cb_efl_event_callback_add_count = 0;
    pd->event_cb_efl_event_callback_del_count = 0;
@@ -1361,6 +1573,8 @@ _eo_callbacks_sorted_insert(Efl_Object_Data *pd, Eo_Callback_Description *cb)
    *itr = cb;
 
    pd->callbacks_count++;
+   pd->event_mask |= _eo_callback_mask(cb);
+   _eo_event_index_invalidate(pd);
 
    // Update possible event emissions
    for (frame = pd->event_frame; frame; frame = frame->next)
@@ -1611,8 +1825,9 @@ _event_callback_call(Eo *obj_id, Efl_Object_Data *pd,
 {
    Eo_Callback_Description **cb;
    Eo_Current_Callback_Description *lookup, saved;
+   const Eo_Event_Index_Item *run = NULL;
    Efl_Event ev;
-   unsigned int idx;
+   unsigned int idx, run_count = 0;
    Eina_Bool callback_already_stopped, ret;
    Efl_Event_Callback_Frame frame = {
       .next = NULL,
@@ -1631,6 +1846,21 @@ _event_callback_call(Eo *obj_id, Efl_Object_Data *pd,
    else if ((desc == EFL_EVENT_NOREF) &&
             (pd->event_cb_efl_event_noref_count == 0)) return EINA_FALSE;
 
+   // Legacy events match by name, neither the mask nor the index know them
+   if (!legacy_compare)
+     {
+        if (EINA_UNLIKELY(pd->event_mask_dirty)) _eo_event_mask_update(pd);
+        // Same result as walking all the callbacks without finding any
+        if (!(pd->event_mask & _eo_event_bit(desc))) return EINA_TRUE;
+        if (!desc->restart)
+          {
+             run = _eo_event_index_find(pd, desc, &run_count);
+             if (run && !run_count) return EINA_TRUE;
+             // Most callbacks are for this event, walking them all is faster
+             if (run_count > (pd->callbacks_count / 4)) run = NULL;
+          }
+     }
+
    if (pd->event_frame)
      frame.generation = ((Efl_Event_Callback_Frame*)pd->event_frame)->generation + 1;
 
@@ -1648,10 +1878,13 @@ _event_callback_call(Eo *obj_id, Efl_Object_Data *pd,
    // Handle event that require to restart where we were in the nested list walking
    // relatively unlikely so improve l1 instr cache by using goto
    if (desc->restart) goto restart;
+   // Jump from one callback listening to this event to the next one
+   else if (run) idx = run[--run_count].idx;
    else idx = pd->callbacks_count;
 restart_back:
 
-   for (; idx > 0; idx--)
+   for (; idx > 0;
+        idx = EINA_LIKELY(!run) ? idx - 1 : (run_count ? run[--run_count].idx : 0))
      {
         frame.idx = idx;
         cb = pd->callbacks + idx - 1;
@@ -1714,6 +1947,8 @@ restart_back:
                     goto end;
                }
           }
+        // Callbacks were inserted below us, the index is now off
+        if (frame.inserted_before) run = NULL;
         idx += frame.inserted_before;
         frame.inserted_before = 0;
      }
@@ -2296,7 +2531,7 @@ _efl_object_class_constructor(Efl_Class *klass EINA_UNUSED)
    _legacy_events_hash = eina_hash_stringshared_new(_legacy_events_hash_free_cb);
 
    _eo_callback_mempool =
-      eina_mempool_add("chained_mempool", NULL, NULL,
+      eina_mempool_add("chained_mempool", NULL, "magazine",
                        sizeof(Eo_Callback_Description), 256);
 
    _efl_pending_future_mempool =
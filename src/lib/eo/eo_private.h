@@ -65,6 +65,9 @@ typedef struct _Efl_Object_Optional Efl_Object_Optional;
 /* Allocates an entry for the given object */
 static inline Eo_Id _eo_id_allocate(const _Eo_Object *obj, const Eo *parent_id);
 
+/* Allocates entries for count objects and sets their ids */
+static inline void _eo_id_allocate_many(_Eo_Object **objs, unsigned int count, const Eo *parent_id);
+
 /* Releases an entry by the object id */
 static inline void _eo_id_release(const Eo_Id obj_id);
 
@@ -206,6 +209,8 @@ struct _Efl_Class
    unsigned int data_offset; /* < Offset of the data within object data. */
    unsigned int ops_count; /* < Offset of the data within object data. */
 
+   unsigned long long data_access; /* < Accesses to the data of this class, counted with EO_DATA_STATS. */
+
    Eina_Thread construction_thread; /** < the thread which called the class constructor */
 
    Eina_Bool constructed : 1;
@@ -237,6 +242,9 @@ Eo *_eo_header_id_get(const Eo_Header *header)
 
 /* Retrieves the pointer to the object from the id */
 _Eo_Object *_eo_obj_pointer_get(const Eo_Id obj_id, const char *func_name, const char *file, int line);
+/* Same as above without taking the lock of the shared domain, only for
+ * reading what does not change during the life of the object */
+_Eo_Object *_eo_obj_pointer_read_get(const Eo_Id obj_id, const char *func_name, const char *file, int line);
 
 static inline
 Efl_Class *_eo_class_id_get(const _Efl_Class *klass)
@@ -328,6 +336,9 @@ _obj_is_override(_Eo_Object *obj)
 }
 
 void _eo_free(_Eo_Object *obj, Eina_Bool manual_free);
+/* Batch the objects freed from the main thread until the matching end */
+Eina_Bool _eo_free_batch_begin(void);
+void _eo_free_batch_end(void);
 
 static inline _Eo_Object *
 _efl_ref(_Eo_Object *obj)
@@ -12,6 +12,22 @@ Eina_TLS          _eo_table_data;
 Eo_Id_Data       *_eo_table_data_shared = NULL;
 Eo_Id_Table_Data *_eo_table_data_shared_data = NULL;
 
+/* Epoch based reclamation of the shared domain, see eo_ptr_indirection.x.
+ * Everything but the epoch readers themselves is protected by obj_lock. */
+typedef struct _Eo_Epoch_Retired Eo_Epoch_Retired;
+struct _Eo_Epoch_Retired
+{
+   Eo_Epoch_Retired *next;
+   void             *ptr;
+   void            (*free_cb)(void *ptr);
+   unsigned long     epoch;
+};
+
+unsigned long     _eo_epoch = 1;
+unsigned int      _eo_epoch_retired_count = 0;
+static Eo_Epoch_Retired *_eo_epoch_retired = NULL;
+static Eo_Epoch_Reader  *_eo_epoch_readers = NULL;
+
 //////////////////////////////////////////////////////////////////////////
 
 void
@@ -189,3 +205,184 @@ err:
    _eo_obj_pointer_invalid(obj_id, data, domain, func_name, file, line);
    return NULL;
 }
+
+//////////////////////////////////////////////////////////////////////////
+
+#ifdef EO_SHARED_LOCKLESS
+// called with obj_lock held
+static void
+_eo_epoch_reclaim(Eina_Bool all)
+{
+   Eo_Epoch_Retired *r, **prev;
+   Eo_Epoch_Reader *reader;
+   unsigned long oldest = (unsigned long)-1, epoch;
+
+   // pairs with the fence of _eo_epoch_enter(): either the reader sees
+   // what we unlinked, or we see its epoch
+   __atomic_thread_fence(__ATOMIC_SEQ_CST);
+   if (!all)
+     {
+        for (reader = _eo_epoch_readers; reader; reader = reader->next)
+          {
+             epoch = __atomic_load_n(&reader->epoch, __ATOMIC_ACQUIRE);
+             if (epoch && (epoch < oldest)) oldest = epoch;
+          }
+     }
+
+   prev = &_eo_epoch_retired;
+   while ((r = *prev))
+     {
+        if (r->epoch < oldest)
+          {
+             *prev = r->next;
+             r->free_cb(r->ptr);
+             free(r);
+             __atomic_sub_fetch(&_eo_epoch_retired_count, 1, __ATOMIC_RELAXED);
+          }
+        else prev = &(r->next);
+     }
+}
+#endif
+
+Eo_Epoch_Reader *
+_eo_epoch_reader_new(void)
+{
+   Eo_Epoch_Reader *reader;
+
+   eina_lock_take(&(_eo_table_data_shared_data->obj_lock));
+   // recycle the record of a thread that is gone
+   for (reader = _eo_epoch_readers; reader; reader = reader->next)
+     if (!reader->used) break;
+   if (!reader)
+     {
+        reader = calloc(1, sizeof(Eo_Epoch_Reader));
+        if (!reader) goto end;
+        reader->next = _eo_epoch_readers;
+        _eo_epoch_readers = reader;
+     }
+   reader->used = EINA_TRUE;
+   reader->nest = 0;
+   reader->epoch = 0;
+end:
+   eina_lock_release(&(_eo_table_data_shared_data->obj_lock));
+   return reader;
+}
+
+void
+_eo_epoch_reader_free(Eo_Epoch_Reader *reader)
+{
+   if (!_eo_table_data_shared_data) return;
+   eina_lock_take(&(_eo_table_data_shared_data->obj_lock));
+   reader->used = EINA_FALSE;
+   reader->epoch = 0;
+   eina_lock_release(&(_eo_table_data_shared_data->obj_lock));
+}
+
+void
+_eo_epoch_retire(void *ptr, void (*free_cb)(void *ptr))
+{
+#ifdef EO_SHARED_LOCKLESS
+   Eo_Epoch_Retired *r;
+
+   r = malloc(sizeof(Eo_Epoch_Retired));
+   if (!r)
+     {
+        // we can't tell when it is safe to free it, better leak it
+        ERR("Could not retire %p from the shared domain, leaking it", ptr);
+        return;
+     }
+   r->ptr = ptr;
+   r->free_cb = free_cb;
+
+   eina_lock_take(&(_eo_table_data_shared_data->obj_lock));
+   r->epoch = _eo_epoch;
+   r->next = _eo_epoch_retired;
+   _eo_epoch_retired = r;
+   __atomic_add_fetch(&_eo_epoch_retired_count, 1, __ATOMIC_RELAXED);
+   // release: a reader that acquires the new epoch also sees ptr unlinked,
+   // so it can not find it while announcing an epoch past r->epoch
+   __atomic_store_n(&_eo_epoch, _eo_epoch + 1, __ATOMIC_RELEASE);
+   _eo_epoch_reclaim(EINA_FALSE);
+   eina_lock_release(&(_eo_table_data_shared_data->obj_lock));
+#else
+   // lookups hold obj_lock, nobody can be looking at it
+   free_cb(ptr);
+#endif
+}
+
+void
+_eo_epoch_reclaim_try(void)
+{
+#ifdef EO_SHARED_LOCKLESS
+   // never wait for the writers, the next one will do it
+   if (eina_lock_take_try(&(_eo_table_data_shared_data->obj_lock)) != EINA_LOCK_SUCCEED)
+     return;
+   _eo_epoch_reclaim(EINA_FALSE);
+   eina_lock_release(&(_eo_table_data_shared_data->obj_lock));
+#endif
+}
+
+void
+_eo_epoch_shutdown(void)
+{
+   Eo_Epoch_Reader *reader;
+
+   if (!_eo_table_data_shared_data) return;
+   eina_lock_take(&(_eo_table_data_shared_data->obj_lock));
+#ifdef EO_SHARED_LOCKLESS
+   _eo_epoch_reclaim(EINA_TRUE);
+#endif
+   while ((reader = _eo_epoch_readers))
+     {
+        _eo_epoch_readers = reader->next;
+        free(reader);
+     }
+   _eo_epoch = 1;
+   eina_lock_release(&(_eo_table_data_shared_data->obj_lock));
+}
+
+_Eo_Object *
+_eo_obj_pointer_read_get(const Eo_Id obj_id, const char *func_name, const char *file, int line)
+{
+#ifdef EO_SHARED_LOCKLESS
+   _Eo_Ids_Table **mid_table, *tab;
+   _Eo_Object *obj;
+   Generation_Counter generation;
+   Table_Index mid_table_id, table_id, entry_id;
+   Eo_Id_Data *data;
+   Eo_Id_Table_Data *tdata;
+   unsigned char domain;
+
+   domain = (obj_id >> SHIFT_DOMAIN) & MASK_DOMAIN;
+   if (EINA_LIKELY(domain != EFL_ID_DOMAIN_SHARED))
+     return _eo_obj_pointer_get(obj_id, func_name, file, line);
+
+   data = _eo_table_data_get();
+   tdata = _eo_table_data_table_get(data, domain);
+   if (EINA_UNLIKELY(!tdata)) goto err;
+   if (!(obj_id & MASK_OBJ_TAG)) goto err;
+   if (EINA_UNLIKELY(!_eo_epoch_enter(data))) goto err;
+
+   EO_DECOMPOSE_ID(obj_id, mid_table_id, table_id, entry_id, generation);
+   (void) generation;
+
+   mid_table = __atomic_load_n(&(tdata->eo_ids_tables[mid_table_id]), __ATOMIC_ACQUIRE);
+   if (!mid_table) goto err_epoch;
+   tab = __atomic_load_n(&(mid_table[table_id]), __ATOMIC_ACQUIRE);
+   if (!tab) goto err_epoch;
+   obj = __atomic_load_n(&(tab->entries[entry_id].ptr), __ATOMIC_ACQUIRE);
+   // the entry, or even the whole table, may have been recycled since we
+   // found it: only trust the id the object holds, its memory is ours until
+   // we leave the epoch
+   if (!obj || ((Eo_Id)_eo_obj_id_get(obj) != obj_id)) goto err_epoch;
+   return obj;
+
+err_epoch:
+   _eo_epoch_exit(data);
+err:
+   _eo_obj_pointer_invalid(obj_id, data, domain, func_name, file, line);
+   return NULL;
+#else
+   return _eo_obj_pointer_get(obj_id, func_name, file, line);
+#endif
+}
@@ -66,6 +66,24 @@ void _eo_pointer_error(const Eo *obj_id, const char *func_name, const char *file
       if (!obj) goto label; \
    } while (0)
 
+/* Lockless variants for the shared domain, to be ended with
+ * EO_OBJ_READ_DONE() and only used to read what does not change during the
+ * life of the object: class, data offsets. Not the optional data, and so
+ * not the vtable, efl_object_override() replaces it under the lock. */
+#define EO_OBJ_POINTER_READ_RETURN_VAL(obj_id, obj, ret) \
+   _Eo_Object *obj; \
+   do { \
+      obj = _eo_obj_pointer_read_get((Eo_Id)obj_id, __FUNCTION__, __FILE__, __LINE__); \
+      if (!obj) return (ret); \
+   } while (0)
+
+#define EO_OBJ_POINTER_READ_GOTO(obj_id, obj, label) \
+   _Eo_Object *obj; \
+   do { \
+      obj = _eo_obj_pointer_read_get((Eo_Id)obj_id, __FUNCTION__, __FILE__, __LINE__); \
+      if (!obj) goto label; \
+   } while (0)
+
 #define EO_CLASS_POINTER(klass_id, klass)   \
    _Efl_Class *klass; \
    do { \
@@ -135,6 +153,9 @@ void _eo_pointer_error(const Eo *obj_id, const char *func_name, const char *file
 #define EO_OBJ_DONE(obj_id) \
    _eo_obj_pointer_done((Eo_Id)obj_id)
 
+#define EO_OBJ_READ_DONE(obj_id) \
+   _eo_obj_pointer_read_done((Eo_Id)obj_id)
+
 #ifdef EFL_DEBUG
 static inline void _eo_print(Eo_Id_Table_Data *tdata);
 #endif
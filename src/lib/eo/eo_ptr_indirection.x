@@ -246,6 +246,15 @@ _eo_id_mem_protect(void *ptr, Eina_Bool may_not_write)
 
 #define EO_ALIGN_SIZE(size) eina_mempool_alignof(size)
 
+/* Lookups in the shared domain do not take obj_lock when the compiler
+ * gives us atomics, see the epoch based reclamation below. */
+#ifdef __ATOMIC_RELAXED
+# define EO_SHARED_LOCKLESS 1
+# define EO_ID_PUBLISH(_ptr_, _val_) __atomic_store_n(&(_ptr_), (_val_), __ATOMIC_RELEASE)
+#else
+# define EO_ID_PUBLISH(_ptr_, _val_) (_ptr_) = (_val_)
+#endif
+
 /* Entry */
 typedef struct
 {
@@ -281,6 +290,25 @@ typedef struct
 
 typedef struct _Eo_Id_Data       Eo_Id_Data;
 typedef struct _Eo_Id_Table_Data Eo_Id_Table_Data;
+typedef struct _Eo_Epoch_Reader  Eo_Epoch_Reader;
+
+/* Epoch based reclamation for the shared domain:
+ *
+ * A thread looking up a shared id without the lock announces the epoch it
+ * started in, and leaves it when it is done with the object pointer.
+ * Writers are still serialized by obj_lock. The tables and objects they
+ * unlink are retired with the current epoch, which is then bumped, and
+ * only freed once no reader announced an epoch older or equal to it: such
+ * a reader may still hold a pointer found before the unlink. */
+struct _Eo_Epoch_Reader
+{
+   Eo_Epoch_Reader    *next;
+   /* Epoch the thread entered in, 0 when it is out of any lookup */
+   unsigned long       epoch;
+   /* Nested lookups only announce the outer one */
+   unsigned int        nest;
+   Eina_Bool           used;
+};
 
 struct _Eo_Id_Table_Data
 {
@@ -311,14 +339,24 @@ struct _Eo_Id_Table_Data
 struct _Eo_Id_Data
 {
    Eo_Id_Table_Data   *tables[4];
+   /* Allocated on the first lockless lookup of a shared id */
+   Eo_Epoch_Reader    *reader;
    unsigned char       local_domain;
    unsigned char       stack_top;
-   unsigned char       domain_stack[255 - (sizeof(void *) * 4) - 2];
+   unsigned char       domain_stack[255 - (sizeof(void *) * 5) - 2];
 };
 
 extern Eina_TLS          _eo_table_data;
 extern Eo_Id_Data       *_eo_table_data_shared;
 extern Eo_Id_Table_Data *_eo_table_data_shared_data;
+extern unsigned long     _eo_epoch;
+extern unsigned int      _eo_epoch_retired_count;
+
+Eo_Epoch_Reader *_eo_epoch_reader_new(void);
+void _eo_epoch_reader_free(Eo_Epoch_Reader *reader);
+void _eo_epoch_retire(void *ptr, void (*free_cb)(void *ptr));
+void _eo_epoch_reclaim_try(void);
+void _eo_epoch_shutdown(void);
 
 static inline Eo_Id_Table_Data *
 _eo_table_data_table_new(Efl_Id_Domain domain)
@@ -407,6 +445,56 @@ _eo_obj_pointer_done(const Eo_Id obj_id)
    eina_lock_release(&(_eo_table_data_shared_data->obj_lock));
 }
 
+#ifdef EO_SHARED_LOCKLESS
+static inline Eina_Bool
+_eo_epoch_enter(Eo_Id_Data *data)
+{
+   Eo_Epoch_Reader *reader = data->reader;
+
+   if (EINA_UNLIKELY(!reader))
+     {
+        reader = data->reader = _eo_epoch_reader_new();
+        if (!reader) return EINA_FALSE;
+     }
+   if (reader->nest++) return EINA_TRUE;
+
+   // acquire pairs with the release bump of _eo_epoch_retire(): if we read
+   // the epoch that followed a retirement, what it unlinked is out of our
+   // sight. Otherwise we announce the older epoch, which holds it back.
+   __atomic_store_n(&reader->epoch, __atomic_load_n(&_eo_epoch, __ATOMIC_ACQUIRE),
+                    __ATOMIC_SEQ_CST);
+   // the announcement must be visible to _eo_epoch_reclaim() before we read
+   // any table, pairs with its fence
+   __atomic_thread_fence(__ATOMIC_SEQ_CST);
+   return EINA_TRUE;
+}
+
+static inline void
+_eo_epoch_exit(Eo_Id_Data *data)
+{
+   Eo_Epoch_Reader *reader = data->reader;
+
+   if (--reader->nest) return;
+   __atomic_store_n(&reader->epoch, 0, __ATOMIC_RELEASE);
+   // we may have been the one holding back what was retired meanwhile
+   if (EINA_UNLIKELY(__atomic_load_n(&_eo_epoch_retired_count, __ATOMIC_RELAXED)))
+     _eo_epoch_reclaim_try();
+}
+#endif
+
+/* Ends a lookup done with _eo_obj_pointer_read_get() */
+static inline void
+_eo_obj_pointer_read_done(const Eo_Id obj_id)
+{
+#ifdef EO_SHARED_LOCKLESS
+   Efl_Id_Domain domain = (obj_id >> SHIFT_DOMAIN) & MASK_DOMAIN;
+   if (EINA_LIKELY(domain != EFL_ID_DOMAIN_SHARED)) return;
+   _eo_epoch_exit(_eo_table_data_get());
+#else
+   _eo_obj_pointer_done(obj_id);
+#endif
+}
+
 //////////////////////////////////////////////////////////////////////////
 
 
@@ -472,7 +560,8 @@ _search_tables(Eo_Id_Table_Data *tdata)
         if (!tdata->eo_ids_tables[mid_table_id])
           {
              /* Allocate a new intermediate table */
-             tdata->eo_ids_tables[mid_table_id] = _eo_id_mem_calloc(MAX_TABLE_ID, sizeof(_Eo_Ids_Table*));
+             EO_ID_PUBLISH(tdata->eo_ids_tables[mid_table_id],
+                           _eo_id_mem_calloc(MAX_TABLE_ID, sizeof(_Eo_Ids_Table*)));
           }
 
         for (Table_Index table_id = 0; table_id < MAX_TABLE_ID; table_id++)
@@ -500,7 +589,7 @@ _search_tables(Eo_Id_Table_Data *tdata)
                   table->partial_id = EO_COMPOSE_PARTIAL_ID(mid_table_id, table_id);
                   entry = &(table->entries[0]);
                   UNPROTECT(tdata->eo_ids_tables[mid_table_id]);
-                  TABLE_FROM_IDS = table;
+                  EO_ID_PUBLISH(TABLE_FROM_IDS, table);
                   PROTECT(tdata->eo_ids_tables[mid_table_id]);
                }
              else
@@ -582,10 +671,11 @@ _eo_id_allocate(const _Eo_Object *obj, const Eo *parent_id)
         /* [1;max-1] thus we never generate an Eo_Id equal to 0 */
         tdata->generation++;
         if (tdata->generation == MAX_GENERATIONS) tdata->generation = 1;
-        /* Fill the entry and return it's Eo Id */
-        entry->ptr = (_Eo_Object *)obj;
+        /* Fill the entry and return it's Eo Id, lockless lookups only
+         * look at the pointer */
         entry->active = 1;
         entry->generation = tdata->generation;
+        EO_ID_PUBLISH(entry->ptr, (_Eo_Object *)obj);
         PROTECT(tdata->current_table);
         id = EO_COMPOSE_FINAL_ID(tdata->current_table->partial_id,
                                  (entry - tdata->current_table->entries),
@@ -597,6 +687,79 @@ shared_err:
    return id;
 }
 
+/* Gives ids to count objects, as _eo_id_allocate() would one by one. The
+ * never used entries of the current table are reserved in one go, the
+ * shared domain is locked once. Objects left without an id get 0. */
+static inline void
+_eo_id_allocate_many(_Eo_Object **objs, unsigned int count, const Eo *parent_id)
+{
+   _Eo_Ids_Table *table;
+   _Eo_Id_Entry *entry;
+   Eo_Id_Data *data;
+   Eo_Id_Table_Data *tdata;
+   Efl_Id_Domain domain;
+   unsigned int i = 0, k, n;
+
+   data = _eo_table_data_get();
+   if (parent_id)
+     {
+        domain = ((Eo_Id)parent_id >> SHIFT_DOMAIN) & MASK_DOMAIN;
+        tdata = _eo_table_data_table_get(data, domain);
+     }
+   else tdata = _eo_table_data_current_table_get(data);
+   if (!tdata) goto end;
+
+   if (tdata->shared)
+     {
+        domain = EFL_ID_DOMAIN_SHARED;
+        eina_lock_take(&(_eo_table_data_shared_data->obj_lock));
+     }
+   else domain = data->domain_stack[data->stack_top];
+
+   while (i < count)
+     {
+        table = tdata->current_table;
+        if (table && (table->start != MAX_ENTRY_ID))
+          {
+             n = MAX_ENTRY_ID - table->start;
+             if (n > count - i) n = count - i;
+             entry = &(table->entries[table->start]);
+             UNPROTECT(table);
+             table->start += n;
+             table->free_entries -= n;
+          }
+        else
+          {
+             entry = NULL;
+             if (table) entry = _get_available_entry(table);
+             if (!entry) entry = _search_tables(tdata);
+             if (!tdata->current_table || !entry) break;
+             table = tdata->current_table;
+             n = 1;
+             UNPROTECT(table);
+          }
+        /* [1;max-1] thus we never generate an Eo_Id equal to 0 */
+        tdata->generation++;
+        if (tdata->generation >= MAX_GENERATIONS) tdata->generation = 1;
+        for (k = 0; k < n; k++, i++)
+          {
+             entry[k].active = 1;
+             entry[k].generation = tdata->generation;
+             EO_ID_PUBLISH(entry[k].ptr, objs[i]);
+             objs[i]->header.id =
+               EO_COMPOSE_FINAL_ID(table->partial_id,
+                                   ((entry + k) - table->entries),
+                                   domain, entry[k].generation);
+          }
+        PROTECT(table);
+     }
+
+   if (tdata->shared)
+     eina_lock_release(&(_eo_table_data_shared_data->obj_lock));
+end:
+   for (; i < count; i++) objs[i]->header.id = 0;
+}
+
 static inline void
 _eo_id_release(const Eo_Id obj_id)
 {
@@ -677,6 +840,7 @@ _eo_id_release(const Eo_Id obj_id)
                   table->free_entries++;
                   // Disable the entry
                   entry->active = 0;
+                  EO_ID_PUBLISH(entry->ptr, NULL);
                   entry->next_in_fifo = -1;
                   // Push the entry into the fifo
                   if (table->fifo_tail == -1)
@@ -690,11 +854,12 @@ _eo_id_release(const Eo_Id obj_id)
                   if (table->free_entries == MAX_ENTRY_ID)
                     {
                        UNPROTECT(tdata->eo_ids_tables[mid_table_id]);
-                       TABLE_FROM_IDS = NULL;
+                       EO_ID_PUBLISH(TABLE_FROM_IDS, NULL);
                        PROTECT(tdata->eo_ids_tables[mid_table_id]);
-                       // Recycle or free the empty table
+                       // Recycle or free the empty table, a lockless
+                       // lookup may still be reading it
                        if (!tdata->empty_table) tdata->empty_table = table;
-                       else _eo_id_mem_free(table);
+                       else _eo_epoch_retire(table, _eo_id_mem_free);
                        if (tdata->current_table == table)
                          tdata->current_table = NULL;
                     }
@@ -725,6 +890,11 @@ _eo_free_ids_tables(Eo_Id_Data *data)
    Eo_Id_Table_Data *tdata;
 
    if (!data) return;
+   if (data->reader)
+     {
+        _eo_epoch_reader_free(data->reader);
+        data->reader = NULL;
+     }
    tdata = data->tables[data->local_domain];
    for (Table_Index mid_table_id = 0; mid_table_id < MAX_MID_TABLE_ID; mid_table_id++)
      {
@@ -2308,6 +2308,22 @@ EAPI Eina_Stringshare *eolian_class_c_data_type_get(const Eolian_Class *klass);
  */
 EAPI Eina_Bool eolian_class_is_beta(const Eolian_Class *klass);
 
+/*
+ * @brief Get whether a class is final.
+ *
+ * A final class cannot be inherited from. Its objects are always of that
+ * exact class, so generators can call the implementations of the methods
+ * it declares directly.
+ *
+ * @param[in] klass the class
+ * @return EINA_TRUE if the class has been marked as final
+ *
+ * @since 1.22
+ *
+ * @ingroup Eolian
+ */
+EAPI Eina_Bool eolian_class_is_final(const Eolian_Class *klass);
+
 /*
  * @brief Get the type of a type declaration.
  *
@@ -235,3 +235,10 @@ eolian_class_is_beta(const Eolian_Class *cl)
    EINA_SAFETY_ON_NULL_RETURN_VAL(cl, EINA_FALSE);
    return cl->is_beta;
 }
+
+EAPI Eina_Bool
+eolian_class_is_final(const Eolian_Class *cl)
+{
+   EINA_SAFETY_ON_NULL_RETURN_VAL(cl, EINA_FALSE);
+   return cl->is_final;
+}
@@ -1155,6 +1155,12 @@ _validate_class(Validate_State *vals, Eolian_Class *cl,
                                  cl->base.name, cl->parent->base.name);
                   return EINA_FALSE;
                }
+             if (cl->parent->is_final)
+               {
+                  _eo_parser_log(&cl->base, "class '%s' cannot inherit from final class '%s'",
+                                 cl->base.name, cl->parent->base.name);
+                  return EINA_FALSE;
+               }
              break;
            default:
              break;
@@ -31,7 +31,7 @@ enum Tokens
     KW(parse), KW(parts), KW(ptr), KW(set), KW(type), KW(values), KW(var), KW(requires), \
     \
     KWAT(auto), KWAT(beta), KWAT(class), KWAT(const), KWAT(cref), KWAT(empty), \
-    KWAT(extern), KWAT(free), KWAT(hot), KWAT(in), KWAT(inout), KWAT(nonull), \
+    KWAT(extern), KWAT(final), KWAT(free), KWAT(hot), KWAT(in), KWAT(inout), KWAT(nonull), \
     KWAT(nullable), KWAT(optional), KWAT(out), KWAT(owned), KWAT(private), \
     KWAT(property), KWAT(protected), KWAT(restart), KWAT(pure_virtual), \
     KWAT(warn_unused), \
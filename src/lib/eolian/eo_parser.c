@@ -2079,6 +2079,29 @@ _requires_add(Eo_Lexer *ls, Eina_Strbuf *buf)
    free(fnm);
 }
 
+static void
+parse_class_attrs(Eo_Lexer *ls, Eolian_Class_Type type)
+{
+   Eina_Bool has_beta = EINA_FALSE, has_final = EINA_FALSE;
+   for (;;) switch (ls->t.kw)
+     {
+      case KW_at_beta:
+        CASE_LOCK(ls, beta, "@beta qualifier")
+        eo_lexer_get(ls);
+        ls->klass->is_beta = EINA_TRUE;
+        break;
+      case KW_at_final:
+        CASE_LOCK(ls, final, "@final qualifier")
+        if (type != EOLIAN_CLASS_REGULAR)
+          eo_lexer_syntax_error(ls, "only regular classes can be @final");
+        eo_lexer_get(ls);
+        ls->klass->is_final = EINA_TRUE;
+        break;
+      default:
+        return;
+     }
+}
+
 static void
 parse_class(Eo_Lexer *ls, Eolian_Class_Type type)
 {
@@ -2093,11 +2116,7 @@ parse_class(Eo_Lexer *ls, Eolian_Class_Type type)
    eo_lexer_get(ls);
    ls->klass->type = type;
    eo_lexer_context_push(ls);
-   if (ls->t.kw == KW_at_beta)
-     {
-        ls->klass->is_beta = EINA_TRUE;
-        eo_lexer_get(ls);
-     }
+   parse_class_attrs(ls, type);
    parse_name(ls, buf);
    bnm = eina_stringshare_ref(ls->filename);
    fnm = database_class_to_filename(eina_strbuf_string_get(buf));
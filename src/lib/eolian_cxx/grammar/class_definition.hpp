@@ -158,7 +158,7 @@ struct class_definition_generator
               *attribute_reorder<1, 2, 0, 1>
               ((scope_tab << "static struct " << string_replace(',', '_') << "_event\n"
                 << scope_tab << "{\n"
-                << scope_tab << scope_tab << "static Efl_Event_Description const* description()\n"
+                << scope_tab << scope_tab << "static EFL_CXX_EVENT_CONSTEXPR Efl_Event_Description const* description()\n"
                 << scope_tab << scope_tab << "{ return " << string << "; }\n"
                 << scope_tab << scope_tab << "typedef "
                 << (attribute_conditional([] (eina::optional<attributes::type_def> const& t) { return !!t; })
@@ -2,6 +2,7 @@
 
 #include "evas_common_private.h"
 #include "evas_private.h"
+#include <limits.h>
 
 #define EFL_INTERNAL_UNSTABLE
 #include "interfaces/efl_common_internal.h"
@@ -364,6 +365,252 @@ _evas_event_object_list_raw_in_get_single(Evas *eo_e, Evas_Object_Protected_Data
    return in;
 }
 
+/* Spatial index for hit testing.
+ *
+ * Big object lists (a layer, the members of a smart object) get a uniform
+ * grid built on demand. Each cell lists, in stacking order, the objects
+ * whose unclipped area (map, smart bounding box or geometry) covers it.
+ * Clipping only shrinks that area, so an object missing from the cell of
+ * a point is one _evas_event_object_list_raw_in_get_single() would have
+ * skipped anyway, and walking the cell gives the same result as walking
+ * the whole list.
+ *
+ * Changes to what the cells hold (geometry, map, smart bounding box,
+ * stacking, list membership) bump the canvas generation, which drops all
+ * grids. Visibility and clipping are checked again on every query, so a
+ * color or image change keeps the grids. A list gets its grid on the
+ * second query within a generation, so a canvas that moves something
+ * between every pointer move never pays for it.
+ */
+#define EVAS_EVENT_GRID_MIN_OBJECTS 64
+#define EVAS_EVENT_GRID_MAX_CELLS 64
+
+typedef struct _Evas_Event_Grid Evas_Event_Grid;
+struct _Evas_Event_Grid
+{
+   Evas_Public_Data *e;
+   Evas_Object_Protected_Data **objs; // top to bottom
+   unsigned int *cells;   // indexes in objs, cell after cell
+   unsigned int *offsets; // cell i is cells[offsets[i]] to cells[offsets[i + 1]]
+   int x, y, cw, ch;
+   int cols, rows;
+   Eina_Bool linear : 1; // too small to be worth a grid
+};
+
+static void
+_evas_event_grid_free(void *data)
+{
+   Evas_Event_Grid *grid = data;
+
+   free(grid->objs);
+   free(grid->cells);
+   free(grid->offsets);
+   free(grid);
+}
+
+void
+evas_event_index_free(Evas_Public_Data *e)
+{
+   if (e->event_index.grids) eina_hash_free(e->event_index.grids);
+   e->event_index.grids = NULL;
+}
+
+static Eina_Bool
+_evas_event_grid_rect_get(Evas_Object_Protected_Data *obj, Eina_Rectangle *r)
+{
+   // same area _evas_event_object_list_raw_in_get_single() tests, before
+   // clipping. mapped children can be anywhere and event grabbers take the
+   // events of the whole canvas, FALSE means everywhere
+   if (obj->child_has_map || obj->is_event_parent) return EINA_FALSE;
+   if (EINA_UNLIKELY((!!obj->map) && (obj->map->cur.map)
+                     && (obj->map->cur.usemap)))
+     *r = obj->map->cur.map->normal_geometry;
+   else if (obj->is_smart)
+     {
+        evas_object_smart_bounding_box_update(obj);
+        evas_object_smart_bounding_box_get(obj, r, NULL);
+     }
+   else
+     *r = obj->cur->geometry;
+   return EINA_TRUE;
+}
+
+static int
+_evas_event_grid_col(const Evas_Event_Grid *grid, int x)
+{
+   int c = (x - grid->x) / grid->cw;
+
+   if (c < 0) return 0;
+   if (c >= grid->cols) return grid->cols - 1;
+   return c;
+}
+
+static int
+_evas_event_grid_row(const Evas_Event_Grid *grid, int y)
+{
+   int r = (y - grid->y) / grid->ch;
+
+   if (r < 0) return 0;
+   if (r >= grid->rows) return grid->rows - 1;
+   return r;
+}
+
+static Eina_Bool
+_evas_event_grid_build(Evas_Event_Grid *grid, const Eina_Inlist *ilist)
+{
+   Evas_Object_Protected_Data *obj = NULL;
+   Eina_Rectangle *rects = NULL;
+   Eina_Bool *everywhere = NULL;
+   unsigned int n = 0, i, total, cells;
+   int x1 = INT_MAX, y1 = INT_MAX, x2 = INT_MIN, y2 = INT_MIN, side, c, r;
+
+   n = eina_inlist_count(ilist);
+   if (n < EVAS_EVENT_GRID_MIN_OBJECTS)
+     {
+        grid->linear = EINA_TRUE;
+        return EINA_FALSE;
+     }
+
+   grid->objs = malloc(n * sizeof(*grid->objs));
+   rects = malloc(n * sizeof(*rects));
+   everywhere = calloc(n, sizeof(*everywhere));
+   if ((!grid->objs) || (!rects) || (!everywhere)) goto on_error;
+
+   n = 0;
+   for (obj = _EINA_INLIST_CONTAINER(obj, eina_inlist_last(ilist));
+        obj;
+        obj = _EINA_INLIST_CONTAINER(obj, EINA_INLIST_GET(obj)->prev))
+     {
+        if (_evas_event_grid_rect_get(obj, &rects[n]))
+          {
+             // empty areas never contain the point
+             if ((rects[n].w <= 0) || (rects[n].h <= 0)) continue;
+             if (rects[n].x < x1) x1 = rects[n].x;
+             if (rects[n].y < y1) y1 = rects[n].y;
+             if (rects[n].x + rects[n].w > x2) x2 = rects[n].x + rects[n].w;
+             if (rects[n].y + rects[n].h > y2) y2 = rects[n].y + rects[n].h;
+          }
+        else everywhere[n] = EINA_TRUE;
+        grid->objs[n++] = obj;
+     }
+   if (x1 >= x2)
+     {
+        x1 = y1 = 0;
+        x2 = y2 = 1;
+     }
+
+   // roughly 8 objects per cell
+   for (side = 1;
+        (side < EVAS_EVENT_GRID_MAX_CELLS) && ((unsigned int)(side * side * 8) < n);
+        side++);
+   grid->x = x1;
+   grid->y = y1;
+   grid->cols = grid->rows = side;
+   grid->cw = ((x2 - x1) + side - 1) / side;
+   grid->ch = ((y2 - y1) + side - 1) / side;
+   if (grid->cw < 1) grid->cw = 1;
+   if (grid->ch < 1) grid->ch = 1;
+   cells = side * side;
+
+   // the extra cell holds what may be hit outside of the grid bounds
+   grid->offsets = calloc(cells + 2, sizeof(*grid->offsets));
+   if (!grid->offsets) goto on_error;
+
+#define GRID_FOREACH_CELL(_i, ...)                                       \
+   if (everywhere[_i])                                                   \
+     {                                                                   \
+        unsigned int _cell;                                              \
+        for (_cell = 0; _cell <= cells; _cell++) { __VA_ARGS__ }         \
+     }                                                                   \
+   else                                                                  \
+     {                                                                   \
+        int _c1 = _evas_event_grid_col(grid, rects[_i].x);               \
+        int _c2 = _evas_event_grid_col(grid, rects[_i].x + rects[_i].w - 1); \
+        int _r1 = _evas_event_grid_row(grid, rects[_i].y);               \
+        int _r2 = _evas_event_grid_row(grid, rects[_i].y + rects[_i].h - 1); \
+        for (r = _r1; r <= _r2; r++)                                     \
+          for (c = _c1; c <= _c2; c++)                                   \
+            {                                                            \
+               unsigned int _cell = (r * side) + c;                      \
+               __VA_ARGS__                                               \
+            }                                                            \
+     }
+
+   for (i = 0; i < n; i++)
+     {
+        GRID_FOREACH_CELL(i, grid->offsets[_cell + 1]++;)
+     }
+   for (i = 0; i <= cells; i++)
+     grid->offsets[i + 1] += grid->offsets[i];
+   total = grid->offsets[cells + 1];
+
+   grid->cells = malloc((total ? total : 1) * sizeof(*grid->cells));
+   if (!grid->cells) goto on_error;
+   // reuse the leading counters as fill positions, in stacking order
+   for (i = 0; i < n; i++)
+     {
+        GRID_FOREACH_CELL(i, grid->cells[grid->offsets[_cell]++] = i;)
+     }
+   for (i = cells + 1; i > 0; i--)
+     grid->offsets[i] = grid->offsets[i - 1];
+   grid->offsets[0] = 0;
+#undef GRID_FOREACH_CELL
+
+   free(rects);
+   free(everywhere);
+   return EINA_TRUE;
+
+on_error:
+   free(rects);
+   free(everywhere);
+   free(grid->objs);
+   free(grid->offsets);
+   grid->objs = NULL;
+   grid->offsets = NULL;
+   grid->linear = EINA_TRUE;
+   return EINA_FALSE;
+}
+
+static Evas_Event_Grid *
+_evas_event_grid_get(const Eina_Inlist *ilist)
+{
+   Evas_Object_Protected_Data *obj = NULL;
+   Evas_Public_Data *e;
+   Evas_Event_Grid *grid;
+
+   obj = _EINA_INLIST_CONTAINER(obj, ilist);
+   if ((!obj->layer) || (!obj->layer->evas)) return NULL;
+   e = obj->layer->evas;
+
+   if (e->event_index.built != e->event_index.generation)
+     {
+        // grids are in use further up the stack, leave them alone
+        if (e->event_index.walking) return NULL;
+        if (e->event_index.grids)
+          eina_hash_free_buckets(e->event_index.grids);
+        e->event_index.built = e->event_index.generation;
+     }
+   if (!e->event_index.grids)
+     {
+        e->event_index.grids = eina_hash_pointer_new(_evas_event_grid_free);
+        if (!e->event_index.grids) return NULL;
+     }
+
+   grid = eina_hash_find(e->event_index.grids, &ilist);
+   if (!grid)
+     {
+        // first query in this generation, only remember the list
+        grid = calloc(1, sizeof(Evas_Event_Grid));
+        if (!grid) return NULL;
+        grid->e = e;
+        eina_hash_add(e->event_index.grids, &ilist, grid);
+        return NULL;
+     }
+   if (grid->linear) return NULL;
+   if ((!grid->objs) && (!_evas_event_grid_build(grid, ilist))) return NULL;
+   return grid;
+}
+
 static Eina_List *
 _evas_event_object_list_raw_in_get(Evas *eo_e, Eina_List *in,
                                    const Eina_Inlist *ilist,
@@ -372,12 +619,40 @@ _evas_event_object_list_raw_in_get(Evas *eo_e, Eina_List *in,
                                    int x, int y, int *no_rep, Eina_Bool source)
 {
    Evas_Object_Protected_Data *obj = NULL;
+   Evas_Event_Grid *grid = NULL;
    DDD_STATIC int spaces = 0;
 
    if ((!ilist) && (!list)) return in;
 
    spaces++;
-   if (ilist)
+   // a stop object has to be reached wherever it is
+   if ((ilist) && (!stop)) grid = _evas_event_grid_get(ilist);
+   if (grid)
+     {
+        Evas_Public_Data *e = grid->e;
+        unsigned int i, cell, end;
+
+        if ((x < grid->x) || (y < grid->y) ||
+            (x >= grid->x + (grid->cols * grid->cw)) ||
+            (y >= grid->y + (grid->rows * grid->ch)))
+          cell = grid->cols * grid->rows;
+        else
+          cell = (_evas_event_grid_row(grid, y) * grid->cols) +
+            _evas_event_grid_col(grid, x);
+
+        e->event_index.walking++;
+        end = grid->offsets[cell + 1];
+        for (i = grid->offsets[cell]; i < end; i++)
+          {
+             obj = grid->objs[grid->cells[i]];
+             if (obj->events->parent) continue;
+             in = _evas_event_object_list_raw_in_get_single(eo_e, obj, in, stop, x, y, no_rep, source, spaces);
+             if (*no_rep) break;
+          }
+        e->event_index.walking--;
+        if (*no_rep) goto end;
+     }
+   else if (ilist)
      {
         for (obj = _EINA_INLIST_CONTAINER(obj, eina_inlist_last(ilist));
              obj;
@@ -25,12 +25,14 @@ evas_object_inject(Evas_Object *eo_obj, Evas_Object_Protected_Data *obj, Evas *e
    lay->usage++;
    obj->layer = lay;
    obj->in_layer = 1;
+   _evas_event_index_invalidate(evas);
 }
 
 void
 evas_object_release(Evas_Object *eo_obj, Evas_Object_Protected_Data *obj, int clean_layer)
 {
    if (!obj->in_layer) return;
+   _evas_event_index_invalidate(obj->layer->evas);
    if (!obj->layer->walking_objects)
      obj->layer->objects = (Evas_Object_Protected_Data *)eina_inlist_remove(EINA_INLIST_GET(obj->layer->objects), EINA_INLIST_GET(obj));
    efl_data_unref(eo_obj, obj);
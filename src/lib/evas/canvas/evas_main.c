@@ -237,6 +237,11 @@ _evas_canvas_efl_object_constructor(Eo *eo_obj, Evas_Public_Data *e)
                          sizeof(Eina_Inarray),
                          sizeof(Evas_Active_Entry),
                          256);
+   e->active_spans.version = EINA_ARRAY_VERSION;
+   eina_inarray_step_set(&e->active_spans,
+                         sizeof(Eina_Inarray),
+                         sizeof(Evas_Active_Span),
+                         16);
 
 #undef EVAS_ARRAY_SET
    eina_lock_new(&(e->lock_objects));
@@ -503,6 +508,8 @@ _evas_canvas_efl_object_destructor(Eo *eo_e, Evas_Public_Data *e)
 
    eina_array_flush(&e->delete_objects);
    eina_inarray_flush(&e->active_objects);
+   eina_inarray_flush(&e->active_spans);
+   evas_event_index_free(e);
    eina_array_flush(&e->restack_objects);
    eina_array_flush(&e->render_objects);
    eina_array_flush(&e->pending_objects);
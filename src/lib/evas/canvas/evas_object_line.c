@@ -149,6 +149,7 @@ _evas_line_xy_set(Eo *eo_obj, Evas_Line_Data *_pd, Evas_Coord x1, Evas_Coord y1,
        state_write->geometry.h = max_y - min_y + 2;
      }
    EINA_COW_STATE_WRITE_END(obj, state_write, cur);
+   _evas_object_event_index_invalidate(obj);
 
 ////   obj->cur->cache.geometry.validity = 0;
    o->cur.x1 = x1 - min_x;
@@ -561,6 +561,12 @@ evas_object_free(Evas_Object_Protected_Data *obj, Eina_Bool clean_layer)
           map_write->surface = NULL;
         EINA_COW_WRITE_END(evas_object_map_cow, obj->map, map_write);
      }
+   if (obj->render_cache)
+     {
+        evas_object_render_cache_surface_free(obj);
+        free(obj->render_cache);
+        obj->render_cache = NULL;
+     }
    if (obj->mask->is_mask)
      {
         EINA_COW_WRITE_BEGIN(evas_object_mask_cow, obj->mask, Evas_Object_Mask_Data, mask)
@@ -2286,6 +2292,58 @@ _efl_canvas_object_anti_alias_get(const Eo *eo_obj EINA_UNUSED, Evas_Object_Prot
    return obj->cur->anti_alias;
 }
 
+void
+evas_object_render_cache_surface_free(Evas_Object_Protected_Data *obj)
+{
+   Evas_Object_Render_Cache *rc = obj->render_cache;
+
+   if ((!rc) || (!rc->surface)) return;
+   if (obj->layer) ENFN->image_free(ENC, rc->surface);
+   rc->surface = NULL;
+   rc->w = rc->h = 0;
+}
+
+EOLIAN static void
+_efl_canvas_object_render_cache_set(Eo *eo_obj, Evas_Object_Protected_Data *obj, Eina_Bool enable)
+{
+   if (obj->delete_me) return;
+   if (!!obj->render_cache == !!enable) return;
+
+   evas_object_async_block(obj);
+   if (enable)
+     {
+        obj->render_cache = calloc(1, sizeof(Evas_Object_Render_Cache));
+        if (!obj->render_cache) return;
+     }
+   else
+     {
+        evas_object_render_cache_surface_free(obj);
+        free(obj->render_cache);
+        obj->render_cache = NULL;
+     }
+
+   /* members move in or out of the active object list */
+   if (obj->layer) evas_render_invalidate(obj->layer->evas->evas);
+   evas_object_change(eo_obj, obj);
+}
+
+EOLIAN static Eina_Bool
+_efl_canvas_object_render_cache_get(const Eo *eo_obj EINA_UNUSED, Evas_Object_Protected_Data *obj)
+{
+   return !!obj->render_cache;
+}
+
+EOLIAN static void
+_efl_canvas_object_render_cache_stats_get(const Eo *eo_obj EINA_UNUSED, Evas_Object_Protected_Data *obj,
+                                          size_t *memory, unsigned int *hits, unsigned int *misses)
+{
+   Evas_Object_Render_Cache *rc = obj->render_cache;
+
+   if (memory) *memory = (rc && rc->surface) ? (size_t)rc->w * rc->h * 4 : 0;
+   if (hits) *hits = rc ? rc->hits : 0;
+   if (misses) *misses = rc ? rc->misses : 0;
+}
+
 EOLIAN static void
 _efl_canvas_object_efl_gfx_entity_scale_set(Eo *eo_obj, Evas_Object_Protected_Data *obj, double scale)
 {
@@ -166,6 +166,7 @@ _efl_canvas_polygon_point_add(Eo *eo_obj, Efl_Canvas_Polygon_Data *_pd, Eina_Pos
         EINA_COW_STATE_WRITE_END(obj, state_write, cur);
      }
    o->points = eina_list_append(o->points, p);
+   _evas_object_event_index_invalidate(obj);
 
    o->geometry = obj->cur->geometry;
    o->offset.x = 0;
@@ -211,6 +212,7 @@ _efl_canvas_polygon_points_clear(Eo *eo_obj, Efl_Canvas_Polygon_Data *_pd)
         state_write->geometry.h = 0;
      }
    EINA_COW_STATE_WRITE_END(obj, state_write, cur);
+   _evas_object_event_index_invalidate(obj);
 
    ////   obj->cur->cache.geometry.validity = 0;
    o->changed = EINA_TRUE;
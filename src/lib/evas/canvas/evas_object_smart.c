@@ -281,6 +281,7 @@ _efl_canvas_group_group_member_add(Eo *smart_obj, Evas_Smart_Data *o, Evas_Objec
         EINA_COW_STATE_WRITE_END(obj, state_write, cur);
      }
 
+   _evas_event_index_invalidate(obj->layer->evas);
    o->member_count++;
    obj->smart.parent = smart_obj;
    obj->smart.parent_data = o;
@@ -373,6 +374,7 @@ _efl_canvas_group_group_member_del(Eo *smart_obj, Evas_Smart_Data *_pd EINA_UNUS
 
    o->contained = eina_inlist_remove(o->contained, EINA_INLIST_GET(obj));
    o->member_count--;
+   if (obj->layer) _evas_event_index_invalidate(obj->layer->evas);
    obj->smart.parent = NULL;
 
    if (obj->is_smart) member_o = efl_data_scope_get(eo_obj, MY_CLASS);
@@ -1335,6 +1337,8 @@ evas_object_update_bounding_box(Evas_Object *eo_obj EINA_UNUSED, Evas_Object_Pro
    Evas_Coord px, py, pw, ph;
    Eina_Bool noclip;
 
+   /* every geometry, visibility, clip and map change ends up here */
+   _evas_object_event_index_invalidate(obj);
    if (!obj->smart.parent) return;
 
    if (obj->child_has_map) return; /* Disable bounding box computation for this object and its parent */
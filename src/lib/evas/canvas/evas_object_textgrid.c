@@ -1092,6 +1092,7 @@ _evas_textgrid_font_reload(Eo *eo_obj, Evas_Textgrid_Data *o)
              state_write->geometry.h = 0;
           }
         EINA_COW_STATE_WRITE_END(obj, state_write, cur);
+        _evas_object_event_index_invalidate(obj);
 
         o->ascent = 0;
      }
@@ -2,6 +2,7 @@
 #include "evas_private.h"
 #include <math.h>
 #include <assert.h>
+#include <limits.h>
 
 #ifdef EVAS_RENDER_DEBUG_TIMING
 #include <sys/time.h>
@@ -673,6 +674,8 @@ typedef struct
 } Phase1_Context;
 
 #define RENDCACHE 1
+/* smallest render cache worth tracking as a span of active objects */
+#define ACTIVE_SPAN_MIN 4
 
 #ifdef RENDCACHE
 static Render_Cache *
@@ -720,6 +723,19 @@ _evas_render_phase1_object_ctx_render_cache_append(Phase1_Context *ctx,
    ARR_APPEND(snapshot_objects);
 
    c = eina_inarray_count(rc->active_objects);
+   /* a render cache appended straight to the canvas list is a clean
+    * subtree, remember where it lands so the draw loop can skip it as a
+    * whole. caches nested in another cache are covered by the outer one */
+   if ((c >= ACTIVE_SPAN_MIN) &&
+       (ctx->active_objects == &ctx->e->active_objects))
+     {
+        Evas_Active_Span span;
+
+        memset(&span.bounds, 0, sizeof(span.bounds));
+        span.start = eina_inarray_count(ctx->active_objects);
+        span.count = c;
+        eina_inarray_push(&ctx->e->active_spans, &span);
+     }
    for (i = 0; i < c; i++)
      {
         ent = eina_inarray_nth(rc->active_objects, i);
@@ -835,6 +851,57 @@ _evas_render_phase1_object_mapped_had_restack(Phase1_Context *p1ctx,
    evas_object_update_bounding_box(eo_obj, obj, NULL);
 }
 
+static inline Eina_Bool
+_evas_render_object_is_cached(Evas_Object_Protected_Data *obj)
+{
+   return (obj->render_cache && obj->is_smart && !_evas_render_has_map(obj));
+}
+
+static void
+_evas_render_phase1_object_cached(Phase1_Context *p1ctx,
+                                  Evas_Object_Protected_Data *obj,
+                                  Eina_Bool src_changed,
+                                  Eina_Bool is_active,
+                                  Eina_Bool obj_changed,
+                                  int level)
+{
+   Evas_Object_Protected_Data *obj2;
+   Evas_Object *eo_obj = obj->object;
+
+   RD(level, "  obj render cached\n");
+   /* remembered until the surface is rendered again: the members changed
+    * flags are reset by render_post even when nothing of the group gets
+    * drawn, e.g. while the change is clipped out */
+   if (obj_changed) obj->render_cache->dirty = EINA_TRUE;
+   else
+     {
+        EINA_INLIST_FOREACH(evas_object_smart_members_get_direct(eo_obj), obj2)
+          {
+             if (!obj2->changed) continue;
+             obj->render_cache->dirty = EINA_TRUE;
+             break;
+          }
+        return;
+     }
+   if (!((is_active) &&
+         (!obj->clip.clipees) &&
+         ((evas_object_is_visible(eo_obj, obj) &&
+           (!obj->cur->have_clipees)) ||
+          (evas_object_was_visible(eo_obj, obj) &&
+           (!obj->prev->have_clipees)))))
+     return;
+   OBJ_ARRAY_PUSH(p1ctx->render_objects, obj);
+   obj->render_pre = EINA_TRUE;
+   evas_object_smart_render_cache_clear(eo_obj);
+   /* members are drawn from the cache surface, not from the active list,
+    * but still need their pre render to get the damage right */
+   EINA_INLIST_FOREACH(evas_object_smart_members_get_direct(eo_obj), obj2)
+     {
+        _evas_render_phase1_object_process(p1ctx, obj2, obj->restack,
+                                           EINA_TRUE, src_changed, level + 1);
+     }
+}
+
 static Eina_Bool
 _evas_render_phase1_object_changed_smart(Phase1_Context *p1ctx,
                                          Evas_Object_Protected_Data *obj,
@@ -1164,6 +1231,13 @@ _evas_render_phase1_object_process(Phase1_Context *p1ctx,
      _evas_render_phase1_object_mapped_had_restack(p1ctx, obj, map,
                                                    obj_changed, level);
 
+   if (EINA_UNLIKELY(_evas_render_object_is_cached(obj)))
+     {
+        _evas_render_phase1_object_cached(p1ctx, obj, src_changed,
+                                          is_active, obj_changed, level);
+        goto done;
+     }
+
    /* handle normal rendering. this object knows how to handle maps */
    if (obj_changed)
      {
@@ -1323,6 +1397,7 @@ clean_stuff:
         if (!ok)
           {
              eina_inarray_flush(&e->active_objects);
+             eina_inarray_flush(&e->active_spans);
              OBJS_ARRAY_CLEAN(&e->render_objects);
              OBJS_ARRAY_CLEAN(&e->restack_objects);
              OBJS_ARRAY_CLEAN(&e->delete_objects);
@@ -1731,6 +1806,86 @@ _evas_render_mapped_context_clip_set(Evas_Public_Data *evas, Evas_Object *eo_obj
      }
 }
 
+static Eina_Bool
+_evas_render_cached_draw(Evas_Public_Data *evas, Evas_Object *eo_obj,
+                         Evas_Object_Protected_Data *obj, void *context,
+                         void *output, void *surface, int off_x, int off_y,
+                         int level, Eina_Bool do_async)
+{
+   Evas_Object_Render_Cache *rc = obj->render_cache;
+   Evas_Object_Protected_Data *obj2;
+   Eina_Bool clean_them = EINA_FALSE, changed = EINA_FALSE;
+   Eina_Rectangle bbox;
+   void *ctx;
+
+   evas_object_smart_bounding_box_get(obj, &bbox, NULL);
+   RD(level, "  render cache: %i,%i %ix%i sfc:%p\n",
+      bbox.x, bbox.y, bbox.w, bbox.h, rc->surface);
+   if ((bbox.w <= 0) || (bbox.h <= 0)) return EINA_FALSE;
+
+   if ((rc->surface) && ((rc->w != bbox.w) || (rc->h != bbox.h)))
+     evas_object_render_cache_surface_free(obj);
+   if (!rc->surface)
+     {
+        rc->surface = ENFN->image_map_surface_new(ENC, bbox.w, bbox.h, 1);
+        if (!rc->surface) return EINA_FALSE;
+        rc->w = bbox.w;
+        rc->h = bbox.h;
+        changed = EINA_TRUE;
+     }
+   if (!changed)
+     changed = (rc->x != bbox.x) || (rc->y != bbox.y) || rc->dirty;
+
+   if (changed)
+     {
+        RD(level, "  render cache redraw\n");
+        ctx = ENFN->context_new(ENC);
+        ENFN->context_color_set(ENC, ctx, 0, 0, 0, 0);
+        ENFN->context_render_op_set(ENC, ctx, EVAS_RENDER_COPY);
+        ENFN->rectangle_draw(ENC, output, ctx, rc->surface,
+                             0, 0, rc->w, rc->h, do_async);
+        ENFN->context_free(ENC, ctx);
+
+        /* members render as they would inside a proxy source, relative to
+         * the bounding box and clipped by their own clippers */
+        ctx = ENFN->context_new(ENC);
+        EINA_INLIST_FOREACH(evas_object_smart_members_get_direct(eo_obj), obj2)
+          {
+             clean_them |= evas_render_mapped(evas, obj2->object, obj2, ctx,
+                                              output, rc->surface,
+                                              -bbox.x, -bbox.y, 2,
+                                              0, 0, rc->w, rc->h,
+                                              NULL, level + 1, do_async);
+          }
+        ENFN->context_free(ENC, ctx);
+
+        rc->surface = ENFN->image_dirty_region(ENC, rc->surface,
+                                               0, 0, rc->w, rc->h);
+        rc->x = bbox.x;
+        rc->y = bbox.y;
+        /* further update regions this frame reuse the surface */
+        rc->dirty = EINA_FALSE;
+        rc->misses++;
+     }
+   else rc->hits++;
+
+   ctx = ENFN->context_dup(ENC, context);
+   if (!_is_obj_in_framespace(obj, evas))
+     {
+        _evas_render_framespace_context_clip_clip
+              (evas, ctx, off_x - evas->framespace.x, off_y - evas->framespace.y);
+     }
+   ENFN->context_multiplier_unset(ENC, ctx);
+   ENFN->context_render_op_set(ENC, ctx, EVAS_RENDER_BLEND);
+   ENFN->image_draw(ENC, output, ctx, surface, rc->surface,
+                    0, 0, rc->w, rc->h,
+                    rc->x + off_x, rc->y + off_y, rc->w, rc->h,
+                    EINA_FALSE, do_async);
+   ENFN->context_free(ENC, ctx);
+
+   return clean_them;
+}
+
 Eina_Bool
 evas_render_mapped(Evas_Public_Data *evas, Evas_Object *eo_obj,
                    Evas_Object_Protected_Data *obj, void *context,
@@ -1885,6 +2040,13 @@ evas_render_mapped(Evas_Public_Data *evas, Evas_Object *eo_obj,
       _evas_render_has_map(obj) ? "yes" : "no",
       obj->func->can_map ? obj->func->can_map(eo_obj): -1,
       obj->map->cur.map, obj->map->cur.usemap);
+   if (EINA_UNLIKELY(!mapped && _evas_render_object_is_cached(obj)))
+     {
+        clean_them = _evas_render_cached_draw(evas, eo_obj, obj, context,
+                                              output, surface, off_x, off_y,
+                                              level, do_async);
+        goto end;
+     }
    if (_evas_render_has_map(obj) && !_evas_render_can_map(obj))
      {
         int sw, sh;
@@ -2784,6 +2946,45 @@ _is_obj_in_rect(Evas_Object *eo_obj, Evas_Object_Protected_Data *obj,
 }
 #endif
 
+static void
+_evas_render_active_spans_update(Evas_Public_Data *e)
+{
+   Evas_Active_Span *span;
+
+   /* union of exactly the rects the draw loop intersects each entry with,
+    * min/max of the edges keeps that test conservative for empty rects */
+   EINA_INARRAY_FOREACH(&e->active_spans, span)
+     {
+        unsigned int i;
+        int x1 = INT_MAX, y1 = INT_MAX, x2 = INT_MIN, y2 = INT_MIN;
+
+        for (i = span->start; i < span->start + span->count; i++)
+          {
+             Evas_Active_Entry *ent = eina_inarray_nth(&e->active_objects, i);
+             Evas_Object_Protected_Data *obj = ent->obj;
+             Eina_Rectangle r;
+
+#ifdef INLINE_ACTIVE_GEOM
+             r = ent->rect;
+#else
+             if (obj->is_smart && !_evas_render_has_map(obj))
+               evas_object_smart_bounding_box_get(obj, &r, NULL);
+             else
+               EINA_RECTANGLE_SET(&r,
+                                  obj->cur->cache.clip.x,
+                                  obj->cur->cache.clip.y,
+                                  obj->cur->cache.clip.w,
+                                  obj->cur->cache.clip.h);
+#endif
+             if (r.x < x1) x1 = r.x;
+             if (r.y < y1) y1 = r.y;
+             if (r.x + r.w > x2) x2 = r.x + r.w;
+             if (r.y + r.h > y2) y2 = r.y + r.h;
+          }
+        EINA_RECTANGLE_SET(&span->bounds, x1, y1, x2 - x1, y2 - y1);
+     }
+}
+
 static void
 _snapshot_redraw_update(Evas_Public_Data *evas, Evas_Object_Protected_Data *snap)
 {
@@ -2924,8 +3125,9 @@ evas_render_updates_internal_loop(Evas *eo_e, Evas_Public_Data *evas,
 {
    Evas_Object *eo_obj;
    Evas_Object_Protected_Data *obj;
+   Evas_Active_Span *span = NULL;
    int off_x, off_y;
-   unsigned int i, j;
+   unsigned int i, j, span_idx = 0;
    Eina_Bool clean_them = EINA_FALSE;
    Eina_Bool above_top = EINA_FALSE;
 
@@ -2966,14 +3168,35 @@ evas_render_updates_internal_loop(Evas *eo_e, Evas_Public_Data *evas,
         ENFN->context_cutout_clear(ENC, context);
         ENFN->context_clip_unset(ENC, context);
      }
+   if (evas->active_spans.len > 0)
+     span = eina_inarray_nth(&evas->active_spans, 0);
    eina_evlog("-render_setup", eo_e, 0.0, NULL);
 
    eina_evlog("+render_objects", eo_e, 0.0, NULL);
    /* render all object that intersect with rect */
    for (i = 0; i < evas->active_objects.len; i++)
      {
-        Evas_Active_Entry *ent = eina_inarray_nth(&evas->active_objects, i);
+        Evas_Active_Entry *ent;
+
+        /* snapshots stop at their top object, so only skip cached spans
+         * when rendering the whole canvas */
+        if ((!top) && (span) && (span->start == i))
+          {
+             Evas_Active_Span *skip = span;
+
+             span = (span_idx + 1 < evas->active_spans.len) ?
+               eina_inarray_nth(&evas->active_spans, ++span_idx) : NULL;
+             if (!RECTS_INTERSECT(ux - fx, uy - fy, uw, uh,
+                                  skip->bounds.x, skip->bounds.y,
+                                  skip->bounds.w, skip->bounds.h))
+               {
+                  RD(level, "    SKIP %u cached objects\n", skip->count);
+                  i += skip->count - 1;
+                  continue;
+               }
+          }
 
+        ent = eina_inarray_nth(&evas->active_objects, i);
         obj = ent->obj;
         eo_obj = obj->object;
 
@@ -3392,6 +3615,7 @@ evas_render_updates_internal(Evas *eo_e,
              _snapshot_redraw_update(evas, obj);
           }
      }
+   if (do_draw) _evas_render_active_spans_update(e);
    eina_evlog("-render_phase5", eo_e, 0.0, NULL);
 
    EINA_LIST_FOREACH(e->outputs, l, out)
@@ -3703,6 +3927,7 @@ evas_render_updates_internal(Evas *eo_e,
    if (clean_them)
      {
         eina_inarray_flush(&e->active_objects);
+        eina_inarray_flush(&e->active_spans);
         OBJS_ARRAY_CLEAN(&e->render_objects);
         OBJS_ARRAY_CLEAN(&e->restack_objects);
         OBJS_ARRAY_CLEAN(&e->temporary_objects);
@@ -4039,6 +4264,7 @@ _evas_canvas_render_idle_flush(Eo *eo_e, Evas_Public_Data *evas)
      }
 
    eina_inarray_flush(&evas->active_objects);
+   eina_inarray_flush(&evas->active_spans);
    OBJS_ARRAY_FLUSH(&evas->render_objects);
    OBJS_ARRAY_FLUSH(&evas->restack_objects);
    OBJS_ARRAY_FLUSH(&evas->delete_objects);
@@ -4073,6 +4299,8 @@ _evas_render_dump_map_surfaces(Evas_Object *eo_obj)
         EINA_COW_WRITE_END(evas_object_map_cow, obj->map, map_write);
      }
 
+   evas_object_render_cache_surface_free(obj);
+
    if (obj->is_smart)
      {
         Evas_Object_Protected_Data *obj2;
@@ -4155,6 +4383,7 @@ if (Cow) while (eina_cow_gc(Cow))
      }
 
    eina_inarray_flush(&evas->active_objects);
+   eina_inarray_flush(&evas->active_spans);
    OBJS_ARRAY_FLUSH(&evas->render_objects);
    OBJS_ARRAY_FLUSH(&evas->restack_objects);
    OBJS_ARRAY_FLUSH(&evas->delete_objects);
@@ -4178,7 +4407,9 @@ evas_render_invalidate(Evas *eo_e)
    MAGIC_CHECK_END();
    e = efl_data_scope_get(eo_e, EVAS_CANVAS_CLASS);
 
+   _evas_event_index_invalidate(e);
    eina_inarray_flush(&e->active_objects);
+   eina_inarray_flush(&e->active_spans);
    OBJS_ARRAY_CLEAN(&e->render_objects);
 
    OBJS_ARRAY_FLUSH(&e->restack_objects);
@@ -58,6 +58,7 @@ _efl_canvas_object_efl_gfx_stack_raise_to_top(Eo *eo_obj, Evas_Object_Protected_
         if (obj->in_layer)
           obj->layer->objects = (Evas_Object_Protected_Data *)eina_inlist_demote(EINA_INLIST_GET(obj->layer->objects), EINA_INLIST_GET(obj));
      }
+   _evas_object_event_index_invalidate(obj);
    if (obj->clip.clipees)
      {
         evas_object_inform_call_restack(eo_obj, obj);
@@ -108,6 +109,7 @@ _efl_canvas_object_efl_gfx_stack_lower_to_bottom(Eo *eo_obj, Evas_Object_Protect
           obj->layer->objects = (Evas_Object_Protected_Data *)eina_inlist_promote(EINA_INLIST_GET(obj->layer->objects),
                                                                                  EINA_INLIST_GET(obj));
      }
+   _evas_object_event_index_invalidate(obj);
    if (obj->clip.clipees)
      {
         evas_object_inform_call_restack(eo_obj, obj);
@@ -200,6 +202,7 @@ _efl_canvas_object_efl_gfx_stack_stack_above(Eo *eo_obj, Evas_Object_Protected_D
                                                                                             EINA_INLIST_GET(above));
           }
      }
+   _evas_object_event_index_invalidate(obj);
    if (obj->clip.clipees)
      {
         evas_object_inform_call_restack(eo_obj, obj);
@@ -290,6 +293,7 @@ _efl_canvas_object_efl_gfx_stack_stack_below(Eo *eo_obj, Evas_Object_Protected_D
                                                                                EINA_INLIST_GET(below));
           }
      }
+   _evas_object_event_index_invalidate(obj);
    if (obj->clip.clipees)
      {
         evas_object_inform_call_restack(eo_obj, obj);
@@ -156,6 +156,38 @@ evas_common_convert_init(void)
 {
 }
 
+typedef struct _Convert_Rows Convert_Rows;
+struct _Convert_Rows
+{
+   Gfx_Func_Convert func;
+   DATA32 *src;
+   DATA8 *dst;
+   DATA8 *pal;
+   int bpp, src_jump, dst_jump, w, dith_x, dith_y;
+};
+
+static void
+_evas_common_convert_rows(void *data, unsigned int start, unsigned int end)
+{
+   Convert_Rows *cr = data;
+
+   cr->func(cr->src + (size_t)start * (cr->w + cr->src_jump),
+            cr->dst + (size_t)start * (cr->w + cr->dst_jump) * cr->bpp,
+            cr->src_jump, cr->dst_jump, cr->w, end - start,
+            cr->dith_x, cr->dith_y + start, cr->pal);
+}
+
+EAPI void
+evas_common_convert_rows_parallel(Gfx_Func_Convert func, int bpp, DATA32 *src, DATA8 *dst, int src_jump, int dst_jump, int w, int h, int dith_x, int dith_y, DATA8 *pal)
+{
+   Convert_Rows cr = { func, src, dst, pal, bpp, src_jump, dst_jump, w, dith_x, dith_y };
+
+   if ((w <= 0) || (h <= 0)) return;
+   // bands of about 16k pixels, smaller ones cost more to hand out than
+   // to convert
+   eina_parallel_for(0, h, MAX(1, 16384 / w), _evas_common_convert_rows, &cr);
+}
+
 EAPI Gfx_Func_Convert
 evas_common_convert_func_get(DATA8 *dest, int w, int h EINA_UNUSED, int depth, DATA32 rmask, DATA32 gmask, DATA32 bmask, Convert_Pal_Mode pal_mode, int rotation)
 {
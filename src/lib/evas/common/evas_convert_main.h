@@ -4,6 +4,7 @@
 
 EAPI void             evas_common_convert_init          (void);
 EAPI Gfx_Func_Convert evas_common_convert_func_get      (DATA8 *dest, int w, int h, int depth, DATA32 rmask, DATA32 gmask, DATA32 bmask, Convert_Pal_Mode pal_mode, int rotation);
+EAPI void             evas_common_convert_rows_parallel (Gfx_Func_Convert func, int bpp, DATA32 *src, DATA8 *dst, int src_jump, int dst_jump, int w, int h, int dith_x, int dith_y, DATA8 *pal);
 
 
 #endif /* _EVAS_CONVERT_MAIN_H */
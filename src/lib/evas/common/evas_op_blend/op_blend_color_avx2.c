@@ -0,0 +1,34 @@
+/* blend color --> dst */
+
+static void
+_op_blend_c_dp_avx2(DATA32 *s EINA_UNUSED, DATA8 *m EINA_UNUSED, DATA32 c, DATA32 *d, int l) {
+   DATA32 *e = d + (l & ~7), a = 256 - (c >> 24);
+   const __m256i vc = _mm256_set1_epi32(c);
+   const __m256i va = _mm256_set1_epi16(a);
+
+   for (; d < e; d += 8)
+     {
+        __m256i vd = _mm256_loadu_si256((__m256i *)d);
+
+        vd = _mm256_add_epi32(vc, mul_256_avx2(va, vd));
+        _mm256_storeu_si256((__m256i *)d, vd);
+     }
+   e += l & 7;
+   for (; d < e; d++)
+     *d = c + MUL_256(a, *d);
+}
+
+#define _op_blend_caa_dp_avx2 _op_blend_c_dp_avx2
+
+#define _op_blend_c_dpan_avx2 _op_blend_c_dp_avx2
+#define _op_blend_caa_dpan_avx2 _op_blend_c_dpan_avx2
+
+static void
+init_blend_color_span_funcs_avx2(void)
+{
+   op_blend_span_funcs[SP_N][SM_N][SC][DP][CPU_AVX2] = _op_blend_c_dp_avx2;
+   op_blend_span_funcs[SP_N][SM_N][SC_AA][DP][CPU_AVX2] = _op_blend_caa_dp_avx2;
+
+   op_blend_span_funcs[SP_N][SM_N][SC][DP_AN][CPU_AVX2] = _op_blend_c_dpan_avx2;
+   op_blend_span_funcs[SP_N][SM_N][SC_AA][DP_AN][CPU_AVX2] = _op_blend_caa_dpan_avx2;
+}
@@ -0,0 +1,77 @@
+/* blend pixel --> dst */
+
+static void
+_op_blend_p_dp_avx2(DATA32 *s, DATA8 *m EINA_UNUSED, DATA32 c EINA_UNUSED, DATA32 *d, int l) {
+   DATA32 *e = d + (l & ~7);
+   int alpha;
+
+   for (; d < e; d += 8, s += 8)
+     {
+        __m256i vs = _mm256_loadu_si256((__m256i *)s);
+        __m256i vd = _mm256_loadu_si256((__m256i *)d);
+
+        vd = _mm256_add_epi32(vs, mul_256_avx2(sub_alpha_avx2(vs), vd));
+        _mm256_storeu_si256((__m256i *)d, vd);
+     }
+   e += l & 7;
+   for (; d < e; d++, s++)
+     {
+        alpha = 256 - (*s >> 24);
+        *d = *s + MUL_256(alpha, *d);
+     }
+}
+
+static void
+_op_blend_pas_dp_avx2(DATA32 *s, DATA8 *m EINA_UNUSED, DATA32 c EINA_UNUSED, DATA32 *d, int l) {
+   const __m256i a_mask = _mm256_set1_epi32(0xff000000);
+   DATA32 *e = d + (l & ~7);
+   int alpha;
+
+   for (; d < e; d += 8, s += 8)
+     {
+        __m256i vs = _mm256_loadu_si256((__m256i *)s);
+        __m256i va = _mm256_and_si256(vs, a_mask);
+        __m256i vt = _mm256_cmpeq_epi32(va, _mm256_setzero_si256());
+        __m256i vd;
+
+        /* runs of fully transparent or opaque pixels are the common case */
+        if (_mm256_movemask_epi8(vt) == -1) continue;
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(va, a_mask)) == -1)
+          {
+             _mm256_storeu_si256((__m256i *)d, vs);
+             continue;
+          }
+        vd = _mm256_loadu_si256((__m256i *)d);
+        vs = _mm256_add_epi32(vs, mul_256_avx2(sub_alpha_avx2(vs), vd));
+        _mm256_storeu_si256((__m256i *)d, _mm256_blendv_epi8(vs, vd, vt));
+     }
+   e += l & 7;
+   for (; d < e; d++, s++)
+     {
+        switch (*s & 0xff000000)
+          {
+          case 0:
+             break;
+          case 0xff000000:
+             *d = *s;
+             break;
+          default:
+             alpha = 256 - (*s >> 24);
+             *d = *s + MUL_256(alpha, *d);
+             break;
+          }
+     }
+}
+
+#define _op_blend_p_dpan_avx2 _op_blend_p_dp_avx2
+#define _op_blend_pas_dpan_avx2 _op_blend_pas_dp_avx2
+
+static void
+init_blend_pixel_span_funcs_avx2(void)
+{
+   op_blend_span_funcs[SP][SM_N][SC_N][DP][CPU_AVX2] = _op_blend_p_dp_avx2;
+   op_blend_span_funcs[SP_AS][SM_N][SC_N][DP][CPU_AVX2] = _op_blend_pas_dp_avx2;
+
+   op_blend_span_funcs[SP][SM_N][SC_N][DP_AN][CPU_AVX2] = _op_blend_p_dpan_avx2;
+   op_blend_span_funcs[SP_AS][SM_N][SC_N][DP_AN][CPU_AVX2] = _op_blend_pas_dpan_avx2;
+}
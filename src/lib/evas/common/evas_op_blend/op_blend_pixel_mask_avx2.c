@@ -0,0 +1,61 @@
+/* blend pixel x mask --> dst */
+
+static void
+_op_blend_p_mas_dp_avx2(DATA32 *s, DATA8 *m, DATA32 c, DATA32 *d, int l) {
+   DATA32 *e = d + (l & ~7);
+   int alpha;
+
+   /* MUL_SYM(255, x) == x and MUL_SYM(0, x) == 0, so the generic path
+    * gives the same pixels as the 0 and 255 special cases of the C code */
+   for (; d < e; d += 8, s += 8, m += 8)
+     {
+        __m256i vs, vd;
+        uint64_t vm;
+
+        memcpy(&vm, m, sizeof(vm));
+        if (!vm) continue;
+        vs = _mm256_loadu_si256((__m256i *)s);
+        vd = _mm256_loadu_si256((__m256i *)d);
+        vs = mul4_sym_avx2(load_mask_avx2(m), vs);
+        vd = _mm256_add_epi32(vs, mul_256_avx2(sub_alpha_avx2(vs), vd));
+        _mm256_storeu_si256((__m256i *)d, vd);
+     }
+   e += l & 7;
+   for (; d < e; d++, s++, m++)
+     {
+        alpha = *m;
+        switch (alpha)
+          {
+          case 0:
+             break;
+          case 255:
+             alpha = 256 - (*s >> 24);
+             *d = *s + MUL_256(alpha, *d);
+             break;
+          default:
+             c = MUL_SYM(alpha, *s);
+             alpha = 256 - (c >> 24);
+             *d = c + MUL_256(alpha, *d);
+             break;
+          }
+     }
+}
+
+#define _op_blend_pas_mas_dp_avx2 _op_blend_p_mas_dp_avx2
+#define _op_blend_pan_mas_dp_avx2 _op_blend_pas_mas_dp_avx2
+
+#define _op_blend_p_mas_dpan_avx2 _op_blend_p_mas_dp_avx2
+#define _op_blend_pas_mas_dpan_avx2 _op_blend_pas_mas_dp_avx2
+#define _op_blend_pan_mas_dpan_avx2 _op_blend_pan_mas_dp_avx2
+
+static void
+init_blend_pixel_mask_span_funcs_avx2(void)
+{
+   op_blend_span_funcs[SP][SM_AS][SC_N][DP][CPU_AVX2] = _op_blend_p_mas_dp_avx2;
+   op_blend_span_funcs[SP_AS][SM_AS][SC_N][DP][CPU_AVX2] = _op_blend_pas_mas_dp_avx2;
+   op_blend_span_funcs[SP_AN][SM_AS][SC_N][DP][CPU_AVX2] = _op_blend_pan_mas_dp_avx2;
+
+   op_blend_span_funcs[SP][SM_AS][SC_N][DP_AN][CPU_AVX2] = _op_blend_p_mas_dpan_avx2;
+   op_blend_span_funcs[SP_AS][SM_AS][SC_N][DP_AN][CPU_AVX2] = _op_blend_pas_mas_dpan_avx2;
+   op_blend_span_funcs[SP_AN][SM_AS][SC_N][DP_AN][CPU_AVX2] = _op_blend_pan_mas_dpan_avx2;
+}
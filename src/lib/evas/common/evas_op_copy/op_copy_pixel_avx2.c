@@ -0,0 +1,44 @@
+/* copy pixel --> dst */
+
+static void
+_op_copy_p_dp_avx2(DATA32 *s, DATA8 *m EINA_UNUSED, DATA32 c EINA_UNUSED, DATA32 *d, int l) {
+   DATA32 *e = d + (l & ~31);
+
+   for (; d < e; d += 32, s += 32)
+     {
+        __m256i v0 = _mm256_loadu_si256((__m256i *)s);
+        __m256i v1 = _mm256_loadu_si256((__m256i *)(s + 8));
+        __m256i v2 = _mm256_loadu_si256((__m256i *)(s + 16));
+        __m256i v3 = _mm256_loadu_si256((__m256i *)(s + 24));
+
+        _mm256_storeu_si256((__m256i *)d, v0);
+        _mm256_storeu_si256((__m256i *)(d + 8), v1);
+        _mm256_storeu_si256((__m256i *)(d + 16), v2);
+        _mm256_storeu_si256((__m256i *)(d + 24), v3);
+     }
+   e += l & 24;
+   for (; d < e; d += 8, s += 8)
+     _mm256_storeu_si256((__m256i *)d, _mm256_loadu_si256((__m256i *)s));
+   e += l & 7;
+   for (; d < e; d++, s++)
+     *d = *s;
+}
+
+#define _op_copy_pan_dp_avx2 _op_copy_p_dp_avx2
+#define _op_copy_pas_dp_avx2 _op_copy_p_dp_avx2
+
+#define _op_copy_p_dpan_avx2 _op_copy_p_dp_avx2
+#define _op_copy_pan_dpan_avx2 _op_copy_pan_dp_avx2
+#define _op_copy_pas_dpan_avx2 _op_copy_pas_dp_avx2
+
+static void
+init_copy_pixel_span_funcs_avx2(void)
+{
+   op_copy_span_funcs[SP][SM_N][SC_N][DP][CPU_AVX2] = _op_copy_p_dp_avx2;
+   op_copy_span_funcs[SP_AN][SM_N][SC_N][DP][CPU_AVX2] = _op_copy_pan_dp_avx2;
+   op_copy_span_funcs[SP_AS][SM_N][SC_N][DP][CPU_AVX2] = _op_copy_pas_dp_avx2;
+
+   op_copy_span_funcs[SP][SM_N][SC_N][DP_AN][CPU_AVX2] = _op_copy_p_dpan_avx2;
+   op_copy_span_funcs[SP_AN][SM_N][SC_N][DP_AN][CPU_AVX2] = _op_copy_pan_dpan_avx2;
+   op_copy_span_funcs[SP_AS][SM_N][SC_N][DP_AN][CPU_AVX2] = _op_copy_pas_dpan_avx2;
+}
@@ -0,0 +1,116 @@
+#define NEED_AVX2 1
+
+#include "Eina.h"
+
+#include "evas_common_types.h"
+
+#include "config.h"
+#include "evas_blend_ops.h"
+
+extern RGBA_Gfx_Func     op_blend_span_funcs[SP_LAST][SM_LAST][SC_LAST][DP_LAST][CPU_LAST];
+extern RGBA_Gfx_Func     op_copy_span_funcs[SP_LAST][SM_LAST][SC_LAST][DP_LAST][CPU_LAST];
+extern RGBA_Gfx_Func     op_mul_span_funcs[SP_LAST][SM_LAST][SC_LAST][DP_LAST][CPU_LAST];
+
+#ifdef BUILD_AVX2
+
+/* All spans work on 8 pixels at a time and finish the last l % 8 pixels
+ * with the C macros, so the results are the same as the C functions to
+ * the bit. Nothing is aligned, so only unaligned loads and stores. */
+
+/* MUL_256() on 8 pixels. a holds the factor, from 1 to 256, in both 16 bit
+ * halves of each pixel. */
+static inline __m256i
+mul_256_avx2(__m256i a, __m256i c)
+{
+   const __m256i rb_mask = _mm256_set1_epi32(0x00ff00ff);
+   const __m256i ag_mask = _mm256_set1_epi32(0xff00ff00);
+   __m256i ag, rb;
+
+   ag = _mm256_mullo_epi16(_mm256_srli_epi16(c, 8), a);
+   ag = _mm256_and_si256(ag, ag_mask);
+   rb = _mm256_mullo_epi16(_mm256_and_si256(c, rb_mask), a);
+   rb = _mm256_srli_epi16(rb, 8);
+   return _mm256_or_si256(ag, rb);
+}
+
+/* MUL4_SYM() on 8 pixels: every channel is (x * y + 255) / 256 */
+static inline __m256i
+mul4_sym_avx2(__m256i x, __m256i y)
+{
+   const __m256i zero = _mm256_setzero_si256();
+   const __m256i round = _mm256_set1_epi16(0xff);
+   __m256i lo, hi;
+
+   lo = _mm256_mullo_epi16(_mm256_unpacklo_epi8(x, zero),
+                           _mm256_unpacklo_epi8(y, zero));
+   hi = _mm256_mullo_epi16(_mm256_unpackhi_epi8(x, zero),
+                           _mm256_unpackhi_epi8(y, zero));
+   lo = _mm256_srli_epi16(_mm256_add_epi16(lo, round), 8);
+   hi = _mm256_srli_epi16(_mm256_add_epi16(hi, round), 8);
+   return _mm256_packus_epi16(lo, hi);
+}
+
+/* 256 - alpha of each pixel, in both 16 bit halves, ready for
+ * mul_256_avx2() */
+static inline __m256i
+sub_alpha_avx2(__m256i c)
+{
+   const __m256i alpha_shuf = _mm256_setr_epi8
+     (3, -1, 3, -1, 7, -1, 7, -1, 11, -1, 11, -1, 15, -1, 15, -1,
+      3, -1, 3, -1, 7, -1, 7, -1, 11, -1, 11, -1, 15, -1, 15, -1);
+
+   return _mm256_sub_epi16(_mm256_set1_epi16(256),
+                           _mm256_shuffle_epi8(c, alpha_shuf));
+}
+
+/* 8 mask values spread over all 4 channels of their pixel, so that
+ * mul4_sym_avx2() does MUL_SYM() */
+static inline __m256i
+load_mask_avx2(const DATA8 *m)
+{
+   const __m256i mask_shuf = _mm256_setr_epi8
+     (0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12,
+      0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12);
+   __m256i vm;
+
+   vm = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)m));
+   return _mm256_shuffle_epi8(vm, mask_shuf);
+}
+
+# include "evas_op_blend/op_blend_pixel_avx2.c"
+# include "evas_op_blend/op_blend_color_avx2.c"
+# include "evas_op_blend/op_blend_pixel_mask_avx2.c"
+# include "evas_op_copy/op_copy_pixel_avx2.c"
+# include "evas_op_copy/op_copy_color_avx2.c"
+# include "evas_op_mul/op_mul_pixel_avx2.c"
+# include "evas_op_mul/op_mul_color_avx2.c"
+
+#endif
+
+void
+evas_common_op_blend_init_avx2(void)
+{
+#ifdef BUILD_AVX2
+   init_blend_pixel_span_funcs_avx2();
+   init_blend_color_span_funcs_avx2();
+   init_blend_pixel_mask_span_funcs_avx2();
+#endif
+}
+
+void
+evas_common_op_copy_init_avx2(void)
+{
+#ifdef BUILD_AVX2
+   init_copy_pixel_span_funcs_avx2();
+   init_copy_color_span_funcs_avx2();
+#endif
+}
+
+void
+evas_common_op_mul_init_avx2(void)
+{
+#ifdef BUILD_AVX2
+   init_mul_pixel_span_funcs_avx2();
+   init_mul_color_span_funcs_avx2();
+#endif
+}
@@ -0,0 +1,53 @@
+/* mul color --> dst */
+
+static void
+_op_mul_c_dp_avx2(DATA32 *s EINA_UNUSED, DATA8 *m EINA_UNUSED, DATA32 c, DATA32 *d, int l) {
+   const __m256i vc = _mm256_set1_epi32(c);
+   DATA32 *e = d + (l & ~7);
+
+   for (; d < e; d += 8)
+     {
+        __m256i vd = _mm256_loadu_si256((__m256i *)d);
+
+        _mm256_storeu_si256((__m256i *)d, mul4_sym_avx2(vc, vd));
+     }
+   e += l & 7;
+   for (; d < e; d++)
+     *d = MUL4_SYM(c, *d);
+}
+
+static void
+_op_mul_caa_dp_avx2(DATA32 *s EINA_UNUSED, DATA8 *m EINA_UNUSED, DATA32 c, DATA32 *d, int l) {
+   DATA32 *e = d + (l & ~7);
+   __m256i va;
+
+   c = 1 + (c >> 24);
+   va = _mm256_set1_epi16(c);
+   for (; d < e; d += 8)
+     {
+        __m256i vd = _mm256_loadu_si256((__m256i *)d);
+
+        _mm256_storeu_si256((__m256i *)d, mul_256_avx2(va, vd));
+     }
+   e += l & 7;
+   for (; d < e; d++)
+     *d = MUL_256(c, *d);
+}
+
+#define _op_mul_can_dp_avx2 _op_mul_c_dp_avx2
+
+#define _op_mul_c_dpan_avx2 _op_mul_c_dp_avx2
+#define _op_mul_can_dpan_avx2 _op_mul_can_dp_avx2
+#define _op_mul_caa_dpan_avx2 _op_mul_caa_dp_avx2
+
+static void
+init_mul_color_span_funcs_avx2(void)
+{
+   op_mul_span_funcs[SP_N][SM_N][SC][DP][CPU_AVX2] = _op_mul_c_dp_avx2;
+   op_mul_span_funcs[SP_N][SM_N][SC_AN][DP][CPU_AVX2] = _op_mul_can_dp_avx2;
+   op_mul_span_funcs[SP_N][SM_N][SC_AA][DP][CPU_AVX2] = _op_mul_caa_dp_avx2;
+
+   op_mul_span_funcs[SP_N][SM_N][SC][DP_AN][CPU_AVX2] = _op_mul_c_dpan_avx2;
+   op_mul_span_funcs[SP_N][SM_N][SC_AN][DP_AN][CPU_AVX2] = _op_mul_can_dpan_avx2;
+   op_mul_span_funcs[SP_N][SM_N][SC_AA][DP_AN][CPU_AVX2] = _op_mul_caa_dpan_avx2;
+}
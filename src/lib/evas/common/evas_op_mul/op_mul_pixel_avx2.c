@@ -0,0 +1,36 @@
+/* mul pixel --> dst */
+
+static void
+_op_mul_p_dp_avx2(DATA32 *s, DATA8 *m EINA_UNUSED, DATA32 c EINA_UNUSED, DATA32 *d, int l) {
+   DATA32 *e = d + (l & ~7);
+
+   for (; d < e; d += 8, s += 8)
+     {
+        __m256i vs = _mm256_loadu_si256((__m256i *)s);
+        __m256i vd = _mm256_loadu_si256((__m256i *)d);
+
+        _mm256_storeu_si256((__m256i *)d, mul4_sym_avx2(vs, vd));
+     }
+   e += l & 7;
+   for (; d < e; d++, s++)
+     *d = MUL4_SYM(*s, *d);
+}
+
+#define _op_mul_pas_dp_avx2 _op_mul_p_dp_avx2
+#define _op_mul_pan_dp_avx2 _op_mul_p_dp_avx2
+
+#define _op_mul_p_dpan_avx2 _op_mul_p_dp_avx2
+#define _op_mul_pas_dpan_avx2 _op_mul_pas_dp_avx2
+#define _op_mul_pan_dpan_avx2 _op_mul_pan_dp_avx2
+
+static void
+init_mul_pixel_span_funcs_avx2(void)
+{
+   op_mul_span_funcs[SP][SM_N][SC_N][DP][CPU_AVX2] = _op_mul_p_dp_avx2;
+   op_mul_span_funcs[SP_AS][SM_N][SC_N][DP][CPU_AVX2] = _op_mul_pas_dp_avx2;
+   op_mul_span_funcs[SP_AN][SM_N][SC_N][DP][CPU_AVX2] = _op_mul_pan_dp_avx2;
+
+   op_mul_span_funcs[SP][SM_N][SC_N][DP_AN][CPU_AVX2] = _op_mul_p_dpan_avx2;
+   op_mul_span_funcs[SP_AS][SM_N][SC_N][DP_AN][CPU_AVX2] = _op_mul_pas_dpan_avx2;
+   op_mul_span_funcs[SP_AN][SM_N][SC_N][DP_AN][CPU_AVX2] = _op_mul_pan_dpan_avx2;
+}
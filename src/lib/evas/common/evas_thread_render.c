@@ -16,6 +16,35 @@ static int evas_thread_exited = 0;
 static Eina_Bool exit_thread = EINA_FALSE;
 static int init_count = 0;
 
+/* Tiled commands are spread over the worker and these helper threads, in
+ * horizontal bands of at least TILE_MIN_HEIGHT lines. Runs covering less
+ * than TILE_MIN_AREA pixels are not worth waking anyone up for. The helpers
+ * are started by the worker on the first run that needs them. */
+#define TILE_MIN_HEIGHT (32)
+#define TILE_MIN_AREA (256 * 256)
+#define TILE_THREADS_MAX (16)
+
+typedef struct _Evas_Thread_Tile_Job Evas_Thread_Tile_Job;
+struct _Evas_Thread_Tile_Job
+{
+   Evas_Thread_Command *cmds;
+   unsigned int count;
+   Eina_Rectangle area;
+   unsigned int tiles;
+   unsigned int next;
+   unsigned int done;
+};
+
+static Eina_Thread evas_thread_tilers[TILE_THREADS_MAX];
+static unsigned int evas_thread_tilers_wanted = 0;
+static unsigned int evas_thread_tilers_count = 0;
+static Eina_Bool evas_thread_tilers_started = EINA_FALSE;
+static Eina_Lock evas_thread_tile_lock;
+static Eina_Condition evas_thread_tile_condition;
+static Eina_Condition evas_thread_tile_done_condition;
+static Evas_Thread_Tile_Job evas_thread_tile_job;
+static Eina_Bool evas_thread_tile_exit = EINA_FALSE;
+
 #define SHUTDOWN_TIMEOUT_RESET (0)
 #define SHUTDOWN_TIMEOUT_CHECK (1)
 #define SHUTDOWN_TIMEOUT (3000)
@@ -75,7 +104,9 @@ _shutdown_timeout(double *time, int mode, int timeout_ms)
 
 
 static void
-evas_thread_queue_append(Evas_Thread_Command_Cb cb, void *data, Eina_Bool do_flush)
+evas_thread_queue_append(Evas_Thread_Command_Cb cb, Evas_Thread_Command_Tile_Cb tile_cb,
+                         void *data, void *surface, const Eina_Rectangle *area,
+                         Eina_Bool do_flush)
 {
    Evas_Thread_Command *cmd;
 
@@ -86,6 +117,12 @@ evas_thread_queue_append(Evas_Thread_Command_Cb cb, void *data, Eina_Bool do_flu
      {
         cmd->cb = cb;
         cmd->data = data;
+        cmd->tile_cb = tile_cb;
+        cmd->surface = surface;
+        if (area)
+          cmd->area = *area;
+        else
+          EINA_RECTANGLE_SET(&cmd->area, 0, 0, 0, 0);
      }
    else
      {
@@ -106,13 +143,241 @@ out:
 EAPI void
 evas_thread_cmd_enqueue(Evas_Thread_Command_Cb cb, void *data)
 {
-   evas_thread_queue_append(cb, data, EINA_FALSE);
+   evas_thread_queue_append(cb, NULL, data, NULL, NULL, EINA_FALSE);
 }
 
 EAPI void
 evas_thread_queue_flush(Evas_Thread_Command_Cb cb, void *data)
 {
-   evas_thread_queue_append(cb, data, EINA_TRUE);
+   evas_thread_queue_append(cb, NULL, data, NULL, NULL, EINA_TRUE);
+}
+
+/* Queue a command that can be drawn tile by tile. Consecutive tiled
+ * commands drawing to the same surface are run together: the area they
+ * cover is cut in bands and each band is drawn, commands in order, by one
+ * of the render threads. free_cb is then called once, from the worker. */
+EAPI void
+evas_thread_queue_tiled_flush(Evas_Thread_Command_Tile_Cb tile_cb, Evas_Thread_Command_Cb free_cb, void *data, void *surface, const Eina_Rectangle *area)
+{
+   evas_thread_queue_append(free_cb, tile_cb, data, surface, area, EINA_TRUE);
+}
+
+static void
+_evas_thread_tile_do(Evas_Thread_Tile_Job *job, unsigned int tile)
+{
+   Eina_Rectangle band;
+   unsigned int i;
+   int y1, y2;
+
+   y1 = job->area.y + (int)(((long long)job->area.h * tile) / job->tiles);
+   y2 = job->area.y + (int)(((long long)job->area.h * (tile + 1)) / job->tiles);
+   EINA_RECTANGLE_SET(&band, job->area.x, y1, job->area.w, y2 - y1);
+
+   for (i = 0; i < job->count; i++)
+     {
+        Evas_Thread_Command *cmd = job->cmds + i;
+
+        if (!eina_rectangles_intersect(&band, &cmd->area)) continue;
+        cmd->tile_cb(cmd->data, &band);
+     }
+}
+
+/* Draw tiles of the current job until none is left, with the tile lock
+ * held on entry and on return. */
+static void
+_evas_thread_tile_job_work(void)
+{
+   Evas_Thread_Tile_Job *job = &evas_thread_tile_job;
+   unsigned int tile;
+
+   while (job->next < job->tiles)
+     {
+        tile = job->next++;
+        eina_lock_release(&evas_thread_tile_lock);
+
+        _evas_thread_tile_do(job, tile);
+
+        eina_lock_take(&evas_thread_tile_lock);
+        if (++job->done == job->tiles)
+          eina_condition_signal(&evas_thread_tile_done_condition);
+     }
+}
+
+static void *
+evas_thread_tiler_func(void *data EINA_UNUSED, Eina_Thread thread EINA_UNUSED)
+{
+   eina_thread_name_set(eina_thread_self(), "Eevas-thread-tl");
+
+   eina_lock_take(&evas_thread_tile_lock);
+   while (1)
+     {
+        while (!evas_thread_tile_exit &&
+               (evas_thread_tile_job.next >= evas_thread_tile_job.tiles))
+          eina_condition_wait(&evas_thread_tile_condition);
+        if (evas_thread_tile_exit) break;
+
+        _evas_thread_tile_job_work();
+     }
+   eina_lock_release(&evas_thread_tile_lock);
+
+   return NULL;
+}
+
+static void _evas_thread_tilers_start(void);
+
+static void
+_evas_thread_tiled_run(Evas_Thread_Command *cmds, unsigned int count)
+{
+   Evas_Thread_Tile_Job *job = &evas_thread_tile_job;
+   Eina_Rectangle area = cmds[0].area;
+   unsigned int i, tiles;
+
+   for (i = 1; i < count; i++)
+     eina_rectangle_union(&area, &cmds[i].area);
+
+   tiles = evas_thread_tilers_wanted + 1;
+   if ((unsigned int)(area.h / TILE_MIN_HEIGHT) < tiles)
+     tiles = area.h / TILE_MIN_HEIGHT;
+   if (((long long)area.w * area.h) < TILE_MIN_AREA)
+     tiles = 1;
+   if ((tiles > 1) && (!evas_thread_tilers_started))
+     _evas_thread_tilers_start();
+   if (tiles > evas_thread_tilers_count + 1)
+     tiles = evas_thread_tilers_count + 1;
+
+   eina_evlog("+thread_tiles", cmds, 0.0, NULL);
+   if (tiles <= 1)
+     {
+        for (i = 0; i < count; i++)
+          cmds[i].tile_cb(cmds[i].data, &area);
+     }
+   else
+     {
+        eina_lock_take(&evas_thread_tile_lock);
+        job->cmds = cmds;
+        job->count = count;
+        job->area = area;
+        job->tiles = tiles;
+        job->next = 0;
+        job->done = 0;
+        eina_condition_broadcast(&evas_thread_tile_condition);
+
+        _evas_thread_tile_job_work();
+        while (job->done < job->tiles)
+          eina_condition_wait(&evas_thread_tile_done_condition);
+        eina_lock_release(&evas_thread_tile_lock);
+     }
+   eina_evlog("-thread_tiles", cmds, 0.0, NULL);
+
+   for (i = 0; i < count; i++)
+     if (cmds[i].cb) cmds[i].cb(cmds[i].data);
+}
+
+static void
+_evas_thread_queue_run(Evas_Thread_Command *cmd, unsigned int len)
+{
+   unsigned int i, j;
+
+   for (i = 0; i < len; i = j)
+     {
+        assert(cmd[i].cb || cmd[i].tile_cb);
+
+        if (!cmd[i].tile_cb)
+          {
+             eina_evlog("+thread_do", cmd[i].data, 0.0, NULL);
+             cmd[i].cb(cmd[i].data);
+             eina_evlog("-thread_do", cmd[i].data, 0.0, NULL);
+             j = i + 1;
+             continue;
+          }
+
+        /* Commands for another surface may read what this run draws, so
+         * they end it. */
+        for (j = i + 1; j < len; j++)
+          if ((!cmd[j].tile_cb) || (cmd[j].surface != cmd[i].surface))
+            break;
+        _evas_thread_tiled_run(cmd + i, j - i);
+     }
+}
+
+static unsigned int
+_evas_thread_tilers_wanted_get(void)
+{
+   const char *s;
+   int n;
+
+   s = getenv("EVAS_RENDER_THREADS");
+   if (s)
+     n = atoi(s);
+   else
+     n = eina_cpu_count();
+   if (n < 1) n = 1;
+   if (n > TILE_THREADS_MAX) n = TILE_THREADS_MAX;
+
+   return n - 1;
+}
+
+/* Called from the worker, a failure is not tried again. */
+static void
+_evas_thread_tilers_start(void)
+{
+   unsigned int i, wanted = evas_thread_tilers_wanted;
+
+   evas_thread_tilers_started = EINA_TRUE;
+   evas_thread_tilers_count = 0;
+   evas_thread_tile_exit = EINA_FALSE;
+   memset(&evas_thread_tile_job, 0, sizeof(evas_thread_tile_job));
+
+   if (!eina_lock_new(&evas_thread_tile_lock))
+     {
+        ERR("Could not create tile render lock, rendering with one thread.");
+        return;
+     }
+   if (!eina_condition_new(&evas_thread_tile_condition, &evas_thread_tile_lock))
+     goto on_error_cond;
+   if (!eina_condition_new(&evas_thread_tile_done_condition, &evas_thread_tile_lock))
+     goto on_error_done_cond;
+
+   for (i = 0; i < wanted; i++)
+     {
+        if (!eina_thread_create(&evas_thread_tilers[i], EINA_THREAD_NORMAL, -1,
+                                evas_thread_tiler_func, NULL))
+          {
+             ERR("Could not create tile render thread %u of %u.", i + 1, wanted);
+             break;
+          }
+        evas_thread_tilers_count++;
+     }
+   if (evas_thread_tilers_count) return;
+
+   eina_condition_free(&evas_thread_tile_done_condition);
+on_error_done_cond:
+   eina_condition_free(&evas_thread_tile_condition);
+on_error_cond:
+   eina_lock_free(&evas_thread_tile_lock);
+   ERR("Could not start tile render threads, rendering with one thread.");
+}
+
+static void
+_evas_thread_tilers_stop(void)
+{
+   unsigned int i;
+
+   evas_thread_tilers_started = EINA_FALSE;
+   if (!evas_thread_tilers_count) return;
+
+   eina_lock_take(&evas_thread_tile_lock);
+   evas_thread_tile_exit = EINA_TRUE;
+   eina_condition_broadcast(&evas_thread_tile_condition);
+   eina_lock_release(&evas_thread_tile_lock);
+
+   for (i = 0; i < evas_thread_tilers_count; i++)
+     eina_thread_join(evas_thread_tilers[i]);
+   evas_thread_tilers_count = 0;
+
+   eina_condition_free(&evas_thread_tile_done_condition);
+   eina_condition_free(&evas_thread_tile_condition);
+   eina_lock_free(&evas_thread_tile_lock);
 }
 
 static void*
@@ -162,17 +427,7 @@ evas_thread_worker_func(void *data EINA_UNUSED, Eina_Thread thread EINA_UNUSED)
         DBG("Evas render thread command queue length: %u", len);
 
         eina_evlog("+thread", NULL, 0.0, NULL);
-        while (len)
-          {
-             assert(cmd->cb);
-
-             eina_evlog("+thread_do", cmd->data, 0.0, NULL);
-             cmd->cb(cmd->data);
-             eina_evlog("-thread_do", cmd->data, 0.0, NULL);
-
-             cmd++;
-             len--;
-          }
+        _evas_thread_queue_run(cmd, len);
         eina_evlog("-thread", NULL, 0.0, NULL);
      }
 
@@ -209,6 +464,11 @@ evas_thread_fork_reset(void *data EINA_UNUSED)
         goto on_error;
      }
 
+   /* Only the forking thread survived, the next tiled run starts the tile
+    * threads over. */
+   evas_thread_tilers_started = EINA_FALSE;
+   evas_thread_tilers_count = 0;
+
    return ;
 
  on_error:
@@ -267,6 +527,9 @@ evas_thread_init(void)
         goto fail_on_thread_creation;
      }
 
+   evas_thread_tilers_wanted = _evas_thread_tilers_wanted_get();
+   evas_thread_tilers_started = EINA_FALSE;
+
    ecore_fork_reset_callback_add(evas_thread_fork_reset, NULL);
 
    return init_count;
@@ -328,6 +591,7 @@ evas_thread_shutdown(void)
 
    eina_thread_join(evas_thread_worker);
 timeout_shutdown:
+   _evas_thread_tilers_stop();
    eina_lock_free(&evas_thread_exited_lock);
    eina_lock_free(&evas_thread_queue_lock);
    eina_condition_free(&evas_thread_queue_condition);
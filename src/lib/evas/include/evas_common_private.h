@@ -451,12 +451,19 @@ typedef void (*Evas_Render_Done_Cb)(void *);
 /*****************************************************************************/
 
 typedef void (*Evas_Thread_Command_Cb)(void *data);
+typedef void (*Evas_Thread_Command_Tile_Cb)(void *data, const Eina_Rectangle *tile);
 typedef struct _Evas_Thread_Command Evas_Thread_Command;
 
 struct _Evas_Thread_Command
 {
    Evas_Thread_Command_Cb cb;
    void *data;
+   /* Tiled commands only: tile_cb draws the part of area that falls in a
+    * tile, possibly from several threads at once, and cb releases data once
+    * every tile is drawn. */
+   Evas_Thread_Command_Tile_Cb tile_cb;
+   void *surface;
+   Eina_Rectangle area;
 };
 
 /*****************************************************************************/
@@ -504,7 +511,8 @@ typedef enum _CPU_Features
    CPU_FEATURE_VIS2    = (1 << 5),
    CPU_FEATURE_NEON    = (1 << 6),
    CPU_FEATURE_SSE3    = (1 << 7),
-   CPU_FEATURE_SVE     = (1 << 8)
+   CPU_FEATURE_SVE     = (1 << 8),
+   CPU_FEATURE_AVX2    = (1 << 9)
 } CPU_Features;
 
 /*****************************************************************************/
@@ -1132,6 +1140,7 @@ int               evas_thread_init(void);
 int               evas_thread_shutdown(void);
 EAPI void         evas_thread_cmd_enqueue(Evas_Thread_Command_Cb cb, void *data);
 EAPI void         evas_thread_queue_flush(Evas_Thread_Command_Cb cb, void *data);
+EAPI void         evas_thread_queue_tiled_flush(Evas_Thread_Command_Tile_Cb tile_cb, Evas_Thread_Command_Cb free_cb, void *data, void *surface, const Eina_Rectangle *area);
 
 typedef enum _Evas_Render_Mode
 {
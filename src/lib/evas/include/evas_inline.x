@@ -31,6 +31,20 @@ _evas_render_can_map(Evas_Object_Protected_Data *obj)
    return obj->func->can_map(obj->object);
 }
 
+static inline void
+_evas_event_index_invalidate(Evas_Public_Data *e)
+{
+   e->event_index.generation++;
+}
+
+/* call when the area an object takes hits in, or its stacking, changes */
+static inline void
+_evas_object_event_index_invalidate(Evas_Object_Protected_Data *obj)
+{
+   if ((obj->layer) && (obj->layer->evas))
+     _evas_event_index_invalidate(obj->layer->evas);
+}
+
 static inline void
 _evas_object_gfx_map_update(Evas_Object_Protected_Data *obj)
 {
@@ -86,6 +86,7 @@ typedef struct _Evas_Proxy_Render_Data      Evas_Proxy_Render_Data;
 typedef struct _Evas_Object_3D_Data         Evas_Object_3D_Data;
 typedef struct _Evas_Object_Mask_Data       Evas_Object_Mask_Data;
 typedef struct _Evas_Object_Pointer_Data            Evas_Object_Pointer_Data;
+typedef struct _Evas_Object_Render_Cache    Evas_Object_Render_Cache;
 
 typedef struct _Evas_Smart_Data             Evas_Smart_Data;
 typedef struct _Efl_Object_Event_Grabber_Data  Efl_Object_Event_Grabber_Data;
@@ -743,6 +744,17 @@ typedef struct
    Evas_Object_Protected_Data *obj;
 } Evas_Active_Entry;
 
+/* A run of active_objects entries appended in one go from a smart object
+ * render cache. bounds is the union of the rects the draw loop tests each
+ * entry against, so the whole run can be skipped for an update region that
+ * does not touch it. */
+typedef struct
+{
+   Eina_Rectangle bounds;
+   unsigned int   start;
+   unsigned int   count;
+} Evas_Active_Span;
+
 typedef struct Evas_Pointer_Seat
 {
    EINA_INLIST;
@@ -825,6 +837,7 @@ struct _Evas_Public_Data
 
    Eina_Array     delete_objects;
    Eina_Inarray   active_objects;
+   Eina_Inarray   active_spans;
    Eina_Array     restack_objects;
    Eina_Array     render_objects;
    Eina_Array     pending_objects;
@@ -849,6 +862,13 @@ struct _Evas_Public_Data
 
    Eina_List     *post_events; // free me on evas_free
 
+   struct {
+      Eina_Hash   *grids; // object inlist -> Evas_Event_Grid, see evas_events.c
+      unsigned int generation; // bumped by anything that moves objects
+      unsigned int built; // generation the grids were built for
+      int          walking;
+   } event_index;
+
    Eina_Inlist    *callbacks;
    Eina_Inlist    *deferred_callbacks;
 
@@ -1029,6 +1049,15 @@ struct _Evas_Object_Mask_Data
    Eina_Bool      is_scaled : 1;
 };
 
+struct _Evas_Object_Render_Cache
+{
+   void          *surface;
+   int            x, y, w, h; // canvas area held by surface
+   unsigned int   hits;
+   unsigned int   misses;
+   Eina_Bool      dirty : 1; // a member changed since surface was rendered
+};
+
 struct _Evas_Object_Events_Data
 {
    /*
@@ -1130,6 +1159,8 @@ struct _Evas_Object_Protected_Data
 
    Evas_Size_Hints            *size_hints;
 
+   Evas_Object_Render_Cache   *render_cache; // only for cached groups
+
    int                         last_mouse_down_counter;
    int                         last_mouse_up_counter;
    int                         last_event_id;
@@ -1548,6 +1579,8 @@ void evas_object_update_bounding_box(Evas_Object *obj, Evas_Object_Protected_Dat
 void evas_object_inject(Evas_Object *obj, Evas_Object_Protected_Data *pd, Evas *e);
 void evas_object_release(Evas_Object *obj, Evas_Object_Protected_Data *pd, int clean_layer);
 void evas_object_change(Evas_Object *obj, Evas_Object_Protected_Data *pd);
+void evas_object_render_cache_surface_free(Evas_Object_Protected_Data *obj);
+void evas_event_index_free(Evas_Public_Data *e);
 void evas_object_content_change(Evas_Object *obj, Evas_Object_Protected_Data *pd);
 void evas_object_clip_changes_clean(Evas_Object_Protected_Data *obj);
 void evas_object_render_pre_visible_change(Eina_Array *rects, Evas_Object *obj, int is_v, int was_v);
@@ -0,0 +1,457 @@
+/* EINA - EFL data type library
+ * Copyright (C) 2026 Enlightenment Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library;
+ * if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef EINA_HAVE_DEBUG_THREADS
+# include <assert.h>
+#endif
+
+#include "eina_config.h"
+#include "eina_module.h"
+#include "eina_mempool.h"
+#include "eina_lock.h"
+#include "eina_thread.h"
+#include "eina_cpu.h"
+#include "eina_log.h"
+
+#ifndef NVALGRIND
+# include <memcheck.h>
+#endif
+
+#include "eina_private.h"
+
+#ifdef INF
+#undef INF
+#endif
+#define INF(...) EINA_LOG_DOM_INFO(_eina_arena_mp_log_dom, __VA_ARGS__)
+
+static int _eina_arena_mp_log_dom = -1;
+
+/*
+ * The arena serves memory by moving a pointer forward inside big chunks.
+ * Individual frees are ignored, except for the last allocation that is
+ * handed back to the chunk. eina_mempool_reset() rewinds every chunk and
+ * keeps them around, so a pool reused every frame stops calling malloc()
+ * once it has reached its steady size. eina_mempool_gc() gives back the
+ * chunks that were not needed since the last reset.
+ */
+
+#define ARENA_ALIGN 16
+
+typedef struct _Arena_Chunk Arena_Chunk;
+struct _Arena_Chunk
+{
+   Arena_Chunk *next;
+   unsigned char *last;
+   unsigned char *limit;
+   /* the allocated data start right after, at ARENA_HEADER */
+};
+
+#define ARENA_HEADER \
+  ((sizeof (Arena_Chunk) + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1))
+
+typedef struct _Arena Arena;
+struct _Arena
+{
+   const char *name;
+
+   Arena_Chunk *first;
+   Arena_Chunk *current; // chunks after this one are empty
+   unsigned char *previous; // last allocation, the only one free can give back
+
+   unsigned int chunk_size;
+   unsigned int usage; // allocations since the last reset
+   unsigned int chunks;
+
+#ifdef EINA_HAVE_DEBUG_THREADS
+   Eina_Thread self;
+#endif
+   Eina_Spinlock mutex;
+};
+
+static inline unsigned char *
+_eina_arena_chunk_base(Arena_Chunk *c)
+{
+   return (unsigned char *)c + ARENA_HEADER;
+}
+
+static inline unsigned char *
+_eina_arena_align(unsigned char *ptr, unsigned int size)
+{
+   uintptr_t align;
+
+   // same alignment rules as eina_mempool_alignof(), never more than we
+   // need for the requested size
+   if (size >= 16) align = 16;
+   else if (size >= 8) align = 8;
+   else if (size >= 4) align = 4;
+   else align = 2;
+   if (align > sizeof (void *) * 2) align = sizeof (void *) * 2;
+
+   return (unsigned char *)(((uintptr_t)ptr + align - 1) & ~(align - 1));
+}
+
+static Arena_Chunk *
+_eina_arena_chunk_new(Arena *pool, unsigned int size)
+{
+   Arena_Chunk *c;
+   size_t length;
+
+   // malloc() alignment is enough for the first allocation of a chunk
+   length = ARENA_HEADER + MAX(size, pool->chunk_size);
+
+   c = malloc(length);
+   if (!c) return NULL;
+
+   c->next = NULL;
+   c->last = _eina_arena_chunk_base(c);
+   c->limit = (unsigned char *)c + length;
+   pool->chunks++;
+
+#ifndef NVALGRIND
+   VALGRIND_MAKE_MEM_NOACCESS(c->last, c->limit - c->last);
+#endif
+
+   return c;
+}
+
+static inline void
+_eina_arena_lock(Arena *pool)
+{
+   if (!eina_spinlock_take(&pool->mutex))
+     {
+#ifdef EINA_HAVE_DEBUG_THREADS
+        assert(eina_thread_equal(pool->self, eina_thread_self()));
+#endif
+     }
+}
+
+static void *
+eina_arena_malloc(void *data, unsigned int size)
+{
+   Arena *pool = data;
+   Arena_Chunk *c;
+   unsigned char *mem = NULL;
+
+   if (!size) size = 1;
+
+   _eina_arena_lock(pool);
+
+   c = pool->current;
+   if (c)
+     {
+        mem = _eina_arena_align(c->last, size);
+        if (mem + size > c->limit) mem = NULL;
+     }
+
+   // current chunk exhausted, move to the next one that can hold it
+   while (!mem && c && c->next)
+     {
+        c = c->next;
+        c->last = _eina_arena_chunk_base(c);
+        mem = _eina_arena_align(c->last, size);
+        if (mem + size > c->limit) mem = NULL;
+     }
+
+   if (!mem)
+     {
+        Arena_Chunk *n;
+
+        n = _eina_arena_chunk_new(pool, size);
+        if (!n) goto on_error;
+
+        if (c)
+          {
+             n->next = c->next;
+             c->next = n;
+          }
+        else
+          {
+             n->next = pool->first;
+             pool->first = n;
+          }
+        c = n;
+        mem = _eina_arena_align(c->last, size);
+     }
+
+   pool->current = c;
+   pool->previous = mem;
+   c->last = mem + size;
+   pool->usage++;
+
+#ifndef NVALGRIND
+   VALGRIND_MEMPOOL_ALLOC(pool, mem, size);
+#endif
+
+ on_error:
+   eina_spinlock_release(&pool->mutex);
+   return mem;
+}
+
+static void
+eina_arena_free(void *data, void *ptr)
+{
+   Arena *pool = data;
+
+   _eina_arena_lock(pool);
+
+   // a stack like usage can give its memory back
+   if (ptr == pool->previous)
+     {
+        pool->current->last = ptr;
+        pool->previous = NULL;
+     }
+   pool->usage--;
+
+#ifndef NVALGRIND
+   VALGRIND_MEMPOOL_FREE(pool, ptr);
+#endif
+
+   eina_spinlock_release(&pool->mutex);
+}
+
+static void *
+eina_arena_realloc(void *data, void *element, unsigned int size)
+{
+   Arena *pool = data;
+   void *r = NULL;
+
+   _eina_arena_lock(pool);
+
+   // only the last allocation know where it ends
+   if (element && element == pool->previous &&
+       (unsigned char *)element + size <= pool->current->limit)
+     {
+        pool->current->last = (unsigned char *)element + size;
+        r = element;
+
+#ifndef NVALGRIND
+        VALGRIND_MEMPOOL_CHANGE(pool, element, element, size);
+#endif
+     }
+
+   eina_spinlock_release(&pool->mutex);
+   return r;
+}
+
+static Eina_Bool
+eina_arena_from(void *data, void *ptr)
+{
+   Arena *pool = data;
+   Arena_Chunk *c;
+   Eina_Bool r = EINA_FALSE;
+
+   _eina_arena_lock(pool);
+
+   if (!pool->current) goto end;
+   for (c = pool->first; c; c = c->next)
+     {
+        if ((unsigned char *)ptr >= _eina_arena_chunk_base(c) &&
+            (unsigned char *)ptr < c->last)
+          {
+             r = EINA_TRUE;
+             break;
+          }
+        if (c == pool->current) break;
+     }
+
+ end:
+   eina_spinlock_release(&pool->mutex);
+   return r;
+}
+
+static void
+eina_arena_reset(void *data)
+{
+   Arena *pool = data;
+#ifndef NVALGRIND
+   Arena_Chunk *c;
+#endif
+
+   _eina_arena_lock(pool);
+
+   // the following chunks are rewound when malloc reaches them
+   pool->current = pool->first;
+   if (pool->current)
+     pool->current->last = _eina_arena_chunk_base(pool->current);
+   pool->previous = NULL;
+   pool->usage = 0;
+
+#ifndef NVALGRIND
+   VALGRIND_DESTROY_MEMPOOL(pool);
+   VALGRIND_CREATE_MEMPOOL(pool, 0, 0);
+   for (c = pool->first; c; c = c->next)
+     VALGRIND_MAKE_MEM_NOACCESS(_eina_arena_chunk_base(c),
+                                c->limit - _eina_arena_chunk_base(c));
+#endif
+
+   eina_spinlock_release(&pool->mutex);
+}
+
+static void
+eina_arena_gc(void *data)
+{
+   Arena *pool = data;
+   Arena_Chunk *c, *next;
+
+   _eina_arena_lock(pool);
+
+   // everything after the chunk in use has not been touched since reset
+   c = pool->current;
+   if (!c)
+     {
+        next = pool->first;
+        pool->first = NULL;
+     }
+   else
+     {
+        next = c->next;
+        c->next = NULL;
+     }
+
+   for (c = next; c; c = next)
+     {
+        next = c->next;
+        free(c);
+        pool->chunks--;
+     }
+
+   eina_spinlock_release(&pool->mutex);
+}
+
+static void
+eina_arena_statistics(void *data)
+{
+   Arena *pool = data;
+
+   INF("Arena '%s': %u allocations in %u chunks of %u bytes",
+       pool->name, pool->usage, pool->chunks, pool->chunk_size);
+}
+
+static void *
+eina_arena_init(const char *context,
+                EINA_UNUSED const char *option,
+                va_list args)
+{
+   Arena *pool;
+   int item_size;
+   int item_count;
+   int page_size;
+   size_t length;
+
+   length = context ? strlen(context) + 1 : 0;
+
+   pool = calloc(1, sizeof (Arena) + length);
+   if (!pool) return NULL;
+
+   item_size = va_arg(args, int);
+   item_count = va_arg(args, int);
+   if (item_size < 1) item_size = 1;
+   if (item_count < 1) item_count = 1;
+
+   // round the chunk up to a page, as the chained pool does
+   page_size = eina_cpu_page_size();
+   pool->chunk_size = eina_mempool_alignof(item_size) * item_count + ARENA_HEADER;
+   pool->chunk_size = ((pool->chunk_size + page_size - 1) / page_size) * page_size
+     - ARENA_HEADER;
+
+   if (length)
+     {
+        pool->name = (const char *)(pool + 1);
+        memcpy((char *)pool->name, context, length);
+     }
+
+#ifdef EINA_HAVE_DEBUG_THREADS
+   pool->self = eina_thread_self();
+#endif
+   eina_spinlock_new(&pool->mutex);
+
+#ifndef NVALGRIND
+   VALGRIND_CREATE_MEMPOOL(pool, 0, 0);
+#endif
+
+   return pool;
+}
+
+static void
+eina_arena_shutdown(void *data)
+{
+   Arena *pool = data;
+
+   while (pool->first)
+     {
+        Arena_Chunk *c = pool->first;
+
+        pool->first = c->next;
+        free(c);
+     }
+
+#ifndef NVALGRIND
+   VALGRIND_DESTROY_MEMPOOL(pool);
+#endif
+
+   eina_spinlock_free(&pool->mutex);
+   free(pool);
+}
+
+static Eina_Mempool_Backend _eina_arena_mp_backend = {
+   "arena",
+   &eina_arena_init,
+   &eina_arena_free,
+   &eina_arena_malloc,
+   &eina_arena_realloc,
+   &eina_arena_gc,
+   &eina_arena_statistics,
+   &eina_arena_shutdown,
+   NULL,
+   &eina_arena_from,
+   &eina_arena_reset
+};
+
+Eina_Bool arena_init(void)
+{
+   _eina_arena_mp_log_dom = eina_log_domain_register("eina_arena_mempool",
+                                                     EINA_LOG_COLOR_DEFAULT);
+   if (_eina_arena_mp_log_dom < 0)
+     {
+        EINA_LOG_ERR("Could not register log domain: eina_arena_mempool");
+        return EINA_FALSE;
+     }
+
+   return eina_mempool_register(&_eina_arena_mp_backend);
+}
+
+void arena_shutdown(void)
+{
+   eina_mempool_unregister(&_eina_arena_mp_backend);
+   eina_log_domain_unregister(_eina_arena_mp_log_dom);
+   _eina_arena_mp_log_dom = -1;
+}
+
+#ifndef EINA_STATIC_BUILD_ARENA
+
+EINA_MODULE_INIT(arena_init);
+EINA_MODULE_SHUTDOWN(arena_shutdown);
+
+#endif /* ! EINA_STATIC_BUILD_ARENA */
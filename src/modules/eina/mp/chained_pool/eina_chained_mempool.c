@@ -70,6 +70,11 @@ static int _eina_chained_mp_log_dom = -1;
 
 #endif
 
+/* Number of free blocks a thread keeps for itself when the pool is created
+ * with the "magazine" option. Half of it moves at once between a thread
+ * magazine and the shared pool, under a single lock acquisition. */
+#define CHAINED_MAGAZINE_SIZE 32
+
 static int aligned_chained_pool = 0;
 static int page_size = 0;
 
@@ -86,6 +91,16 @@ struct _Chained_Pool
 };
 
 typedef struct _Chained_Mempool Chained_Mempool;
+typedef struct _Chained_Magazine Chained_Magazine;
+
+struct _Chained_Magazine
+{
+   EINA_INLIST;
+   Chained_Mempool *pool;
+   unsigned int count;
+   void *items[CHAINED_MAGAZINE_SIZE];
+};
+
 struct _Chained_Mempool
 {
    Eina_Inlist *first;
@@ -103,6 +118,9 @@ struct _Chained_Mempool
 #ifdef EINA_HAVE_DEBUG_THREADS
    Eina_Thread self;
 #endif
+   Eina_Inlist *magazines; // all per thread magazines, protected by mutex
+   Eina_TLS magazine_key;
+   Eina_Bool magazine : 1;
    Eina_Spinlock mutex;
 };
 
@@ -268,19 +286,22 @@ _eina_chained_mempool_free_in(Chained_Mempool *pool, Chained_Pool *p, void *ptr)
    return EINA_FALSE;
 }
 
-static void *
-eina_chained_mempool_malloc(void *data, EINA_UNUSED unsigned int size)
+static inline void
+_eina_chained_mempool_lock(Chained_Mempool *pool)
 {
-   Chained_Mempool *pool = data;
-   Chained_Pool *p = NULL;
-   void *mem;
-
    if (!eina_spinlock_take(&pool->mutex))
      {
 #ifdef EINA_HAVE_DEBUG_THREADS
         assert(eina_thread_equal(pool->self, eina_thread_self()));
 #endif
      }
+}
+
+/* Must be called with pool->mutex held */
+static void *
+_eina_chained_mempool_malloc_locked(Chained_Mempool *pool)
+{
+   Chained_Pool *p = NULL;
 
    //we have some free space in first fill chain
    if (pool->first_fill) p = pool->first_fill;
@@ -309,39 +330,23 @@ eina_chained_mempool_malloc(void *data, EINA_UNUSED unsigned int size)
      {
        //new chain created ,point it to be the first_fill chain
         pool->first_fill = _eina_chained_mp_pool_new(pool);
-        if (!pool->first_fill)
-          {
-             eina_spinlock_release(&pool->mutex);
-             return NULL;
-          }
+        if (!pool->first_fill) return NULL;
 
         pool->first = eina_inlist_prepend(pool->first, EINA_INLIST_GET(pool->first_fill));
         pool->root = eina_rbtree_inline_insert(pool->root, EINA_RBTREE_GET(pool->first_fill),
                                                _eina_chained_mp_pool_cmp, NULL);
      }
 
-   mem = _eina_chained_mempool_alloc_in(pool, pool->first_fill);
-
-   eina_spinlock_release(&pool->mutex);
-
-   return mem;
+   return _eina_chained_mempool_alloc_in(pool, pool->first_fill);
 }
 
+/* Must be called with pool->mutex held */
 static void
-eina_chained_mempool_free(void *data, void *ptr)
+_eina_chained_mempool_free_locked(Chained_Mempool *pool, void *ptr)
 {
-   Chained_Mempool *pool = data;
    Eina_Rbtree *r;
    Chained_Pool *p;
 
-   // look 4 pool
-   if (!eina_spinlock_take(&pool->mutex))
-     {
-#ifdef EINA_HAVE_DEBUG_THREADS
-        assert(eina_thread_equal(pool->self, eina_thread_self()));
-#endif
-     }
-
    // searching for the right mempool
    r = eina_rbtree_inline_lookup(pool->root, ptr, 0, _eina_chained_mp_pool_key_cmp, NULL);
 
@@ -365,9 +370,138 @@ eina_chained_mempool_free(void *data, void *ptr)
         VALGRIND_MEMPOOL_FREE(pool, ptr);
      }
 #endif
+}
+
+static void
+_eina_chained_mempool_magazine_flush(Chained_Magazine *mag, unsigned int keep)
+{
+   Chained_Mempool *pool = mag->pool;
+
+   while (mag->count > keep)
+     {
+        void *ptr = mag->items[--mag->count];
+
+#ifndef NVALGRIND
+        VALGRIND_MEMPOOL_ALLOC(pool, ptr, pool->item_alloc);
+#endif
+        _eina_chained_mempool_free_locked(pool, ptr);
+     }
+}
+
+static void
+_eina_chained_mempool_magazine_del(void *data)
+{
+   Chained_Magazine *mag = data;
+   Chained_Mempool *pool = mag->pool;
+
+   // the thread owning this magazine is going away, give everything back
+   _eina_chained_mempool_lock(pool);
+   _eina_chained_mempool_magazine_flush(mag, 0);
+   pool->magazines = eina_inlist_remove(pool->magazines, EINA_INLIST_GET(mag));
+   eina_spinlock_release(&pool->mutex);
+
+   free(mag);
+}
+
+static Chained_Magazine *
+_eina_chained_mempool_magazine_get(Chained_Mempool *pool)
+{
+   Chained_Magazine *mag;
+
+   mag = eina_tls_get(pool->magazine_key);
+   if (EINA_LIKELY(mag != NULL)) return mag;
+
+   mag = calloc(1, sizeof (Chained_Magazine));
+   if (!mag) return NULL;
+   mag->pool = pool;
+
+   if (!eina_tls_set(pool->magazine_key, mag))
+     {
+        free(mag);
+        return NULL;
+     }
+
+   _eina_chained_mempool_lock(pool);
+   pool->magazines = eina_inlist_append(pool->magazines, EINA_INLIST_GET(mag));
+   eina_spinlock_release(&pool->mutex);
+
+   return mag;
+}
+
+static void *
+eina_chained_mempool_malloc(void *data, EINA_UNUSED unsigned int size)
+{
+   Chained_Mempool *pool = data;
+   Chained_Magazine *mag = NULL;
+   void *mem;
+
+   if (pool->magazine)
+     {
+        mag = _eina_chained_mempool_magazine_get(pool);
+        if (mag && mag->count) goto from_magazine;
+     }
+
+   _eina_chained_mempool_lock(pool);
+
+   mem = _eina_chained_mempool_malloc_locked(pool);
+
+   // refill half of the magazine while we hold the lock anyway
+   if (mag && mem)
+     {
+        while (mag->count < CHAINED_MAGAZINE_SIZE / 2)
+          {
+             void *ptr = _eina_chained_mempool_malloc_locked(pool);
+
+             if (!ptr) break;
+#ifndef NVALGRIND
+             VALGRIND_MEMPOOL_FREE(pool, ptr);
+#endif
+             mag->items[mag->count++] = ptr;
+          }
+     }
 
    eina_spinlock_release(&pool->mutex);
-   return;
+
+   return mem;
+
+ from_magazine:
+   mem = mag->items[--mag->count];
+#ifndef NVALGRIND
+   VALGRIND_MEMPOOL_ALLOC(pool, mem, pool->item_alloc);
+#endif
+   return mem;
+}
+
+static void
+eina_chained_mempool_free(void *data, void *ptr)
+{
+   Chained_Mempool *pool = data;
+
+   if (pool->magazine && ptr)
+     {
+        Chained_Magazine *mag = _eina_chained_mempool_magazine_get(pool);
+
+        if (mag)
+          {
+             // full magazine, hand half of it back to the shared pool
+             if (mag->count == CHAINED_MAGAZINE_SIZE)
+               {
+                  _eina_chained_mempool_lock(pool);
+                  _eina_chained_mempool_magazine_flush(mag, CHAINED_MAGAZINE_SIZE / 2);
+                  eina_spinlock_release(&pool->mutex);
+               }
+
+#ifndef NVALGRIND
+             VALGRIND_MEMPOOL_FREE(pool, ptr);
+#endif
+             mag->items[mag->count++] = ptr;
+             return;
+          }
+     }
+
+   _eina_chained_mempool_lock(pool);
+   _eina_chained_mempool_free_locked(pool, ptr);
+   eina_spinlock_release(&pool->mutex);
 }
 
 static Eina_Bool
@@ -383,14 +517,21 @@ eina_chained_mempool_from(void *data, void *ptr)
    void *pmem;
    Eina_Bool ret = EINA_FALSE;
 
-   // look 4 pool
-   if (!eina_spinlock_take(&pool->mutex))
+   // blocks sitting in our own magazine are free, other threads' ones are
+   // only known to the shared pool as allocated
+   if (pool->magazine)
      {
-#ifdef EINA_HAVE_DEBUG_THREADS
-        assert(eina_thread_equal(pool->self, eina_thread_self()));
-#endif
+        Chained_Magazine *mag = eina_tls_get(pool->magazine_key);
+        unsigned int i;
+
+        if (mag)
+          for (i = 0; i < mag->count; i++)
+            if (mag->items[i] == ptr) return EINA_FALSE;
      }
 
+   // look 4 pool
+   _eina_chained_mempool_lock(pool);
+
    // searching for the right mempool
    r = eina_rbtree_inline_lookup(pool->root, ptr, 0, _eina_chained_mp_pool_key_cmp, NULL);
 
@@ -454,11 +595,30 @@ eina_chained_mempool_repack(void *data,
   Chained_Pool *tail;
 
   /* FIXME: Improvement - per Chained_Pool lock */
-   if (!eina_spinlock_take(&pool->mutex))
+   _eina_chained_mempool_lock(pool);
+
+   if (pool->magazine)
      {
-#ifdef EINA_HAVE_DEBUG_THREADS
-        assert(eina_thread_equal(pool->self, eina_thread_self()));
-#endif
+        Chained_Magazine *mag;
+
+        mag = eina_tls_get(pool->magazine_key);
+        if (mag) _eina_chained_mempool_magazine_flush(mag, 0);
+
+        // free blocks cached by other threads look alive from here, moving
+        // them around would hand garbage to the callback
+        EINA_INLIST_FOREACH(pool->magazines, mag)
+          if (mag->count)
+            {
+               eina_spinlock_release(&pool->mutex);
+               return;
+            }
+
+        // flushing our magazine may have released every chunk
+        if (!pool->first)
+          {
+             eina_spinlock_release(&pool->mutex);
+             return;
+          }
      }
 
    pool->first = eina_inlist_sort(pool->first,
@@ -540,7 +700,7 @@ eina_chained_mempool_realloc(EINA_UNUSED void *data,
 
 static void *
 eina_chained_mempool_init(const char *context,
-                          EINA_UNUSED const char *option,
+                          const char *option,
                           va_list args)
 {
    Chained_Mempool *mp;
@@ -585,6 +745,10 @@ eina_chained_mempool_init(const char *context,
    mp->first_fill = NULL;
    eina_spinlock_new(&mp->mutex);
 
+   if (option && strstr(option, "magazine"))
+     mp->magazine = eina_tls_cb_new(&mp->magazine_key,
+                                    _eina_chained_mempool_magazine_del);
+
    return mp;
 }
 
@@ -595,6 +759,19 @@ eina_chained_mempool_shutdown(void *data)
 
    mp = (Chained_Mempool *)data;
 
+   if (mp->magazine)
+     {
+        eina_tls_free(mp->magazine_key);
+        while (mp->magazines)
+          {
+             Chained_Magazine *mag = EINA_INLIST_CONTAINER_GET(mp->magazines, Chained_Magazine);
+
+             _eina_chained_mempool_magazine_flush(mag, 0);
+             mp->magazines = eina_inlist_remove(mp->magazines, mp->magazines);
+             free(mag);
+          }
+     }
+
    while (mp->first)
      {
         Chained_Pool *p = (Chained_Pool *)mp->first;
@@ -438,6 +438,7 @@ static int _evas_soft_gen_log_dom = -1;
 
 //#define QCMD evas_thread_cmd_enqueue
 #define QCMD evas_thread_queue_flush
+#define QCMD_TILED evas_thread_queue_tiled_flush
 
 static void
 eng_output_dump(void *engine EINA_UNUSED, void *data EINA_UNUSED)
@@ -665,22 +666,31 @@ eng_context_render_op_get(void *data EINA_UNUSED, void *context)
 }
 
 static void
-_draw_thread_rectangle_draw(void *data)
+_draw_thread_rectangle_draw(void *data, const Eina_Rectangle *tile)
 {
     Evas_Thread_Command_Rect *rect = data;
+    int x = rect->x, y = rect->y, w = rect->w, h = rect->h;
+
+    RECTS_CLIP_TO_RECT(x, y, w, h, tile->x, tile->y, tile->w, tile->h);
+    if ((w <= 0) || (h <= 0)) return;
 
     evas_common_rectangle_rgba_draw(rect->surface,
                                     rect->color, rect->render_op,
-                                    rect->x, rect->y, rect->w, rect->h,
+                                    x, y, w, h,
                                     rect->mask, rect->mask_x, rect->mask_y);
+}
 
-    eina_mempool_free(_mp_command_rect, rect);
+static void
+_draw_thread_rectangle_free(void *data)
+{
+    eina_mempool_free(_mp_command_rect, data);
 }
 
 static void
 _draw_rectangle_thread_cmd(RGBA_Image *dst, RGBA_Draw_Context *dc, int x, int y, int w, int h)
 {
    Evas_Thread_Command_Rect *cr;
+   Eina_Rectangle area;
 
    RECTS_CLIP_TO_RECT(x, y, w, h, dc->clip.x, dc->clip.y, dc->clip.w, dc->clip.h);
    if ((w <= 0) || (h <= 0)) return;
@@ -699,7 +709,9 @@ _draw_rectangle_thread_cmd(RGBA_Image *dst, RGBA_Draw_Context *dc, int x, int y,
    cr->mask_x = dc->clip.mask_x;
    cr->mask_y = dc->clip.mask_y;
 
-   QCMD(_draw_thread_rectangle_draw, cr);
+   EINA_RECTANGLE_SET(&area, x, y, w, h);
+   QCMD_TILED(_draw_thread_rectangle_draw, _draw_thread_rectangle_free, cr,
+              dst, &area);
 }
 
 static void
@@ -2225,14 +2237,20 @@ eng_image_data_preload_cancel(void *data EINA_UNUSED, void *image, const Eo *tar
 }
 
 static void
-_draw_thread_image_draw(void *data)
+_draw_thread_image_draw(void *data, const Eina_Rectangle *tile)
 {
    Evas_Thread_Command_Image *image = data;
+   int clip_x = image->clip.x, clip_y = image->clip.y;
+   int clip_w = image->clip.w, clip_h = image->clip.h;
+
+   RECTS_CLIP_TO_RECT(clip_x, clip_y, clip_w, clip_h,
+                      tile->x, tile->y, tile->w, tile->h);
+   if ((clip_w <= 0) || (clip_h <= 0)) return;
 
    if (image->smooth)
      evas_common_scale_rgba_smooth_draw
        (image->image, image->surface,
-        image->clip.x, image->clip.y, image->clip.w, image->clip.h,
+        clip_x, clip_y, clip_w, clip_h,
         image->mul_col, image->render_op,
         image->src.x, image->src.y, image->src.w, image->src.h,
         image->dst.x, image->dst.y, image->dst.w, image->dst.h,
@@ -2240,19 +2258,24 @@ _draw_thread_image_draw(void *data)
    else
      evas_common_scale_rgba_sample_draw
        (image->image, image->surface,
-        image->clip.x, image->clip.y, image->clip.w, image->clip.h,
+        clip_x, clip_y, clip_w, clip_h,
         image->mul_col, image->render_op,
         image->src.x, image->src.y, image->src.w, image->src.h,
         image->dst.x, image->dst.y, image->dst.w, image->dst.h,
         image->mask, image->mask_x, image->mask_y);
+}
 
-   eina_mempool_free(_mp_command_image, image);
+static void
+_draw_thread_image_free(void *data)
+{
+   eina_mempool_free(_mp_command_image, data);
 }
 
 static Eina_Bool
 _image_draw_thread_cmd(RGBA_Image *src, RGBA_Image *dst, RGBA_Draw_Context *dc, int src_x, int src_y, int src_w, int src_h, int dst_x, int dst_y, int dst_w, int dst_h, int smooth)
 {
    Evas_Thread_Command_Image *cr;
+   Eina_Rectangle area;
    int clip_x, clip_y, clip_w, clip_h;
 
    if ((dst_w <= 0) || (dst_h <= 0)) return EINA_FALSE;
@@ -2300,7 +2323,14 @@ _image_draw_thread_cmd(RGBA_Image *src, RGBA_Image *dst, RGBA_Draw_Context *dc,
    cr->render_op = dc->render_op;
    cr->smooth = smooth;
 
-   QCMD(_draw_thread_image_draw, cr);
+   area = cr->clip;
+   if (!eina_rectangle_intersection(&area, &cr->dst))
+     {
+        eina_mempool_free(_mp_command_image, cr);
+        return EINA_FALSE;
+     }
+
+   QCMD_TILED(_draw_thread_image_draw, _draw_thread_image_free, cr, dst, &area);
 
    return EINA_TRUE;
 }
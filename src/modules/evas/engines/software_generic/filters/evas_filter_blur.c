@@ -229,6 +229,51 @@ _rect(int x, int y, int w, int h, int maxw, int maxh)
 
 #define RECT(_x, _y, _w, _h) _rect(_x, _y, _w, _h, w, h)
 
+typedef struct _Blur_Band Blur_Band;
+struct _Blur_Band
+{
+   const uint32_t *src;
+   uint32_t *dst;
+   int src_stride, dst_stride;
+   int *radii;
+   Eina_Rectangle region;
+   Eina_Bool vert;
+};
+
+static void
+_box_blur_rgba_band(void *data, unsigned int start, unsigned int end)
+{
+   Blur_Band *b = data;
+   Eina_Rectangle r = b->region;
+
+   // each row (or column) is blurred on its own, so they can be split
+   if (!b->vert)
+     {
+        r.y += start;
+        r.h = end - start;
+        _box_blur_horiz_rgba(b->src, b->src_stride, b->dst, b->dst_stride, b->radii, r);
+     }
+   else
+     {
+        r.x += start;
+        r.w = end - start;
+        _box_blur_vert_rgba(b->src, b->src_stride, b->dst, b->dst_stride, b->radii, r);
+     }
+}
+
+static void
+_box_blur_rgba_parallel(const uint32_t *src, int src_stride,
+                        uint32_t *dst, int dst_stride,
+                        int *radii, Eina_Rectangle region, Eina_Bool vert)
+{
+   Blur_Band b = { src, dst, src_stride, dst_stride, radii, region, vert };
+   int count = vert ? region.w : region.h;
+   int len = vert ? region.h : region.w;
+
+   if ((count <= 0) || (len <= 0)) return;
+   eina_parallel_for(0, count, MAX(1, 16384 / len), _box_blur_rgba_band, &b);
+}
+
 static Eina_Bool
 _box_blur_apply(Evas_Filter_Command *cmd, Eina_Bool vert, Eina_Bool rgba)
 {
@@ -282,10 +327,8 @@ _box_blur_apply(Evas_Filter_Command *cmd, Eina_Bool vert, Eina_Bool rgba)
         XDBG("Box blur in region %d,%d %dx%d", region[k].x, region[k].y, region[k].w, region[k].h);
         if (rgba)
           {
-             if (!vert)
-               _box_blur_horiz_rgba(src, src_stride / 4, dst, dst_stride / 4, radii, region[k]);
-             else
-               _box_blur_vert_rgba(src, src_stride / 4, dst, dst_stride / 4, radii, region[k]);
+             _box_blur_rgba_parallel(src, src_stride / 4, dst, dst_stride / 4,
+                                     radii, region[k], vert);
           }
         else
           {
@@ -385,6 +428,35 @@ _sin_blur_weights_get(int *weights, int *pow2_divider, int radius)
 #define STEP loops
 #include "./blur/blur_gaussian_rgba_.c"
 
+typedef struct _Gaussian_Band Gaussian_Band;
+struct _Gaussian_Band
+{
+   const void *src;
+   void *dst;
+   const int *weights;
+   int radius, w, pow2_div;
+   Eina_Bool rgba;
+};
+
+static void
+_gaussian_blur_horiz_band(void *data, unsigned int start, unsigned int end)
+{
+   Gaussian_Band *g = data;
+   size_t offset = (size_t) start * g->w;
+
+   // the vertical steps use the loop count as stride, only rows are split
+   if (g->rgba)
+     _gaussian_blur_horiz_rgba_step((const DATA32 *) g->src + offset,
+                                    (DATA32 *) g->dst + offset,
+                                    g->radius, g->w, end - start, g->w,
+                                    g->weights, g->pow2_div);
+   else
+     _gaussian_blur_horiz_alpha_step((const DATA8 *) g->src + offset,
+                                     (DATA8 *) g->dst + offset,
+                                     g->radius, g->w, end - start, g->w,
+                                     g->weights, g->pow2_div);
+}
+
 static Eina_Bool
 _gaussian_blur_apply(Evas_Filter_Command *cmd, Eina_Bool vert, Eina_Bool rgba)
 {
@@ -406,20 +478,17 @@ _gaussian_blur_apply(Evas_Filter_Command *cmd, Eina_Bool vert, Eina_Bool rgba)
    if (src && dst)
      {
         DEBUG_TIME_BEGIN();
-        if (rgba)
+        if (!vert)
           {
-             if (!vert)
-               _gaussian_blur_horiz_rgba_step(src, dst, radius, w, h, w, weights, pow2_div);
-             else
-               _gaussian_blur_vert_rgba_step(src, dst, radius, h, w, 1, weights, pow2_div);
+             Gaussian_Band g = { src, dst, weights, radius, w, pow2_div, rgba };
+
+             if ((w > 0) && (h > 0))
+               eina_parallel_for(0, h, MAX(1, 16384 / w), _gaussian_blur_horiz_band, &g);
           }
+        else if (rgba)
+          _gaussian_blur_vert_rgba_step(src, dst, radius, h, w, 1, weights, pow2_div);
         else
-          {
-             if (!vert)
-               _gaussian_blur_horiz_alpha_step(src, dst, radius, w, h, w, weights, pow2_div);
-             else
-               _gaussian_blur_vert_alpha_step(src, dst, radius, h, w, 1, weights, pow2_div);
-          }
+          _gaussian_blur_vert_alpha_step(src, dst, radius, h, w, 1, weights, pow2_div);
         DEBUG_TIME_END();
      }
    else ret = EINA_FALSE;
@@ -468,6 +468,206 @@ EFL_START_TEST(ecore_test_ecore_app)
 }
 EFL_END_TEST
 
+static Eina_Spinlock _thread_lock;
+static int _thread_run = 0;
+static int _thread_ended = 0;
+static int _thread_total = 0;
+
+static void
+_thread_count_cb(void *data EINA_UNUSED, Ecore_Thread *thread EINA_UNUSED)
+{
+   eina_spinlock_take(&_thread_lock);
+   _thread_run++;
+   eina_spinlock_release(&_thread_lock);
+}
+
+static void
+_thread_reschedule_cb(void *data EINA_UNUSED, Ecore_Thread *thread)
+{
+   uintptr_t again = (uintptr_t)ecore_thread_local_data_find(thread, "again");
+
+   eina_spinlock_take(&_thread_lock);
+   _thread_run++;
+   eina_spinlock_release(&_thread_lock);
+
+   if (again < 3)
+     {
+        ecore_thread_local_data_set(thread, "again", (void *)(again + 1), NULL);
+        ecore_thread_reschedule(thread);
+     }
+}
+
+static void
+_thread_end_cb(void *data EINA_UNUSED, Ecore_Thread *thread EINA_UNUSED)
+{
+   if (++_thread_ended == _thread_total) ecore_main_loop_quit();
+}
+
+EFL_START_TEST(ecore_test_ecore_thread_pool)
+{
+   Ecore_Thread_Job jobs[300];
+   Ecore_Thread *threads[300];
+   unsigned int i;
+
+   eina_spinlock_new(&_thread_lock);
+   _thread_run = 0;
+   _thread_ended = 0;
+   _thread_total = 2 * EINA_C_ARRAY_LENGTH(jobs) + 1;
+
+   for (i = 0; i < EINA_C_ARRAY_LENGTH(jobs); i++)
+     fail_if(!ecore_thread_run(_thread_count_cb, _thread_end_cb, NULL, NULL));
+
+   for (i = 0; i < EINA_C_ARRAY_LENGTH(jobs); i++)
+     {
+        jobs[i].func_blocking = _thread_count_cb;
+        jobs[i].func_end = _thread_end_cb;
+        jobs[i].func_cancel = NULL;
+        jobs[i].data = NULL;
+     }
+   ck_assert_int_eq(ecore_thread_run_batch(jobs, EINA_C_ARRAY_LENGTH(jobs), threads),
+                    EINA_C_ARRAY_LENGTH(jobs));
+   for (i = 0; i < EINA_C_ARRAY_LENGTH(jobs); i++)
+     fail_if(!threads[i]);
+
+   fail_if(!ecore_thread_run(_thread_reschedule_cb, _thread_end_cb, NULL, NULL));
+
+   ecore_main_loop_begin();
+
+   ck_assert_int_eq(_thread_ended, _thread_total);
+   // the rescheduled job runs 4 times
+   ck_assert_int_eq(_thread_run, _thread_total + 3);
+   ck_assert_int_eq(ecore_thread_pending_total_get(), 0);
+
+   eina_spinlock_free(&_thread_lock);
+}
+EFL_END_TEST
+
+static Eina_Semaphore _thread_started;
+static Eina_Semaphore _thread_go;
+static char _thread_order[8];
+static int _thread_order_count = 0;
+
+static void
+_thread_block_cb(void *data EINA_UNUSED, Ecore_Thread *thread EINA_UNUSED)
+{
+   eina_semaphore_release(&_thread_started, 1);
+   eina_semaphore_lock(&_thread_go);
+}
+
+static void
+_thread_order_cb(void *data, Ecore_Thread *thread EINA_UNUSED)
+{
+   // only one thread in the pool, no need to lock
+   _thread_order[_thread_order_count++] = *(const char *)data;
+}
+
+static void
+_thread_cancel_cb(void *data, Ecore_Thread *thread)
+{
+   *(Eina_Bool *)data = EINA_TRUE;
+   _thread_end_cb(data, thread);
+}
+
+EFL_START_TEST(ecore_test_ecore_thread_hint)
+{
+   Ecore_Thread *block, *a, *b, *c, *d;
+   Eina_Bool cancelled = EINA_FALSE;
+
+   eina_semaphore_new(&_thread_started, 0);
+   eina_semaphore_new(&_thread_go, 0);
+   _thread_order_count = 0;
+   _thread_ended = 0;
+   _thread_total = 5;
+   ecore_thread_max_set(1);
+
+   // keep the only thread of the pool busy while we queue the others
+   block = ecore_thread_run(_thread_block_cb, _thread_end_cb, NULL, NULL);
+   fail_if(!block);
+   fail_if(!eina_semaphore_lock(&_thread_started));
+   fail_if(ecore_thread_hint_set(block, EINA_THREAD_URGENT, -1));
+
+   a = ecore_thread_run(_thread_order_cb, _thread_end_cb, NULL, "a");
+   b = ecore_thread_run(_thread_order_cb, _thread_end_cb, NULL, "b");
+   c = ecore_thread_run(_thread_order_cb, _thread_end_cb, NULL, "c");
+   d = ecore_thread_run(_thread_order_cb, _thread_end_cb, _thread_cancel_cb, &cancelled);
+   fail_if(!a || !b || !c || !d);
+   ck_assert_int_eq(ecore_thread_pending_get(), 4);
+
+   fail_if(!ecore_thread_hint_set(b, EINA_THREAD_URGENT, -1));
+   fail_if(!ecore_thread_hint_set(c, EINA_THREAD_IDLE, 0));
+   ecore_thread_cancel(d);
+
+   eina_semaphore_release(&_thread_go, 1);
+   ecore_main_loop_begin();
+
+   fail_if(!cancelled);
+   ck_assert_int_eq(_thread_order_count, 3);
+   fail_if(strncmp(_thread_order, "bac", 3));
+
+   ecore_thread_max_reset();
+   eina_semaphore_free(&_thread_started);
+   eina_semaphore_free(&_thread_go);
+}
+EFL_END_TEST
+
+#ifdef EINA_HAVE_PTHREAD_AFFINITY
+static cpu_set_t _thread_affinity;
+
+static void
+_thread_affinity_cb(void *data EINA_UNUSED, Ecore_Thread *thread EINA_UNUSED)
+{
+   pthread_getaffinity_np(pthread_self(), sizeof(_thread_affinity),
+                          &_thread_affinity);
+}
+
+EFL_START_TEST(ecore_test_ecore_thread_affinity)
+{
+   cpu_set_t saved, mask;
+   Ecore_Thread *block, *pinned, *after;
+   int i, first = -1, last = -1;
+
+   fail_if(pthread_getaffinity_np(pthread_self(), sizeof(saved), &saved));
+   for (i = 0; i < CPU_SETSIZE; i++)
+     if (CPU_ISSET(i, &saved))
+       {
+          if (first < 0) first = i;
+          last = i;
+       }
+   // the pool thread inherits a mask that is not every CPU, if we can
+   mask = saved;
+   if (last != first) CPU_CLR(last, &mask);
+   fail_if(pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask));
+
+   eina_semaphore_new(&_thread_started, 0);
+   eina_semaphore_new(&_thread_go, 0);
+   _thread_order_count = 0;
+   _thread_ended = 0;
+   _thread_total = 3;
+   ecore_thread_max_set(1);
+
+   block = ecore_thread_run(_thread_block_cb, _thread_end_cb, NULL, NULL);
+   fail_if(!block);
+   fail_if(!eina_semaphore_lock(&_thread_started));
+
+   pinned = ecore_thread_run(_thread_order_cb, _thread_end_cb, NULL, "p");
+   after = ecore_thread_run(_thread_affinity_cb, _thread_end_cb, NULL, NULL);
+   fail_if(!pinned || !after);
+   fail_if(!ecore_thread_hint_set(pinned, EINA_THREAD_URGENT, first));
+
+   eina_semaphore_release(&_thread_go, 1);
+   ecore_main_loop_begin();
+
+   // once the pinned job is done, the thread gets its own mask back
+   fail_if(!CPU_EQUAL(&_thread_affinity, &mask));
+
+   pthread_setaffinity_np(pthread_self(), sizeof(saved), &saved);
+   ecore_thread_max_reset();
+   eina_semaphore_free(&_thread_started);
+   eina_semaphore_free(&_thread_go);
+}
+EFL_END_TEST
+#endif
+
 void ecore_test_ecore(TCase *tc)
 {
    tcase_add_test(tc, ecore_test_ecore_init);
@@ -481,4 +681,9 @@ void ecore_test_ecore(TCase *tc)
    tcase_add_test(tc, ecore_test_ecore_main_loop_event_recursive);
 #endif
    tcase_add_test(tc, ecore_test_ecore_app);
+   tcase_add_test(tc, ecore_test_ecore_thread_pool);
+   tcase_add_test(tc, ecore_test_ecore_thread_hint);
+#ifdef EINA_HAVE_PTHREAD_AFFINITY
+   tcase_add_test(tc, ecore_test_ecore_thread_affinity);
+#endif
 }
@@ -675,6 +675,196 @@ EFL_START_TEST(ecore_test_ecore_thread_eina_thread_queue_t7)
 }
 EFL_END_TEST
 
+/////////////////////////////////////////////////////////////////////////////
+typedef struct
+{
+   Eina_Thread_Queue_Msg  head;
+   int                    value;
+   int                    check;
+} Msg8;
+
+#define MSG8_NUM 10000
+
+static Eina_Semaphore th8_sem;
+static Eina_Spinlock th8_lock;
+static long long th8_sum;
+static int th8_count;
+
+static void
+th81_do(void *data EINA_UNUSED, Ecore_Thread *th EINA_UNUSED)
+{
+   int i;
+
+   // one message at a time
+   for (i = 1; i <= MSG8_NUM; i++)
+     {
+        Msg8 *msg;
+        void *ref;
+
+        msg = eina_thread_queue_send(thq1, sizeof(Msg8), &ref);
+        if (!msg) fail();
+        msg->value = i;
+        msg->check = ~i;
+        eina_thread_queue_send_done(thq1, ref);
+     }
+   eina_semaphore_release(&th8_sem, 1);
+}
+
+static void
+th82_do(void *data EINA_UNUSED, Ecore_Thread *th EINA_UNUSED)
+{
+   Msg8 msgs[7];
+   int i, j, n;
+
+   // odd sized batches, bigger and smaller than the free room in the ring
+   for (i = 1; i <= MSG8_NUM; i += n)
+     {
+        n = MIN(MSG8_NUM + 1 - i, (int)EINA_C_ARRAY_LENGTH(msgs));
+        for (j = 0; j < n; j++)
+          {
+             msgs[j].value = i + j;
+             msgs[j].check = ~(i + j);
+          }
+        fail_if(eina_thread_queue_send_batch(thq1, msgs, sizeof(Msg8), n) != n);
+     }
+   eina_semaphore_release(&th8_sem, 1);
+}
+
+static void
+th83_do(void *data EINA_UNUSED, Ecore_Thread *th EINA_UNUSED)
+{
+   Msg8 msgs[5];
+   long long sum = 0;
+   int i, n, count = 0, exits = 0;
+
+   while (!exits)
+     {
+        n = eina_thread_queue_wait_batch(thq1, msgs, sizeof(Msg8),
+                                         EINA_C_ARRAY_LENGTH(msgs));
+        fail_if(n < 1);
+        for (i = 0; i < n; i++)
+          {
+             if (msgs[i].value == EXIT_MESSAGE)
+               {
+                  exits++;
+                  continue;
+               }
+             fail_if(msgs[i].check != ~msgs[i].value);
+             sum += msgs[i].value;
+             count++;
+          }
+     }
+   // a batch can hold the exit message of the other reader, give it back
+   for (i = 1; i < exits; i++)
+     {
+        msgs[0].value = EXIT_MESSAGE;
+        fail_if(eina_thread_queue_send_batch(thq1, msgs, sizeof(Msg8), 1) != 1);
+     }
+   eina_spinlock_take(&th8_lock);
+   th8_sum += sum;
+   th8_count += count;
+   eina_spinlock_release(&th8_lock);
+   eina_semaphore_release(&th8_sem, 1);
+}
+
+static void
+_thread_queue_t8(Eina_Thread_Queue *thq)
+{
+   Ecore_Thread *eth[5];
+   Msg8 msgs[2];
+   long long expect;
+   int i;
+
+   eina_semaphore_new(&th8_sem, 0);
+   eina_spinlock_new(&th8_lock);
+   th8_sum = 0;
+   th8_count = 0;
+   thq1 = thq;
+   fail_if(!thq1);
+
+   eth[0] = ecore_thread_feedback_run(th81_do, NULL, NULL, NULL, NULL, EINA_TRUE);
+   eth[1] = ecore_thread_feedback_run(th81_do, NULL, NULL, NULL, NULL, EINA_TRUE);
+   eth[2] = ecore_thread_feedback_run(th82_do, NULL, NULL, NULL, NULL, EINA_TRUE);
+   eth[3] = ecore_thread_feedback_run(th83_do, NULL, NULL, NULL, NULL, EINA_TRUE);
+   eth[4] = ecore_thread_feedback_run(th83_do, NULL, NULL, NULL, NULL, EINA_TRUE);
+
+   // wait for the 3 writers, then tell each reader to stop
+   for (i = 0; i < 3; i++)
+     fail_if(!eina_semaphore_lock(&th8_sem));
+   msgs[0].value = msgs[1].value = EXIT_MESSAGE;
+   fail_if(eina_thread_queue_send_batch(thq1, msgs, sizeof(Msg8), 2) != 2);
+   for (i = 0; i < 2; i++)
+     fail_if(!eina_semaphore_lock(&th8_sem));
+
+   expect = (long long)MSG8_NUM * (MSG8_NUM + 1) / 2;
+   ck_assert_int_eq(th8_count, 3 * MSG8_NUM);
+   ck_assert(th8_sum == 3 * expect);
+   ck_assert_int_eq(eina_thread_queue_pending_get(thq1), 0);
+   fail_if(eina_thread_queue_poll_batch(thq1, msgs, sizeof(Msg8), 2) != 0);
+
+   for (i = 0; i < 5; i++)
+     ecore_thread_wait(eth[i], 0.1);
+   eina_thread_queue_free(thq1);
+   eina_spinlock_free(&th8_lock);
+   eina_semaphore_free(&th8_sem);
+}
+
+EFL_START_TEST(ecore_test_ecore_thread_eina_thread_queue_t8)
+{
+   // a small ring so writers have to wait for room
+   _thread_queue_t8(eina_thread_queue_ring_new(16, sizeof(Msg8)));
+}
+EFL_END_TEST
+
+EFL_START_TEST(ecore_test_ecore_thread_eina_thread_queue_t9)
+{
+   _thread_queue_t8(eina_thread_queue_new());
+}
+EFL_END_TEST
+
+EFL_START_TEST(ecore_test_ecore_thread_eina_thread_queue_t10)
+{
+   Eina_Thread_Queue *thq;
+   Msg8 msgs[40], *msg;
+   char buf[64];
+   void *ref;
+   int i;
+
+   thq = eina_thread_queue_ring_new(30, sizeof(Msg8));
+   fail_if(!thq);
+   if (pipe(p) != 0)
+     {
+        ck_abort_msg("ERR: pipe create fail\n");
+     }
+   eina_thread_queue_fd_set(thq, p[1]);
+
+   // too big for a cell
+   fail_if(eina_thread_queue_send(thq, sizeof(Msg8) + 64, &ref) != NULL);
+
+   // 30 is rounded up to 32 messages
+   for (i = 0; i < 32; i++)
+     msgs[i].value = i;
+   ck_assert_int_eq(eina_thread_queue_send_batch(thq, msgs, sizeof(Msg8), 32), 32);
+   ck_assert_int_eq(eina_thread_queue_pending_get(thq), 32);
+   ck_assert_int_eq(read(p[0], buf, sizeof(buf)), 32);
+
+   msg = eina_thread_queue_poll(thq, &ref);
+   fail_if(!msg);
+   ck_assert_int_eq(msg->value, 0);
+   eina_thread_queue_wait_done(thq, ref);
+
+   memset(msgs, 0, sizeof(msgs));
+   ck_assert_int_eq(eina_thread_queue_poll_batch(thq, msgs, sizeof(Msg8), 40), 31);
+   for (i = 0; i < 31; i++)
+     ck_assert_int_eq(msgs[i].value, i + 1);
+   fail_if(eina_thread_queue_poll(thq, &ref) != NULL);
+
+   eina_thread_queue_free(thq);
+   close(p[0]);
+   close(p[1]);
+}
+EFL_END_TEST
+
 void ecore_test_ecore_thread_eina_thread_queue(TCase *tc EINA_UNUSED)
 {
    tcase_add_test(tc, ecore_test_ecore_thread_eina_thread_queue_t1);
@@ -688,4 +878,7 @@ void ecore_test_ecore_thread_eina_thread_queue2(TCase *tc EINA_UNUSED)
    tcase_add_test(tc, ecore_test_ecore_thread_eina_thread_queue_t5);
    tcase_add_test(tc, ecore_test_ecore_thread_eina_thread_queue_t6);
    tcase_add_test(tc, ecore_test_ecore_thread_eina_thread_queue_t7);
+   tcase_add_test(tc, ecore_test_ecore_thread_eina_thread_queue_t8);
+   tcase_add_test(tc, ecore_test_ecore_thread_eina_thread_queue_t9);
+   tcase_add_test(tc, ecore_test_ecore_thread_eina_thread_queue_t10);
 }
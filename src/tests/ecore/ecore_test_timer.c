@@ -5,6 +5,7 @@
 #include <Ecore.h>
 
 #include <math.h>
+#include <unistd.h>
 
 #include "ecore_suite.h"
 
@@ -288,6 +289,106 @@ EFL_START_TEST(ecore_test_timer_in_order)
 }
 EFL_END_TEST
 
+static int _order[8];
+static int _order_count = 0;
+
+static Eina_Bool
+_timer_order_cb(void *data)
+{
+   _order[_order_count++] = (intptr_t) data;
+   if (_order_count == 8) ecore_main_loop_quit();
+   return ECORE_CALLBACK_CANCEL;
+}
+
+EFL_START_TEST(ecore_test_timer_equal_deadline_order)
+{
+   static const int expected[8] = { 3, 8, 7, 6, 5, 4, 2, 1 };
+   Ecore_Timer *timers[8];
+   intptr_t i;
+
+   _order_count = 0;
+   for (i = 0; i < 8; i++)
+     {
+        timers[i] = ecore_timer_loop_add(0.01, _timer_order_cb, (void *) (i + 1));
+        fail_if(timers[i] == NULL);
+     }
+   /* the loop time does not move in between, so they all expire at once */
+   for (i = 0; i < 8; i++)
+     ecore_timer_loop_reset(timers[i]);
+   /* same expiry, queued again */
+   ecore_timer_loop_reset(timers[2]);
+
+   ecore_main_loop_begin();
+
+   /* the last one queued goes before the ones expiring at the same time */
+   for (i = 0; i < 8; i++)
+     ck_assert_int_eq(_order[i], expected[i]);
+}
+EFL_END_TEST
+
+static Ecore_Timer *_dispatch_timers[5];
+static int _dispatch_calls[5];
+
+static Eina_Bool
+_dispatch_first_cb(void *data EINA_UNUSED)
+{
+   _dispatch_calls[0]++;
+   /* the timers behind us in the same walk */
+   ecore_timer_del(_dispatch_timers[1]);
+   _dispatch_timers[1] = NULL;
+   ecore_timer_freeze(_dispatch_timers[2]);
+   ecore_timer_delay(_dispatch_timers[3], 10.0);
+   /* and ourself, while inside the call */
+   ecore_timer_del(_dispatch_timers[0]);
+   _dispatch_timers[0] = NULL;
+   return ECORE_CALLBACK_RENEW;
+}
+
+static Eina_Bool
+_dispatch_cb(void *data)
+{
+   _dispatch_calls[(intptr_t) data]++;
+   return ECORE_CALLBACK_RENEW;
+}
+
+static Eina_Bool
+_dispatch_last_cb(void *data EINA_UNUSED)
+{
+   _dispatch_calls[4]++;
+   ecore_main_loop_quit();
+   return ECORE_CALLBACK_CANCEL;
+}
+
+EFL_START_TEST(ecore_test_timer_change_in_dispatch)
+{
+   intptr_t i;
+
+   memset(_dispatch_calls, 0, sizeof (_dispatch_calls));
+   _dispatch_timers[0] = ecore_timer_loop_add(0.001, _dispatch_first_cb, NULL);
+   for (i = 1; i < 4; i++)
+     _dispatch_timers[i] = ecore_timer_loop_add(0.001 + 0.001 * i, _dispatch_cb, (void *) i);
+   _dispatch_timers[4] = ecore_timer_loop_add(0.2, _dispatch_last_cb, NULL);
+   for (i = 0; i < 5; i++)
+     fail_if(_dispatch_timers[i] == NULL);
+
+   /* let the first four expire so that one walk goes through them */
+   usleep(50000);
+   ecore_main_loop_begin();
+
+   ck_assert_int_eq(_dispatch_calls[0], 1);
+   ck_assert_int_eq(_dispatch_calls[1], 0);
+   ck_assert_int_eq(_dispatch_calls[2], 0);
+   ck_assert_int_eq(_dispatch_calls[3], 0);
+   ck_assert_int_eq(_dispatch_calls[4], 1);
+
+   fail_if(!ecore_timer_freeze_get(_dispatch_timers[2]));
+   fail_if(ecore_timer_pending_get(_dispatch_timers[3]) < 9.0);
+
+   ecore_timer_del(_dispatch_timers[2]);
+   ecore_timer_del(_dispatch_timers[3]);
+}
+EFL_END_TEST
+
 void ecore_test_timer(TCase *tc)
 {
   tcase_add_test(tc, ecore_test_timers);
@@ -295,4 +396,6 @@ void ecore_test_timer(TCase *tc)
   tcase_add_test(tc, ecore_test_timer_valid_callbackfunc);
   tcase_add_test(tc, ecore_test_ecore_main_loop_timer);
   tcase_add_test(tc, ecore_test_timer_in_order);
+  tcase_add_test(tc, ecore_test_timer_equal_deadline_order);
+  tcase_add_test(tc, ecore_test_timer_change_in_dispatch);
 }
@@ -65,6 +65,7 @@ static const Efl_Test_Case etc[] = {
    { "ustr", eina_test_ustr },
    { "QuadTree", eina_test_quadtree },
    { "Sched", eina_test_sched },
+   { "Parallel", eina_test_parallel },
    { "Simple Xml Parser", eina_test_simple_xml_parser},
    { "Value", eina_test_value },
    { "COW", eina_test_cow },
@@ -85,6 +86,7 @@ static const Efl_Test_Case etc[] = {
    { "SafePointer", eina_test_safepointer },
    { "Slice", eina_test_slice },
    { "Free Queue", eina_test_freeq },
+   { "Evlog", eina_test_evlog },
    { "Util", eina_test_util },
    { "slstr", eina_test_slstr },
    { "Vpath", eina_test_vpath },
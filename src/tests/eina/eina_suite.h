@@ -54,6 +54,7 @@ void eina_test_ustr(TCase *tc);
 void eina_test_quadtree(TCase *tc);
 void eina_test_fp(TCase *tc);
 void eina_test_sched(TCase *tc);
+void eina_test_parallel(TCase *tc);
 void eina_test_simple_xml_parser(TCase *tc);
 void eina_test_value(TCase *tc);
 void eina_test_model(TCase *tc);
@@ -74,6 +75,7 @@ void eina_test_bezier(TCase *tc);
 void eina_test_safepointer(TCase *tc);
 void eina_test_slice(TCase *tc);
 void eina_test_freeq(TCase *tc);
+void eina_test_evlog(TCase *tc);
 void eina_test_slstr(TCase *tc);
 void eina_test_vpath(TCase *tc);
 void eina_test_debug(TCase *tc);
@@ -0,0 +1,192 @@
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <locale.h>
+
+#include <Eina.h>
+
+#include "eina_suite.h"
+
+/* "ts":<digits>.<3 digits>, whatever the locale says */
+static Eina_Bool
+_ts_check(const char *line, unsigned long long *us)
+{
+   const char *p = strstr(line, "\"ts\":");
+   char *end;
+
+   if (!p) return EINA_FALSE;
+   p += 5;
+   if ((*p < '0') || (*p > '9')) return EINA_FALSE;
+   *us = strtoull(p, &end, 10);
+   if (*end != '.') return EINA_FALSE;
+   if (strspn(end + 1, "0123456789") != 3) return EINA_FALSE;
+   end += 4;
+   return (*end == ',') || (*end == '}');
+}
+
+EFL_START_TEST(eina_test_evlog_file)
+{
+   char pid[32], line[4096];
+   unsigned long long ts, last_ts = 0;
+   unsigned int begins = 0, ends = 0, marks = 0;
+   Eina_Tmpstr *path;
+   FILE *f;
+   int fd;
+
+   fd = eina_file_mkstemp("eina_evlog_XXXXXX.json", &path);
+   fail_if(fd < 0);
+   close(fd);
+
+   /* a decimal comma must not end up in the file */
+   setlocale(LC_NUMERIC, "de_DE.UTF-8");
+
+   ck_assert_int_eq(eina_shutdown(), 0);
+   setenv("EINA_EVLOG_FILE", path, 1);
+   ck_assert_int_eq(eina_init(), 1);
+   unsetenv("EINA_EVLOG_FILE");
+
+   eina_evlog("+evlog_test", NULL, 0.0, "with \"quotes\"");
+   eina_evlog("!evlog_mark", NULL, 0.0, NULL);
+   eina_evlog("-evlog_test", NULL, 0.0, NULL);
+
+   /* closes the file */
+   ck_assert_int_eq(eina_shutdown(), 0);
+   ck_assert_int_eq(eina_init(), 1);
+   setlocale(LC_NUMERIC, "C");
+
+   snprintf(pid, sizeof(pid), "\"pid\":%i,", (int)getpid());
+
+   f = fopen(path, "r");
+   fail_if(!f);
+   fail_if(!fgets(line, sizeof(line), f));
+   ck_assert_str_eq(line, "[\n");
+   while (fgets(line, sizeof(line), f))
+     {
+        if (!strcmp(line, "]\n")) break;
+        fail_if(line[0] != '{');
+        fail_if(!strstr(line, pid));
+        if (!strstr(line, "\"ph\":\"M\""))
+          {
+             fail_if(!_ts_check(line, &ts));
+             fail_if(ts < last_ts);
+             last_ts = ts;
+          }
+        if (strstr(line, "\"name\":\"evlog_test\""))
+          {
+             if (strstr(line, "\"ph\":\"B\""))
+               {
+                  begins++;
+                  fail_if(!strstr(line, "\"args\":{\"detail\":\"with \\\"quotes\\\"\"}"));
+               }
+             else if (strstr(line, "\"ph\":\"E\"")) ends++;
+          }
+        if (strstr(line, "\"name\":\"evlog_mark\"") &&
+            strstr(line, "\"ph\":\"i\""))
+          marks++;
+     }
+   fail_if(strcmp(line, "]\n"));
+   fclose(f);
+
+   ck_assert_int_eq(begins, 1);
+   ck_assert_int_eq(ends, 1);
+   ck_assert_int_eq(marks, 1);
+
+   unlink(path);
+   eina_tmpstr_del(path);
+}
+EFL_END_TEST
+
+static int _sample_calls = 0;
+
+static const char *
+_sample_cb(void *data)
+{
+   ck_assert_ptr_eq(data, &_sample_calls);
+   __atomic_add_fetch(&_sample_calls, 1, __ATOMIC_RELAXED);
+   return "evlog_sample_op";
+}
+
+static unsigned int
+_tid_get(const char *line)
+{
+   const char *p = strstr(line, "\"tid\":");
+
+   if (!p) return 0;
+   return strtoul(p + 6, NULL, 10);
+}
+
+EFL_START_TEST(eina_test_evlog_file_sample)
+{
+   char line[4096];
+   unsigned int main_tid = 0, samples = 0, sample_tid = 0, i;
+   Eina_Tmpstr *path;
+   FILE *f;
+   int fd;
+
+   /* there is nothing to sample without the file */
+   ck_assert_int_eq(eina_evlog_sample_cb_set(_sample_cb, &_sample_calls), EINA_FALSE);
+
+   fd = eina_file_mkstemp("eina_evlog_XXXXXX.json", &path);
+   fail_if(fd < 0);
+   close(fd);
+
+   ck_assert_int_eq(eina_shutdown(), 0);
+   setenv("EINA_EVLOG_FILE", path, 1);
+   setenv("EINA_EVLOG_SAMPLE", "1000", 1);
+   ck_assert_int_eq(eina_init(), 1);
+   unsetenv("EINA_EVLOG_FILE");
+   unsetenv("EINA_EVLOG_SAMPLE");
+
+   ck_assert_int_eq(eina_evlog_sample_cb_set(_sample_cb, &_sample_calls), EINA_TRUE);
+   for (i = 0; (i < 1000) && (__atomic_load_n(&_sample_calls, __ATOMIC_RELAXED) < 5); i++)
+     usleep(1000);
+   ck_assert_int_ge(__atomic_load_n(&_sample_calls, __ATOMIC_RELAXED), 5);
+   ck_assert_int_eq(eina_evlog_sample_cb_set(NULL, NULL), EINA_TRUE);
+
+   ck_assert_int_eq(eina_shutdown(), 0);
+   ck_assert_int_eq(eina_init(), 1);
+
+   f = fopen(path, "r");
+   fail_if(!f);
+   while (fgets(line, sizeof(line), f))
+     {
+        if (strstr(line, "\"name\":\"thread_name\"") &&
+            strstr(line, "\"args\":{\"name\":\"main loop "))
+          {
+             /* a single main loop */
+             fail_if(main_tid);
+             main_tid = _tid_get(line);
+          }
+        if (strstr(line, "\"cat\":\"sample\""))
+          {
+             fail_if(!strstr(line, "\"ph\":\"X\""));
+             fail_if(!strstr(line, "\"name\":\"evlog_sample_op\""));
+             fail_if(!strstr(line, "\"dur\":1000}"));
+             if (!samples) sample_tid = _tid_get(line);
+             else ck_assert_int_eq(_tid_get(line), sample_tid);
+             samples++;
+          }
+     }
+   fclose(f);
+
+   /* the samples show up on the main loop, not on the writer thread */
+   fail_if(!main_tid);
+   ck_assert_int_ge(samples, 5);
+   ck_assert_int_eq(sample_tid, main_tid);
+
+   unlink(path);
+   eina_tmpstr_del(path);
+}
+EFL_END_TEST
+
+void
+eina_test_evlog(TCase *tc)
+{
+   tcase_add_test(tc, eina_test_evlog_file);
+   tcase_add_test(tc, eina_test_evlog_file_sample);
+}
@@ -70,6 +70,42 @@ EFL_START_TEST(freeq_tune)
 }
 EFL_END_TEST
 
+EFL_START_TEST(freeq_ptrs)
+{
+   Eina_FreeQ *fq;
+   void *ptrs[1000];
+   unsigned int i;
+
+   fq = eina_freeq_new(EINA_FREEQ_DEFAULT);
+   fail_if(!fq);
+   eina_freeq_count_max_set(fq, 2000);
+
+   for (i = 0; i < EINA_C_ARRAY_LENGTH(ptrs); i++)
+     {
+        ptrs[i] = malloc(9);
+        _n++;
+     }
+   // holes are skipped
+   free(ptrs[10]);
+   ptrs[10] = NULL;
+   _n--;
+
+   eina_freeq_ptrs_add(fq, ptrs, EINA_C_ARRAY_LENGTH(ptrs), freefn, 9);
+   ck_assert_int_eq(_n, EINA_C_ARRAY_LENGTH(ptrs) - 1);
+   fail_if(!eina_freeq_ptr_pending(fq));
+
+   // the limits still apply once the array is queued
+   eina_freeq_count_max_set(fq, 100);
+   ck_assert_int_le(_n, 100);
+
+   eina_freeq_clear(fq);
+   ck_assert_int_eq(_n, 0);
+   fail_if(eina_freeq_ptr_pending(fq));
+
+   eina_freeq_free(fq);
+}
+EFL_END_TEST
+
 EFL_START_TEST(freeq_reduce)
 {
    void *p;
@@ -191,5 +227,6 @@ eina_test_freeq(TCase *tc)
    tcase_add_test(tc, freeq_simple);
    tcase_add_test(tc, freeq_tune);
    tcase_add_test(tc, freeq_reduce);
+   tcase_add_test(tc, freeq_ptrs);
    tcase_add_test(tc, freeq_postponed);
 }
@@ -420,6 +420,127 @@ EFL_START_TEST(eina_test_hash_add_del_by_hash)
 }
 EFL_END_TEST
 
+EFL_START_TEST(eina_test_hash_flat_simple)
+{
+   Eina_Hash *hash = NULL;
+   int *test;
+   int array[] = { 1, 42, 4, 5, 6 };
+
+   hash = eina_hash_flat_string_new(NULL);
+   fail_if(hash == NULL);
+
+   fail_if(eina_hash_add(hash, "1", &array[0]) != EINA_TRUE);
+   fail_if(eina_hash_add(hash, "42", &array[1]) != EINA_TRUE);
+   fail_if(eina_hash_direct_add(hash, "4", &array[2]) != EINA_TRUE);
+   fail_if(eina_hash_direct_add(hash, "5", &array[3]) != EINA_TRUE);
+   fail_if(eina_hash_add(hash, "", "") != EINA_TRUE);
+   fail_if(eina_hash_add(hash, "000000000042", &array[1]) != EINA_TRUE);
+
+   test = eina_hash_find(hash, "4");
+   fail_if(!test);
+   fail_if(*test != 4);
+
+   test = eina_hash_find(hash, "42");
+   fail_if(!test);
+   fail_if(*test != 42);
+
+   eina_hash_foreach(hash, eina_foreach_check, NULL);
+
+   test = eina_hash_modify(hash, "5", &array[4]);
+   fail_if(!test);
+   fail_if(*test != 5);
+
+   test = eina_hash_find(hash, "5");
+   fail_if(!test);
+   fail_if(*test != 6);
+
+   fail_if(eina_hash_population(hash) != 6);
+
+   fail_if(eina_hash_find(hash, "120") != NULL);
+   fail_if(eina_hash_find(hash, "000000000042") != &array[1]);
+
+   fail_if(eina_hash_del(hash, "5", NULL) != EINA_TRUE);
+   fail_if(eina_hash_find(hash, "5") != NULL);
+
+   fail_if(eina_hash_del(hash, NULL, &array[2]) != EINA_TRUE);
+   fail_if(eina_hash_find(hash, "4") != NULL);
+
+   fail_if(eina_hash_del(hash, NULL, &array[2]) != EINA_FALSE);
+
+   fail_if(eina_hash_set(hash, "1", NULL) != &array[0]);
+   fail_if(eina_hash_find(hash, "1") != NULL);
+   fail_if(eina_hash_del(hash, "42", NULL) != EINA_TRUE);
+   fail_if(eina_hash_population(hash) != 2);
+
+   eina_hash_free(hash);
+}
+EFL_END_TEST
+
+EFL_START_TEST(eina_test_hash_flat_int32_fuzze)
+{
+   Eina_Hash *hash;
+   Eina_Iterator *it;
+   unsigned int *array, *r;
+   unsigned int i, count;
+   unsigned int num_loops = 10000;
+
+   srand(time(NULL));
+
+   hash = eina_hash_flat_int32_new(NULL);
+   fail_if(hash == NULL);
+
+   array = malloc(sizeof(int) * num_loops);
+   ck_assert_ptr_ne(array, NULL);
+   for (i = 0; i < num_loops; ++i)
+     {
+        /* Unique keys, in a random order. */
+        array[i] = (i * 7919) % num_loops;
+        ck_assert_int_ne(eina_hash_add(hash, &array[i], &array[i]), 0);
+     }
+   ck_assert_int_eq(eina_hash_population(hash), num_loops);
+
+   /* Remove every other key, then re-add half of them to reuse tombstones. */
+   for (i = 0; i < num_loops; i += 2)
+     ck_assert_int_ne(eina_hash_del(hash, &array[i], NULL), 0);
+   for (i = 0; i < num_loops; i += 4)
+     ck_assert_int_ne(eina_hash_add(hash, &array[i], &array[i]), 0);
+
+   for (i = 0; i < num_loops; ++i)
+     {
+        r = eina_hash_find(hash, &array[i]);
+        if ((i % 2) && (i % 4))
+          ck_assert_ptr_eq(r, &array[i]);
+        else if (i % 4)
+          ck_assert_ptr_eq(r, NULL);
+        else
+          ck_assert_ptr_eq(r, &array[i]);
+     }
+
+   for (i = 0; i < num_loops / 2; ++i)
+     {
+        unsigned int tr = num_loops + rand();
+        ck_assert_ptr_eq(eina_hash_find(hash, &tr), NULL);
+     }
+
+   count = 0;
+   it = eina_hash_iterator_data_new(hash);
+   EINA_ITERATOR_FOREACH(it, r)
+     {
+        ck_assert_ptr_eq(eina_hash_find(hash, r), r);
+        count++;
+     }
+   eina_iterator_free(it);
+   ck_assert_int_eq(count, eina_hash_population(hash));
+
+   eina_hash_free_buckets(hash);
+   ck_assert_int_eq(eina_hash_population(hash), 0);
+   ck_assert_ptr_eq(eina_hash_find(hash, &array[0]), NULL);
+
+   eina_hash_free(hash);
+   free(array);
+}
+EFL_END_TEST
+
 void
 eina_test_hash(TCase *tc)
 {
@@ -433,5 +554,7 @@ eina_test_hash(TCase *tc)
    tcase_add_test(tc, eina_test_hash_int64_fuzze);
    tcase_add_test(tc, eina_test_hash_string_fuzze);
    tcase_add_test(tc, eina_test_hash_add_del_by_hash);
+   tcase_add_test(tc, eina_test_hash_flat_simple);
+   tcase_add_test(tc, eina_test_hash_flat_int32_fuzze);
 }
 
@@ -75,6 +75,51 @@ EFL_START_TEST(eina_mempool_chained_mempool)
    _eina_mempool_test(mp, EINA_FALSE, EINA_FALSE, EINA_TRUE);
 }
 EFL_END_TEST
+
+static void *
+_eina_mempool_magazine_thread(void *data, Eina_Thread t EINA_UNUSED)
+{
+   Eina_Mempool *mp = data;
+   int *tbl[300];
+   int i, j;
+
+   for (j = 0; j < 100; j++)
+     {
+        for (i = 0; i < 300; i++)
+          {
+             tbl[i] = eina_mempool_malloc(mp, sizeof (int));
+             if (!tbl[i]) return (void *)(uintptr_t)1;
+             *tbl[i] = i;
+          }
+        for (i = 0; i < 300; i++)
+          {
+             if (*tbl[i] != i) return (void *)(uintptr_t)1;
+             eina_mempool_free(mp, tbl[i]);
+          }
+     }
+
+   return NULL;
+}
+
+EFL_START_TEST(eina_mempool_chained_mempool_magazine)
+{
+   Eina_Mempool *mp;
+   Eina_Thread t[4];
+   int i;
+
+   mp = eina_mempool_add("chained_mempool", "test", "magazine", sizeof (int), 256);
+   _eina_mempool_test(mp, EINA_FALSE, EINA_FALSE, EINA_TRUE);
+
+   mp = eina_mempool_add("chained_mempool", "test", "magazine", sizeof (int), 256);
+   fail_if(!mp);
+   for (i = 0; i < 4; i++)
+     fail_if(!eina_thread_create(&t[i], EINA_THREAD_NORMAL, -1,
+                                 _eina_mempool_magazine_thread, mp));
+   for (i = 0; i < 4; i++)
+     fail_if(eina_thread_join(t[i]) != NULL);
+   eina_mempool_del(mp);
+}
+EFL_END_TEST
 #endif
 
 #ifdef EINA_BUILD_PASS_THROUGH
@@ -88,13 +133,60 @@ EFL_START_TEST(eina_mempool_pass_through)
 EFL_END_TEST
 #endif
 
+#ifdef EINA_BUILD_ARENA
+EFL_START_TEST(eina_mempool_arena)
+{
+   Eina_Mempool *mp;
+   char *first, *ptr;
+   int i;
+
+   mp = eina_mempool_add("arena", "test", NULL, sizeof (int), 256);
+   _eina_mempool_test(mp, EINA_FALSE, EINA_TRUE, EINA_FALSE);
+
+   mp = eina_mempool_add("arena", "test", NULL, sizeof (int), 256);
+   fail_if(!mp);
+
+   first = eina_mempool_malloc(mp, 3);
+   fail_if(!first);
+   fail_if(!eina_mempool_from(mp, first));
+
+   // the last allocation can grow in place and be given back
+   ptr = eina_mempool_malloc(mp, sizeof (double));
+   fail_if(((uintptr_t)ptr) % sizeof (double));
+   fail_if(eina_mempool_realloc(mp, ptr, 4 * sizeof (double)) != ptr);
+   eina_mempool_free(mp, ptr);
+   fail_if(eina_mempool_malloc(mp, sizeof (double)) != ptr);
+
+   // bigger than a chunk
+   ptr = eina_mempool_malloc(mp, 1024 * 1024);
+   fail_if(!ptr);
+   memset(ptr, 0xAA, 1024 * 1024);
+
+   for (i = 0; i < 4096; i++)
+     fail_if(!eina_mempool_malloc(mp, 24));
+
+   eina_mempool_reset(mp);
+   fail_if(eina_mempool_from(mp, first));
+   fail_if(eina_mempool_malloc(mp, 3) != first);
+   eina_mempool_gc(mp);
+   fail_if(!eina_mempool_from(mp, first));
+
+   eina_mempool_del(mp);
+}
+EFL_END_TEST
+#endif
+
 void
 eina_test_mempool(TCase *tc)
 {
 #ifdef EINA_BUILD_CHAINED_POOL
    tcase_add_test(tc, eina_mempool_chained_mempool);
+   tcase_add_test(tc, eina_mempool_chained_mempool_magazine);
 #endif
 #ifdef EINA_BUILD_PASS_THROUGH
    tcase_add_test(tc, eina_mempool_pass_through);
 #endif
+#ifdef EINA_BUILD_ARENA
+   tcase_add_test(tc, eina_mempool_arena);
+#endif
 }
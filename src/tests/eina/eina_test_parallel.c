@@ -0,0 +1,157 @@
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif
+
+#include <Eina.h>
+
+#include "eina_suite.h"
+
+#define COUNT 100000
+
+typedef struct _Parallel_Test Parallel_Test;
+struct _Parallel_Test
+{
+   unsigned char seen[COUNT];
+   Eina_Spinlock lock;
+   unsigned int calls;
+};
+
+static void
+_parallel_mark(void *data, unsigned int start, unsigned int end)
+{
+   Parallel_Test *t = data;
+   unsigned int i;
+
+   for (i = start; i < end; i++)
+     t->seen[i]++;
+
+   eina_spinlock_take(&t->lock);
+   t->calls++;
+   eina_spinlock_release(&t->lock);
+}
+
+EFL_START_TEST(eina_test_parallel_for)
+{
+   Parallel_Test *t;
+   unsigned int i;
+
+   t = calloc(1, sizeof (Parallel_Test));
+   fail_if(!t);
+   eina_spinlock_new(&t->lock);
+
+   eina_parallel_for(0, COUNT, 100, _parallel_mark, t);
+   for (i = 0; i < COUNT; i++)
+     ck_assert_int_eq(t->seen[i], 1);
+   // inline when there is no worker, one call per chunk otherwise
+   fail_if((t->calls != 1) && (t->calls != COUNT / 100));
+
+   // an odd range with an automatic grain
+   memset(t->seen, 0, sizeof (t->seen));
+   eina_parallel_for(17, COUNT - 3, 0, _parallel_mark, t);
+   for (i = 0; i < COUNT; i++)
+     ck_assert_int_eq(t->seen[i], ((i >= 17) && (i < COUNT - 3)) ? 1 : 0);
+
+   // nothing to do
+   t->calls = 0;
+   eina_parallel_for(10, 10, 0, _parallel_mark, t);
+   ck_assert_int_eq(t->calls, 0);
+
+   eina_spinlock_free(&t->lock);
+   free(t);
+}
+EFL_END_TEST
+
+static void
+_parallel_inner(void *data, unsigned int start, unsigned int end)
+{
+   unsigned char *row = data;
+   unsigned int i;
+
+   for (i = start; i < end; i++)
+     row[i]++;
+}
+
+static void
+_parallel_outer(void *data, unsigned int start, unsigned int end)
+{
+   unsigned char *seen = data;
+   unsigned int i;
+
+   for (i = start; i < end; i++)
+     eina_parallel_for(0, 1000, 10, _parallel_inner, seen + i * 1000);
+}
+
+EFL_START_TEST(eina_test_parallel_nested)
+{
+   unsigned char *seen;
+   unsigned int i;
+
+   seen = calloc(1, COUNT);
+   fail_if(!seen);
+
+   eina_parallel_for(0, COUNT / 1000, 1, _parallel_outer, seen);
+   for (i = 0; i < COUNT; i++)
+     ck_assert_int_eq(seen[i], 1);
+
+   free(seen);
+}
+EFL_END_TEST
+
+typedef struct _Parallel_Sum Parallel_Sum;
+struct _Parallel_Sum
+{
+   unsigned long long sum;
+   unsigned int count;
+};
+
+static void
+_parallel_sum(void *data EINA_UNUSED, unsigned int start, unsigned int end, void *result)
+{
+   Parallel_Sum *r = result;
+   unsigned int i;
+
+   for (i = start; i < end; i++)
+     r->sum += i;
+   r->count += end - start;
+}
+
+static void
+_parallel_join(void *data, void *result, const void *other)
+{
+   Parallel_Sum *r = result;
+   const Parallel_Sum *o = other;
+   unsigned int *joins = data;
+
+   r->sum += o->sum;
+   r->count += o->count;
+   (*joins)++;
+}
+
+EFL_START_TEST(eina_test_parallel_reduce)
+{
+   Parallel_Sum r = { 0, 0 };
+   unsigned int joins = 0;
+
+   eina_parallel_reduce(0, COUNT, 0, _parallel_sum, _parallel_join,
+                        &r, sizeof (r), &joins);
+   ck_assert_int_eq(r.count, COUNT);
+   fail_if(r.sum != (unsigned long long)COUNT * (COUNT - 1) / 2);
+   fail_if(joins >= eina_parallel_threads_get());
+
+   // the initial value is the identity of each partial result
+   r.sum = 0;
+   r.count = 0;
+   eina_parallel_reduce(1, 2, 0, _parallel_sum, _parallel_join,
+                        &r, sizeof (r), &joins);
+   ck_assert_int_eq(r.count, 1);
+   fail_if(r.sum != 1);
+}
+EFL_END_TEST
+
+void
+eina_test_parallel(TCase *tc)
+{
+   tcase_add_test(tc, eina_test_parallel_for);
+   tcase_add_test(tc, eina_test_parallel_nested);
+   tcase_add_test(tc, eina_test_parallel_reduce);
+}
@@ -599,6 +599,94 @@ EFL_START_TEST(eina_unicode_utf8_conversion)
 }
 EFL_END_TEST
 
+/* Reference for the bulk functions: the scalar decoder plus the limits
+ * strict UTF-8 puts on top of it. */
+static int
+_utf8_ref_count(const char *buf)
+{
+   int ind = 0, len = 0, prev;
+   Eina_Unicode u;
+
+   for (prev = 0; (u = eina_unicode_utf8_next_get(buf, &ind)); prev = ind)
+     {
+        if ((u >= 0xD800) && (u <= 0xDFFF)) return -1;
+        if (u > 0x10FFFF) return -1;
+        if ((ind - prev) > 4) return -1;
+        len++;
+     }
+   return len;
+}
+
+EFL_START_TEST(eina_unicode_utf8_bulk)
+{
+   static const char *pieces[] = {
+      "a", "z", " ", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x91\x99",
+      "\xED\x9F\xBF", "\xEE\x80\x80", "\xF4\x8F\xBF\xBF",
+      /* invalid */
+      "\x80", "\xC0\xAF", "\xE0\x9F\xBF", "\xED\xA0\x80", "\xF4\x90\x80\x80",
+      "\xF8\x88\x80\x80\x80", "\xFF", "\xC3", "\xE2\x82", "\xF0\x9F\x91"
+   };
+   Eina_Cpu_Features features = eina_cpu_features;
+   Eina_Cpu_Features masks[] = { features, features & ~EINA_CPU_AVX2, 0 };
+   Eina_Unicode out[512];
+   char buf[512];
+   unsigned int m;
+   int i, j;
+
+   fail_if(!eina_unicode_utf8_validate("", 0));
+   fail_if(!eina_unicode_utf8_validate("abc\0def", 7));
+   fail_if(eina_unicode_utf8_count("\xE2\x82\xAC", 3) != 1);
+   fail_if(eina_unicode_utf8_count("\xE2\x82\xAC", 2) != -1);
+   fail_if(eina_unicode_utf8_ascii_len("abc\xC3\xA9", 5) != 3);
+   fail_if(eina_unicode_utf8_decode("a\xC3\xA9", 3, out) != 2);
+   fail_if((out[0] != 'a') || (out[1] != 0xE9));
+
+   srand(time(NULL));
+
+   /* Check every code path against the scalar decoder */
+   for (m = 0; m < EINA_C_ARRAY_LENGTH(masks); m++)
+     {
+        eina_cpu_features = masks[m];
+        for (i = 0; i < 2000; i++)
+          {
+             Eina_Unicode *conv;
+             int len = 0, count, ref, conv_len;
+             Eina_Bool invalid = (i % 3) == 0;
+
+             buf[0] = 0;
+             for (j = rand() % 60; j > 0; j--)
+               {
+                  const char *p;
+
+                  if (rand() % 2) p = "abcdefgh";
+                  else p = pieces[rand() % (invalid ? EINA_C_ARRAY_LENGTH(pieces) : 9)];
+                  if (len + strlen(p) >= sizeof (buf)) break;
+                  strcpy(buf + len, p);
+                  len += strlen(p);
+               }
+
+             ref = _utf8_ref_count(buf);
+             count = eina_unicode_utf8_count(buf, len);
+             ck_assert_int_eq(count, ref);
+             fail_if(eina_unicode_utf8_validate(buf, len) != (ref >= 0));
+             ck_assert_int_eq(eina_unicode_utf8_ascii_len(buf, len),
+                              strspn(buf, "abcdefgh z"));
+
+             conv = eina_unicode_utf8_to_unicode(buf, &conv_len);
+             ck_assert_int_eq(conv_len, eina_unicode_utf8_get_len(buf));
+             if (ref >= 0)
+               {
+                  ck_assert_int_eq(conv_len, ref);
+                  ck_assert_int_eq(eina_unicode_utf8_decode(buf, len, out), ref);
+                  fail_if(memcmp(out, conv, ref * sizeof (Eina_Unicode)));
+               }
+             free(conv);
+          }
+     }
+   eina_cpu_features = features;
+}
+EFL_END_TEST
+
 void
 eina_test_ustr(TCase *tc)
 {
@@ -613,5 +701,6 @@ eina_test_ustr(TCase *tc)
    tcase_add_test(tc, eina_unicode_escape_test);
    tcase_add_test(tc,eina_unicode_utf8);
    tcase_add_test(tc,eina_unicode_utf8_conversion);
+   tcase_add_test(tc,eina_unicode_utf8_bulk);
 
 }
@@ -18,6 +18,7 @@ static const Efl_Test_Case etc[] = {
    { "Optional", eina_test_optional },
    { "Value", eina_test_value },
    { "Log", eina_test_log },
+   { "Span", eina_test_span },
    { NULL, NULL }
 };
 
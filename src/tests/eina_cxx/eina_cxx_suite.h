@@ -18,5 +18,6 @@ void eina_test_thread(TCase* tc);
 void eina_test_optional(TCase* tc);
 void eina_test_value(TCase* tc);
 void eina_test_log(TCase* tc);
+void eina_test_span(TCase* tc);
 
 #endif /* _EINA_CXX_SUITE_H */
@@ -4,6 +4,9 @@
 
 #include <functional>
 #include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include <Eina.hh>
 
@@ -202,6 +205,67 @@ bool operator==(non_pod lhs, non_pod rhs)
   return *lhs.x == *rhs.x;
 }
 
+EFL_START_TEST(eina_cxx_inarray_pod_move)
+{
+  efl::eina::eina_init eina_init;
+
+  std::vector<int> v;
+  for(int i = 0; i != 100; ++i)
+    v.push_back(i);
+
+  efl::eina::inarray<int> array(v.begin(), v.end());
+  ck_assert(array.size() == 100);
+  ck_assert(std::equal(array.begin(), array.end(), v.begin()));
+
+  Eina_Inarray* handle = array.native_handle();
+  efl::eina::inarray<int> array2(std::move(array));
+  ck_assert(array2.native_handle() == handle);
+  ck_assert(array2.size() == 100);
+  ck_assert(array.empty());
+
+  array = std::move(array2);
+  ck_assert(array.native_handle() == handle);
+  ck_assert(array.size() == 100);
+  ck_assert(array2.empty());
+
+  handle = array.release_native_handle();
+  ck_assert(array.empty());
+  ck_assert(eina_inarray_count(handle) == 100);
+  efl::eina::inarray<int> array3(handle);
+  ck_assert(std::equal(array3.begin(), array3.end(), v.begin()));
+}
+EFL_END_TEST
+
+EFL_START_TEST(eina_cxx_inarray_pod_emplace)
+{
+  efl::eina::eina_init eina_init;
+
+  efl::eina::inarray<int> array;
+
+  array.reserve(64);
+  ck_assert(array.capacity() >= 64);
+  ck_assert(array.empty());
+  ck_assert(array.begin() == array.end());
+
+  int* data = array.data();
+  array.emplace_back(5);
+  array.emplace_back(15);
+  ck_assert(array.emplace(array.begin() + 1, 10) == array.begin() + 1);
+  ck_assert(array.emplace_back(array[0]) == 5);
+  ck_assert(array.data() == data);
+
+  int result[] = {5, 10, 15, 5};
+  ck_assert(array.size() == 4);
+  ck_assert(std::equal(array.begin(), array.end(), result));
+
+  int more[] = {1, 2, 3};
+  array.insert(array.begin() + 1, &more[0], &more[3]);
+  int result2[] = {5, 1, 2, 3, 10, 15, 5};
+  ck_assert(array.size() == 7);
+  ck_assert(std::equal(array.begin(), array.end(), result2));
+}
+EFL_END_TEST
+
 EFL_START_TEST(eina_cxx_inarray_nonpod_push_back)
 {
   efl::eina::eina_init eina_init;
@@ -387,6 +451,90 @@ EFL_START_TEST(eina_cxx_inarray_nonpod_erase)
 }
 EFL_END_TEST
 
+EFL_START_TEST(eina_cxx_inarray_nonpod_move)
+{
+  efl::eina::eina_init eina_init;
+  {
+    efl::eina::inarray<non_pod> array(10u, non_pod(3));
+    Eina_Inarray* handle = array.native_handle();
+    unsigned int constructors = ::constructors_called;
+
+    efl::eina::inarray<non_pod> array2(std::move(array));
+    ck_assert(array2.native_handle() == handle);
+    ck_assert(array2.size() == 10);
+    ck_assert(array.empty());
+
+    array = std::move(array2);
+    ck_assert(array.native_handle() == handle);
+    ck_assert(array2.empty());
+    ck_assert(::constructors_called == constructors);
+  }
+  ck_assert(::constructors_called == ::destructors_called);
+  ::constructors_called = ::destructors_called = 0;
+}
+EFL_END_TEST
+
+EFL_START_TEST(eina_cxx_inarray_nonpod_emplace)
+{
+  efl::eina::eina_init eina_init;
+
+  // elements are moved, never copied, when the array grows
+  efl::eina::inarray<std::unique_ptr<int> > array;
+
+  for(int i = 0; i != 100; ++i)
+    array.push_back(std::unique_ptr<int>(new int(i)));
+  array.emplace(array.begin(), new int(-1));
+  array.emplace(array.begin() + 50, new int(-2));
+  array.emplace_back(new int(-3));
+
+  ck_assert(array.size() == 103);
+  ck_assert(*array[0] == -1);
+  ck_assert(*array[1] == 0);
+  ck_assert(*array[50] == -2);
+  ck_assert(*array[51] == 49);
+  ck_assert(*array[101] == 99);
+  ck_assert(*array[102] == -3);
+
+  array.erase(array.begin(), array.begin() + 2);
+  ck_assert(array.size() == 101);
+  ck_assert(*array[0] == 1);
+  ck_assert(*array[48] == -2);
+
+  array.reserve(500);
+  ck_assert(array.capacity() >= 500);
+  std::unique_ptr<int>* data = array.data();
+  for(int i = 0; i != 100; ++i)
+    array.emplace_back(new int(i));
+  ck_assert(array.data() == data);
+  ck_assert(*array.back() == 99);
+}
+EFL_END_TEST
+
+EFL_START_TEST(eina_cxx_inarray_nonpod_move_alias)
+{
+  efl::eina::eina_init eina_init;
+
+  // moving an element of the array into itself, while the array grows
+  efl::eina::inarray<std::string> array;
+  array.push_back("first element, long enough not to be a short string");
+  array.push_back("second element, long enough not to be a short string");
+  array.push_back("third element, long enough not to be a short string");
+  while(array.size() != array.capacity())
+    array.push_back("filler");
+
+  std::size_t size = array.size();
+  array.push_back(std::move(array[0]));
+  ck_assert(array.size() == size + 1);
+  ck_assert(array.back() == "first element, long enough not to be a short string");
+
+  while(array.size() != array.capacity())
+    array.push_back("filler");
+  array.insert(array.begin(), std::move(array[2]));
+  ck_assert(array.front() == "third element, long enough not to be a short string");
+  ck_assert(array[2] == "second element, long enough not to be a short string");
+}
+EFL_END_TEST
+
 EFL_START_TEST(eina_cxx_range_inarray)
 {
   efl::eina::eina_init eina_init;
@@ -449,11 +597,16 @@ eina_test_inarray(TCase *tc)
   tcase_add_test(tc, eina_cxx_inarray_pod_insert);
   tcase_add_test(tc, eina_cxx_inarray_pod_erase);
   tcase_add_test(tc, eina_cxx_inarray_pod_constructors);
+  tcase_add_test(tc, eina_cxx_inarray_pod_move);
+  tcase_add_test(tc, eina_cxx_inarray_pod_emplace);
   tcase_add_test(tc, eina_cxx_inarray_nonpod_push_back);
   tcase_add_test(tc, eina_cxx_inarray_nonpod_pop_back);
   tcase_add_test(tc, eina_cxx_inarray_nonpod_insert);
   tcase_add_test(tc, eina_cxx_inarray_nonpod_erase);
   tcase_add_test(tc, eina_cxx_inarray_nonpod_constructors);
+  tcase_add_test(tc, eina_cxx_inarray_nonpod_move);
+  tcase_add_test(tc, eina_cxx_inarray_nonpod_emplace);
+  tcase_add_test(tc, eina_cxx_inarray_nonpod_move_alias);
   tcase_add_test(tc, eina_cxx_range_inarray);
   tcase_add_test(tc, eina_cxx_inarray_from_c);
 }
@@ -481,6 +481,63 @@ EFL_START_TEST(eina_cxx_ptrarray_range)
 }
 EFL_END_TEST
 
+EFL_START_TEST(eina_cxx_ptrarray_move)
+{
+  efl::eina::eina_init eina_init;
+
+  efl::eina::ptr_array<int, efl::eina::heap_copy_allocator> c1(10, 5);
+  int* first = &c1.front();
+
+  efl::eina::ptr_array<int, efl::eina::heap_copy_allocator> c2(std::move(c1));
+  ck_assert(c1.empty());
+  ck_assert(c2.size() == 10);
+  ck_assert(&c2.front() == first);
+
+  efl::eina::ptr_array<int, efl::eina::heap_copy_allocator> c3(2, 1);
+  c3 = std::move(c2);
+  ck_assert(c2.empty());
+  ck_assert(c3.size() == 10);
+  ck_assert(&c3.front() == first);
+}
+EFL_END_TEST
+
+EFL_START_TEST(eina_cxx_ptrarray_emplace)
+{
+  efl::eina::eina_init eina_init;
+
+  efl::eina::ptr_array<std::pair<int, int> > c;
+  ck_assert(c.emplace_back(2, 3).second == 3);
+  ck_assert(c.emplace(c.begin(), 0, 1)->first == 0);
+  ck_assert(c.back() == std::make_pair(2, 3));
+  ck_assert(c.size() == 2);
+
+  efl::eina::ptr_array<int, efl::eina::malloc_clone_allocator> m;
+  m.emplace_back(5);
+  ck_assert(m.back() == 5);
+}
+EFL_END_TEST
+
+EFL_START_TEST(eina_cxx_ptrarray_own_to_c)
+{
+  efl::eina::eina_init eina_init;
+
+  efl::eina::array<int> a;
+  a.push_back(new int(1));
+  a.push_back(new int(2));
+
+  // an owned transfer hands the Eina_Array over, a is left empty
+  Eina_Array* native = efl::eolian::convert_to_c
+    <Eina_Array*, efl::eina::array<int> const&, true>(a);
+  ck_assert(a.empty());
+  ck_assert(native != a.native_handle());
+
+  efl::eina::array<int> b(native);
+  ck_assert(b.size() == 2);
+  ck_assert(b[0] == 1);
+  ck_assert(b[1] == 2);
+}
+EFL_END_TEST
+
 void
 eina_test_ptrarray(TCase* tc)
 {
@@ -490,4 +547,7 @@ eina_test_ptrarray(TCase* tc)
   tcase_add_test(tc, eina_cxx_ptrarray_constructors);
   tcase_add_test(tc, eina_cxx_ptrarray_erase);
   tcase_add_test(tc, eina_cxx_ptrarray_range);
+  tcase_add_test(tc, eina_cxx_ptrarray_move);
+  tcase_add_test(tc, eina_cxx_ptrarray_emplace);
+  tcase_add_test(tc, eina_cxx_ptrarray_own_to_c);
 }
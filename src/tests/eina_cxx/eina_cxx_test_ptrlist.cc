@@ -484,6 +484,44 @@ EFL_START_TEST(eina_cxx_ptrlist_range)
 }
 EFL_END_TEST
 
+EFL_START_TEST(eina_cxx_ptrlist_move)
+{
+  efl::eina::eina_init eina_init;
+
+  efl::eina::ptr_list<int, efl::eina::heap_copy_allocator> c1(10, 5);
+  int* first = &c1.front();
+
+  efl::eina::ptr_list<int, efl::eina::heap_copy_allocator> c2(std::move(c1));
+  ck_assert(c1.empty());
+  ck_assert(c2.size() == 10);
+  ck_assert(&c2.front() == first);
+
+  efl::eina::ptr_list<int, efl::eina::heap_copy_allocator> c3(2, 1);
+  c3 = std::move(c2);
+  ck_assert(c2.empty());
+  ck_assert(c3.size() == 10);
+  ck_assert(&c3.front() == first);
+}
+EFL_END_TEST
+
+EFL_START_TEST(eina_cxx_ptrlist_emplace)
+{
+  efl::eina::eina_init eina_init;
+
+  efl::eina::ptr_list<std::pair<int, int> > c;
+  ck_assert(c.emplace_back(2, 3).second == 3);
+  ck_assert(c.emplace(c.begin(), 0, 1)->first == 0);
+  ck_assert(c.emplace_front(-1, 0).first == -1);
+  ck_assert(c.front().first == -1);
+  ck_assert(c.back() == std::make_pair(2, 3));
+  ck_assert(c.size() == 3);
+
+  efl::eina::ptr_list<int, efl::eina::malloc_clone_allocator> m;
+  m.emplace_back(5);
+  ck_assert(m.back() == 5);
+}
+EFL_END_TEST
+
 void
 eina_test_ptrlist(TCase* tc)
 {
@@ -496,4 +534,6 @@ eina_test_ptrlist(TCase* tc)
   tcase_add_test(tc, eina_cxx_ptrlist_erase);
   tcase_add_test(tc, eina_cxx_ptrlist_range);
   tcase_add_test(tc, eina_cxx_ptrlist_malloc_clone_allocator);
+  tcase_add_test(tc, eina_cxx_ptrlist_move);
+  tcase_add_test(tc, eina_cxx_ptrlist_emplace);
 }
@@ -0,0 +1,101 @@
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+
+#include <vector>
+
+#include <Eina.hh>
+
+#include "eina_cxx_suite.h"
+
+EFL_START_TEST(eina_cxx_span_constructors)
+{
+  efl::eina::eina_init eina_init;
+
+  int values[] = {1, 2, 3, 4, 5};
+
+  efl::eina::span<int> s1;
+  ck_assert(s1.empty());
+  ck_assert(s1.data() == nullptr);
+
+  efl::eina::span<int> s2(values);
+  ck_assert(s2.size() == 5);
+  ck_assert(s2.data() == values);
+  ck_assert(s2.size_bytes() == sizeof(values));
+
+  std::vector<int> v(values, values + 5);
+  efl::eina::span<int> s3(v);
+  ck_assert(s3.data() == v.data());
+  ck_assert(std::equal(s3.begin(), s3.end(), values));
+
+  std::vector<int> const& cv = v;
+  efl::eina::span<int const> s4(cv);
+  ck_assert(s4.data() == v.data());
+
+  efl::eina::inarray<int> array(v.begin(), v.end());
+  efl::eina::span<int> s5(array);
+  ck_assert(s5.data() == array.data());
+  ck_assert(s5.size() == 5);
+
+  efl::eina::span<int const> s6(s5);
+  ck_assert(s6.data() == array.data());
+
+  s3[0] = 10;
+  ck_assert(v[0] == 10);
+  ck_assert(s3.front() == 10);
+  ck_assert(s3.back() == 5);
+}
+EFL_END_TEST
+
+EFL_START_TEST(eina_cxx_span_subspan)
+{
+  efl::eina::eina_init eina_init;
+
+  int values[] = {1, 2, 3, 4, 5};
+  efl::eina::span<int> s(values);
+
+  ck_assert(s.first(2).size() == 2);
+  ck_assert(s.first(2).back() == 2);
+  ck_assert(s.last(2).front() == 4);
+  ck_assert(s.subspan(1).size() == 4);
+  ck_assert(s.subspan(1, 3).back() == 4);
+
+  int rresult[] = {5, 4, 3, 2, 1};
+  ck_assert(std::equal(s.rbegin(), s.rend(), rresult));
+}
+EFL_END_TEST
+
+EFL_START_TEST(eina_cxx_span_slice)
+{
+  efl::eina::eina_init eina_init;
+
+  int values[] = {1, 2, 3, 4, 5};
+  efl::eina::span<int const> s(values);
+
+  Eina_Binbuf* buf = eina_binbuf_new();
+  ck_assert(eina_binbuf_append_slice(buf, s.slice()));
+  ck_assert(eina_binbuf_length_get(buf) == sizeof(values));
+
+  efl::eina::span<int const> ro(eina_binbuf_slice_get(buf));
+  ck_assert(ro.size() == 5);
+  ck_assert(std::equal(ro.begin(), ro.end(), values));
+
+  efl::eina::span<int> rw(eina_binbuf_rw_slice_get(buf));
+  rw[4] = 50;
+  ck_assert(ro[4] == 50);
+
+  Eina_Rw_Slice rws = rw.rw_slice();
+  ck_assert(rws.mem == eina_binbuf_string_get(buf));
+  ck_assert(rws.len == sizeof(values));
+
+  eina_binbuf_free(buf);
+}
+EFL_END_TEST
+
+void
+eina_test_span(TCase* tc)
+{
+  tcase_add_test(tc, eina_cxx_span_constructors);
+  tcase_add_test(tc, eina_cxx_span_subspan);
+  tcase_add_test(tc, eina_cxx_span_slice);
+}
@@ -185,12 +185,115 @@ EFL_START_TEST(eo_event_generation_bug)
 }
 EFL_END_TEST
 
+#define MANY_CBS 24
+
+typedef struct {
+   int order[MANY_CBS * 2];
+   int count;
+} Many_Data;
+
+static void
+_many_cb(void *data, const Efl_Event *event)
+{
+   Many_Data *d = event->info;
+
+   d->order[d->count++] = (int)(uintptr_t)data;
+}
+
+static void
+_many_insert_cb(void *data, const Efl_Event *event)
+{
+   _many_cb(data, event);
+   /* goes below the callbacks that did not run yet, they must all still run
+    * but not the new one */
+   efl_event_callback_priority_add(event->object, EFL_TEST_EVENT_EVENT_TESTER,
+                                   EFL_CALLBACK_PRIORITY_AFTER, _many_cb,
+                                   (void *)(uintptr_t)1000);
+}
+
+EFL_CALLBACKS_ARRAY_DEFINE(_many_array,
+                           { EFL_TEST_EVENT_EVENT_TESTER, _many_cb },
+                           { EFL_TEST_EVENT_EVENT_TESTER_CLAMP_TEST, _many_cb });
+
+EFL_START_TEST(eo_event_many_callbacks)
+{
+   Many_Data d;
+   Eo *obj;
+   int i;
+
+   obj = efl_add_ref(efl_test_event_class_get(), NULL);
+
+   // nobody listens at all
+   memset(&d, 0, sizeof (d));
+   fail_if(efl_event_callback_call(obj, EFL_TEST_EVENT_EVENT_TESTER, &d));
+
+   /* enough callbacks on another event to get the emissions to go through
+    * the per event index, added in the reverse order of their priorities */
+   for (i = MANY_CBS - 1; i >= 0; i--)
+     efl_event_callback_priority_add(obj, EFL_TEST_EVENT_EVENT_TESTER_SUBSCRIBE,
+                                     i, _many_cb, (void *)(uintptr_t)i);
+
+   // callbacks exist, just not for this event: same result as before
+   fail_if(!efl_event_callback_call(obj, EFL_TEST_EVENT_EVENT_TESTER, &d));
+   ck_assert_int_eq(d.count, 0);
+
+   fail_if(!efl_event_callback_call(obj, EFL_TEST_EVENT_EVENT_TESTER_SUBSCRIBE, &d));
+   ck_assert_int_eq(d.count, MANY_CBS);
+   for (i = 0; i < MANY_CBS; i++)
+     ck_assert_int_eq(d.order[i], i);
+
+   // interleave callbacks for two events in the priorities
+   efl_event_callback_priority_add(obj, EFL_TEST_EVENT_EVENT_TESTER, 5,
+                                   _many_insert_cb, (void *)(uintptr_t)105);
+   efl_event_callback_priority_add(obj, EFL_TEST_EVENT_EVENT_TESTER, -1,
+                                   _many_cb, (void *)(uintptr_t)99);
+   efl_event_callback_array_priority_add(obj, _many_array(), 10,
+                                         (void *)(uintptr_t)110);
+
+   memset(&d, 0, sizeof (d));
+   efl_event_callback_call(obj, EFL_TEST_EVENT_EVENT_TESTER, &d);
+   ck_assert_int_eq(d.count, 3);
+   ck_assert_int_eq(d.order[0], 99);
+   ck_assert_int_eq(d.order[1], 105);
+   ck_assert_int_eq(d.order[2], 110);
+
+   // the callback added during the last emission now runs as well
+   memset(&d, 0, sizeof (d));
+   efl_event_callback_call(obj, EFL_TEST_EVENT_EVENT_TESTER, &d);
+   ck_assert_int_eq(d.count, 4);
+   ck_assert_int_eq(d.order[2], 110);
+   ck_assert_int_eq(d.order[3], 1000);
+
+   memset(&d, 0, sizeof (d));
+   efl_event_callback_call(obj, EFL_TEST_EVENT_EVENT_TESTER_CLAMP_TEST, &d);
+   ck_assert_int_eq(d.count, 1);
+   ck_assert_int_eq(d.order[0], 110);
+
+   // removals are seen by the next emissions
+   efl_event_callback_array_del(obj, _many_array(), (void *)(uintptr_t)110);
+   for (i = 0; i < MANY_CBS; i += 2)
+     efl_event_callback_del(obj, EFL_TEST_EVENT_EVENT_TESTER_SUBSCRIBE,
+                            _many_cb, (void *)(uintptr_t)i);
+
+   memset(&d, 0, sizeof (d));
+   efl_event_callback_call(obj, EFL_TEST_EVENT_EVENT_TESTER_CLAMP_TEST, &d);
+   ck_assert_int_eq(d.count, 0);
+
+   efl_event_callback_call(obj, EFL_TEST_EVENT_EVENT_TESTER_SUBSCRIBE, &d);
+   ck_assert_int_eq(d.count, MANY_CBS / 2);
+   for (i = 0; i < MANY_CBS / 2; i++)
+     ck_assert_int_eq(d.order[i], i * 2 + 1);
+
+   efl_unref(obj);
+}
+EFL_END_TEST
 
 void eo_test_event(TCase *tc)
 {
    tcase_add_test(tc, eo_event);
    tcase_add_test(tc, eo_event_call_in_call);
    tcase_add_test(tc, eo_event_generation_bug);
+   tcase_add_test(tc, eo_event_many_callbacks);
 }
 
 
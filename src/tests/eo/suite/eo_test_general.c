@@ -1622,6 +1622,183 @@ EFL_START_TEST(eo_domain)
 EFL_END_TEST
 
 
+typedef struct
+{
+   Eo *objs;
+   Eina_Bool done;
+   unsigned int loops;
+} Shared_Read_Data;
+
+static void *
+_shared_reader(void *data, Eina_Thread t EINA_UNUSED)
+{
+   Shared_Read_Data *d = data;
+   Domain_Public_Data *pd;
+
+   // lookups only, while the main thread adds and deletes shared objects
+   do
+     {
+        fail_if(!efl_isa(d->objs, DOMAIN_CLASS));
+        fail_if(efl_class_get(d->objs) != DOMAIN_CLASS);
+        pd = efl_data_scope_get(d->objs, DOMAIN_CLASS);
+        fail_if(!pd || (pd->a != 42));
+        d->loops++;
+     }
+   while (!__atomic_load_n(&d->done, __ATOMIC_ACQUIRE));
+   return NULL;
+}
+
+EFL_START_TEST(eo_domain_shared_lookup)
+{
+   Shared_Read_Data data[2];
+   Eina_Thread t[2];
+   Eo **objs, *objs_deleted;
+   unsigned int i, j, count = 3000;
+
+   objs = calloc(count, sizeof (Eo *));
+   fail_if(!objs);
+
+   efl_domain_current_push(EFL_ID_DOMAIN_SHARED);
+   objs[0] = efl_add_ref(DOMAIN_CLASS, NULL, domain_a_set(efl_added, 42));
+   efl_domain_current_pop();
+   fail_if(!objs[0]);
+
+   for (i = 0; i < EINA_C_ARRAY_LENGTH(t); i++)
+     {
+        data[i].objs = objs[0];
+        data[i].done = EINA_FALSE;
+        data[i].loops = 0;
+        fail_if(!eina_thread_create(&t[i], EINA_THREAD_NORMAL, -1,
+                                    _shared_reader, &data[i]));
+     }
+
+   // more objects than a table holds, so that tables get recycled too
+   efl_domain_current_push(EFL_ID_DOMAIN_SHARED);
+   for (j = 0; j < 10; j++)
+     {
+        for (i = 1; i < count; i++)
+          objs[i] = efl_add_ref(DOMAIN_CLASS, NULL, domain_a_set(efl_added, i));
+        for (i = 1; i < count; i++)
+          {
+             fail_if(!efl_isa(objs[i], DOMAIN_CLASS));
+             efl_unref(objs[i]);
+          }
+     }
+   objs_deleted = objs[1];
+   efl_domain_current_pop();
+
+   for (i = 0; i < EINA_C_ARRAY_LENGTH(t); i++)
+     {
+        __atomic_store_n(&data[i].done, EINA_TRUE, __ATOMIC_RELEASE);
+        eina_thread_join(t[i]);
+     }
+
+   // a deleted shared object must not be found anymore
+   fail_if(efl_isa(objs_deleted, DOMAIN_CLASS));
+   fail_if(efl_data_scope_safe_get(objs_deleted, DOMAIN_CLASS));
+
+   efl_unref(objs[0]);
+   free(objs);
+}
+EFL_END_TEST
+
+typedef struct
+{
+   Eo *cur;
+   Eina_Bool done;
+} Shared_Override_Data;
+
+static int
+_domain_override_a_get(Eo *obj EINA_UNUSED, void *pd EINA_UNUSED)
+{
+   return 1337;
+}
+
+static void *
+_shared_override_reader(void *data, Eina_Thread t EINA_UNUSED)
+{
+   Shared_Override_Data *d = data;
+
+   // the object may be gone or going, only its vtable must still be there
+   do
+     efl_isa(__atomic_load_n(&d->cur, __ATOMIC_ACQUIRE), DOMAIN_CLASS);
+   while (!__atomic_load_n(&d->done, __ATOMIC_ACQUIRE));
+   return NULL;
+}
+
+EFL_START_TEST(eo_domain_shared_override_del)
+{
+   Shared_Override_Data data;
+   Eina_Thread t;
+   Eo *obj;
+   unsigned int i;
+
+   EFL_OPS_DEFINE(overrides,
+                  EFL_OBJECT_OP_FUNC(domain_a_get, _domain_override_a_get));
+
+   data.cur = NULL;
+   data.done = EINA_FALSE;
+   fail_if(!eina_thread_create(&t, EINA_THREAD_NORMAL, -1,
+                               _shared_override_reader, &data));
+
+   efl_domain_current_push(EFL_ID_DOMAIN_SHARED);
+   for (i = 0; i < 20000; i++)
+     {
+        obj = efl_add_ref(DOMAIN_CLASS, NULL);
+        fail_if(!efl_object_override(obj, &overrides));
+        ck_assert_int_eq(domain_a_get(obj), 1337);
+        __atomic_store_n(&data.cur, obj, __ATOMIC_RELEASE);
+        efl_unref(obj);
+     }
+   efl_domain_current_pop();
+
+   __atomic_store_n(&data.done, EINA_TRUE, __ATOMIC_RELEASE);
+   eina_thread_join(t);
+   fail_if(efl_isa(obj, DOMAIN_CLASS));
+}
+EFL_END_TEST
+
+static void *
+_shared_override_isa(void *data, Eina_Thread t EINA_UNUSED)
+{
+   Shared_Override_Data *d = data;
+   Eina_Bool isa = EINA_TRUE;
+
+   // the override comes and goes, the object stays
+   do
+     isa &= efl_isa(d->cur, DOMAIN_CLASS);
+   while (!__atomic_load_n(&d->done, __ATOMIC_ACQUIRE));
+   return (void *)(uintptr_t)isa;
+}
+
+EFL_START_TEST(eo_domain_shared_override_clear)
+{
+   Shared_Override_Data data;
+   Eina_Thread t;
+   unsigned int i;
+
+   EFL_OPS_DEFINE(overrides,
+                  EFL_OBJECT_OP_FUNC(domain_a_get, _domain_override_a_get));
+
+   efl_domain_current_push(EFL_ID_DOMAIN_SHARED);
+   data.cur = efl_add_ref(DOMAIN_CLASS, NULL);
+   efl_domain_current_pop();
+   data.done = EINA_FALSE;
+   fail_if(!eina_thread_create(&t, EINA_THREAD_NORMAL, -1,
+                               _shared_override_isa, &data));
+
+   for (i = 0; i < 20000; i++)
+     {
+        fail_if(!efl_object_override(data.cur, &overrides));
+        fail_if(!efl_object_override(data.cur, NULL));
+     }
+
+   __atomic_store_n(&data.done, EINA_TRUE, __ATOMIC_RELEASE);
+   fail_if(!eina_thread_join(t));
+   efl_unref(data.cur);
+}
+EFL_END_TEST
+
 static int
 _inherit_value_1(Eo *obj EINA_UNUSED, void *pd EINA_UNUSED)
 {
@@ -1802,6 +1979,89 @@ EFL_START_TEST(efl_object_auto_unref_test)
 }
 EFL_END_TEST
 
+EFL_START_TEST(efl_object_data_layout)
+{
+   static const Efl_Class_Description mixin_a_desc = {
+        EO_VERSION,
+        "Data_Mixin_A",
+        EFL_CLASS_TYPE_MIXIN,
+        16,
+        NULL,
+        NULL,
+        NULL
+   };
+   static const Efl_Class_Description mixin_b_desc = {
+        EO_VERSION,
+        "Data_Mixin_B",
+        EFL_CLASS_TYPE_MIXIN,
+        16,
+        NULL,
+        NULL,
+        NULL
+   };
+   static const Efl_Class_Description class_desc = {
+        EO_VERSION,
+        "Data_Layout",
+        EFL_CLASS_TYPE_REGULAR,
+        8,
+        NULL,
+        NULL,
+        NULL
+   };
+   static const char profile[] = "Data_Mixin_B 100\nData_Mixin_A 10\n";
+   const Efl_Class *mixin_a, *mixin_b, *klass;
+   unsigned long long count = 0;
+   Eina_Tmpstr *file;
+   char line[256];
+   FILE *f;
+   Eo *obj;
+   int fd, i;
+
+   fd = eina_file_mkstemp("eo_data_profile_XXXXXX", &file);
+   fail_if(fd < 0);
+   fail_if(write(fd, profile, sizeof(profile) - 1) != sizeof(profile) - 1);
+   close(fd);
+
+   efl_object_shutdown();
+   setenv("EO_DATA_PROFILE", file, 1);
+   setenv("EO_DATA_STATS", "1", 1);
+   efl_object_init();
+
+   mixin_a = efl_class_new(&mixin_a_desc, NULL, NULL);
+   mixin_b = efl_class_new(&mixin_b_desc, NULL, NULL);
+   klass = efl_class_new(&class_desc, EO_CLASS, mixin_a, mixin_b, NULL);
+   fail_if(!klass);
+
+   // the profile moves the data of the hottest mixin first
+   obj = efl_add_ref(klass, NULL);
+   fail_if(!obj);
+   fail_if((char *)efl_data_scope_get(obj, mixin_b) >
+           (char *)efl_data_scope_get(obj, mixin_a));
+   for (i = 0; i < 10; i++)
+     fail_if(!efl_data_scope_get(obj, mixin_a));
+   efl_unref(obj);
+
+   // the counts of this run replace the profile
+   efl_object_shutdown();
+   unsetenv("EO_DATA_PROFILE");
+   unsetenv("EO_DATA_STATS");
+   efl_object_init();
+
+   f = fopen(file, "r");
+   fail_if(!f);
+   while (fgets(line, sizeof(line), f))
+     {
+        if (!strncmp(line, "Data_Mixin_A ", 13))
+          count = strtoull(line + 13, NULL, 10);
+     }
+   fclose(f);
+   fail_if(count < 11);
+
+   unlink(file);
+   eina_tmpstr_del(file);
+}
+EFL_END_TEST
+
 EFL_START_TEST(efl_object_size)
 {
    // This test is checking that we are not increasing the size of our object over time
@@ -1841,6 +2101,305 @@ EFL_START_TEST(eo_test_class_replacement)
 }
 EFL_END_TEST
 
+static int
+_call_cache_roundtrip(Eo *obj, int a)
+{
+   // one call site for every class, as a generic caller would do
+   simple_a_set(obj, a);
+   return simple_a_get(obj);
+}
+
+EFL_START_TEST(efl_object_call_cache)
+{
+   unsigned long long misses;
+   Eo *obj, *obj3;
+   int i;
+
+   obj = efl_add_ref(SIMPLE_CLASS, NULL);
+   obj3 = efl_add_ref(SIMPLE3_CLASS, NULL);
+   fail_if(!obj || !obj3);
+
+   /* Warm up the call sites, then the same class should always hit. */
+   ck_assert_int_eq(_call_cache_roundtrip(obj, 1), 1);
+   misses = efl_object_call_cache_misses_get();
+   for (i = 0; i < 100; i++)
+     ck_assert_int_eq(_call_cache_roundtrip(obj, i), i);
+   ck_assert(efl_object_call_cache_misses_get() == misses);
+
+   /* Another class has its data somewhere else, it must not reuse it. */
+   for (i = 0; i < 10; i++)
+     {
+        ck_assert_int_eq(_call_cache_roundtrip(obj3, 1000 + i), 1000 + i);
+        ck_assert_int_eq(_call_cache_roundtrip(obj, i), i);
+     }
+   ck_assert(efl_object_call_cache_misses_get() > misses);
+   ck_assert_int_eq(simple_a_get(obj3), 1009);
+
+   /* An override set after the call site was warmed still wins. */
+   EFL_OPS_DEFINE(
+            overrides,
+            EFL_OBJECT_OP_FUNC(simple_a_set, _simple_obj_override_a_double_set));
+   fail_if(!efl_object_override(obj, &overrides));
+   ck_assert_int_eq(_call_cache_roundtrip(obj, 21), 42);
+   fail_if(!efl_object_override(obj, NULL));
+   ck_assert_int_eq(_call_cache_roundtrip(obj, 21), 21);
+
+   efl_unref(obj3);
+   efl_unref(obj);
+}
+EFL_END_TEST
+
+typedef struct
+{
+   int value;
+} Direct_Data;
+
+const Efl_Class *direct_class_get(void);
+#define DIRECT_CLASS direct_class_get()
+
+static void
+_direct_value_set(Eo *obj EINA_UNUSED, Direct_Data *pd, int value)
+{
+   pd->value = value;
+}
+
+static int
+_direct_value_get(const Eo *obj EINA_UNUSED, Direct_Data *pd)
+{
+   return pd->value;
+}
+
+EAPI void direct_value_set(Eo *obj, int value);
+EAPI int direct_value_get(const Eo *obj);
+
+/* what eolian generates for the methods of a final class */
+EFL_VOID_FUNC_BODYV_DIRECT(direct_value_set, DIRECT_CLASS, _direct_value_set, EFL_FUNC_CALL(value), int value);
+EFL_FUNC_BODY_CONST_DIRECT(direct_value_get, DIRECT_CLASS, _direct_value_get, int, -1);
+
+static Eina_Bool
+_direct_class_initializer(Efl_Class *klass)
+{
+   EFL_OPS_DEFINE(ops,
+                  EFL_OBJECT_OP_FUNC(direct_value_set, _direct_value_set),
+                  EFL_OBJECT_OP_FUNC(direct_value_get, _direct_value_get));
+   return efl_class_functions_set(klass, &ops, NULL);
+}
+
+static const Efl_Class_Description _direct_class_desc = {
+     EO_VERSION,
+     "Direct",
+     EFL_CLASS_TYPE_REGULAR,
+     sizeof(Direct_Data),
+     _direct_class_initializer,
+     NULL,
+     NULL
+};
+
+EFL_DEFINE_CLASS(direct_class_get, &_direct_class_desc, EO_CLASS, NULL);
+
+static int
+_direct_child_value_get(const Eo *obj, void *pd EINA_UNUSED)
+{
+   return 2 * direct_value_get(efl_super(obj, efl_class_get(obj)));
+}
+
+static Eina_Bool
+_direct_child_class_initializer(Efl_Class *klass)
+{
+   EFL_OPS_DEFINE(ops, EFL_OBJECT_OP_FUNC(direct_value_get, _direct_child_value_get));
+   return efl_class_functions_set(klass, &ops, NULL);
+}
+
+static int
+_direct_override_value_get(Eo *obj, void *pd EINA_UNUSED)
+{
+   return 3 * direct_value_get(efl_super(obj, EFL_OBJECT_OVERRIDE_CLASS));
+}
+
+EFL_START_TEST(efl_object_direct_call)
+{
+   static const Efl_Class_Description child_desc = {
+        EO_VERSION,
+        "DirectChild",
+        EFL_CLASS_TYPE_REGULAR,
+        0,
+        _direct_child_class_initializer,
+        NULL,
+        NULL
+   };
+   const Efl_Class *child_klass;
+   Eo *obj, *child, *simple;
+
+   obj = efl_add_ref(DIRECT_CLASS, NULL);
+   fail_if(!obj);
+   direct_value_set(obj, 7);
+   ck_assert_int_eq(direct_value_get(obj), 7);
+
+   /* eolian forbids it, but a subclass must still take the regular path */
+   child_klass = efl_class_new(&child_desc, DIRECT_CLASS, NULL);
+   fail_if(!child_klass);
+   child = efl_add_ref(child_klass, NULL);
+   fail_if(!child);
+   direct_value_set(child, 5);
+   ck_assert_int_eq(direct_value_get(child), 10);
+   ck_assert_int_eq(direct_value_get(efl_super(child, child_klass)), 5);
+
+   /* so do overrides */
+   EFL_OPS_DEFINE(overrides,
+                  EFL_OBJECT_OP_FUNC(direct_value_get, _direct_override_value_get));
+   fail_if(!efl_object_override(obj, &overrides));
+   ck_assert_int_eq(direct_value_get(obj), 21);
+   fail_if(!efl_object_override(obj, NULL));
+   ck_assert_int_eq(direct_value_get(obj), 7);
+
+   /* and objects which do not implement the method at all */
+   simple = efl_add_ref(SIMPLE_CLASS, NULL);
+   fail_if(!simple);
+   ck_assert_int_eq(direct_value_get(simple), -1);
+   ck_assert_int_eq(direct_value_get(NULL), -1);
+
+   efl_unref(simple);
+   efl_unref(child);
+   efl_unref(obj);
+}
+EFL_END_TEST
+
+static void
+_bulk_init(void *data, Eo *obj, unsigned int index)
+{
+   unsigned int *calls = data;
+
+   simple_a_set(obj, index);
+   (*calls)++;
+}
+
+EFL_START_TEST(efl_object_bulk)
+{
+   Eo *parent, *objs[100];
+   Eina_Iterator *it;
+   Eo *child;
+   unsigned int i, calls = 0;
+
+   parent = efl_add_ref(SIMPLE_CLASS, NULL);
+   fail_if(!parent);
+
+   ck_assert_int_eq(efl_add_bulk(SIMPLE_CLASS, parent, objs, EINA_C_ARRAY_LENGTH(objs),
+                                 _bulk_init, &calls), EINA_C_ARRAY_LENGTH(objs));
+   ck_assert_int_eq(calls, EINA_C_ARRAY_LENGTH(objs));
+   for (i = 0; i < EINA_C_ARRAY_LENGTH(objs); i++)
+     {
+        fail_if(!efl_isa(objs[i], SIMPLE_CLASS));
+        fail_if(!efl_finalized_get(objs[i]));
+        fail_if(efl_parent_get(objs[i]) != parent);
+        ck_assert_int_eq(efl_ref_count(objs[i]), 1);
+        ck_assert_int_eq(simple_a_get(objs[i]), i);
+     }
+
+   i = 0;
+   it = efl_children_iterator_new(parent);
+   EINA_ITERATOR_FOREACH(it, child) i++;
+   eina_iterator_free(it);
+   ck_assert_int_eq(i, EINA_C_ARRAY_LENGTH(objs));
+
+   efl_del_bulk(objs, EINA_C_ARRAY_LENGTH(objs));
+   it = efl_children_iterator_new(parent);
+   fail_if(it && eina_iterator_next(it, (void **)&child));
+   eina_iterator_free(it);
+
+   /* The caller owns one reference of each object. */
+   ck_assert_int_eq(efl_add_ref_bulk(SIMPLE_CLASS, NULL, objs, 10, NULL, NULL), 10);
+   for (i = 0; i < 10; i++)
+     {
+        ck_assert_int_eq(efl_ref_count(objs[i]), 1);
+        efl_unref(objs[i]);
+     }
+
+   /* Classes that can not be instantiated do not create anything. */
+   for (i = 0; i < 10; i++) objs[i] = parent;
+   ck_assert_int_eq(efl_add_bulk(EFL_OBJECT_CLASS, parent, objs, 10, NULL, NULL), 0);
+   for (i = 0; i < 10; i++) fail_if(objs[i]);
+   for (i = 0; i < 10; i++) objs[i] = parent;
+   ck_assert_int_eq(efl_add_bulk((Efl_Class *)parent, parent, objs, 10, NULL, NULL), 0);
+   for (i = 0; i < 10; i++) fail_if(objs[i]);
+   ck_assert_int_eq(efl_add_bulk(SIMPLE_CLASS, parent, objs, 0, NULL, NULL), 0);
+
+   efl_unref(parent);
+}
+EFL_END_TEST
+
+static int
+_bulk_ptr_cmp(const void *a, const void *b)
+{
+   const Eo *oa = *(const Eo **)a, *ob = *(const Eo **)b;
+
+   if (oa < ob) return -1;
+   return (oa > ob);
+}
+
+static void
+_bulk_many_check(Eo **objs, unsigned int count)
+{
+   Eo **sorted;
+   unsigned int i;
+
+   for (i = 0; i < count; i++)
+     {
+        fail_if(!efl_isa(objs[i], SIMPLE_CLASS));
+        ck_assert_int_eq(simple_a_get(objs[i]), i);
+     }
+   sorted = malloc(count * sizeof(Eo *));
+   fail_if(!sorted);
+   memcpy(sorted, objs, count * sizeof(Eo *));
+   qsort(sorted, count, sizeof(Eo *), _bulk_ptr_cmp);
+   for (i = 1; i < count; i++)
+     fail_if(sorted[i - 1] == sorted[i]);
+   free(sorted);
+}
+
+EFL_START_TEST(efl_object_bulk_many)
+{
+   const unsigned int count = 5000;
+   Eo *parent, **objs, **more;
+   unsigned int i, calls = 0;
+
+   objs = calloc(count, sizeof(Eo *));
+   more = calloc(count, sizeof(Eo *));
+   fail_if(!objs || !more);
+   parent = efl_add_ref(SIMPLE_CLASS, NULL);
+
+   /* more ids than a table holds */
+   ck_assert_int_eq(efl_add_bulk(SIMPLE_CLASS, parent, objs, count, _bulk_init, &calls), count);
+   _bulk_many_check(objs, count);
+
+   /* freed entries are used again along with new ones */
+   for (i = 0; i < count; i += 3)
+     {
+        efl_del(objs[i]);
+        objs[i] = NULL;
+     }
+   calls = 0;
+   ck_assert_int_eq(efl_add_bulk(SIMPLE_CLASS, parent, more, count, _bulk_init, &calls), count);
+   _bulk_many_check(more, count);
+   for (i = 0; i < count; i++)
+     if (objs[i]) fail_if(!efl_isa(objs[i], SIMPLE_CLASS));
+   efl_del_bulk(more, count);
+   efl_del_bulk(objs, count);
+
+   /* and the same in the shared domain */
+   efl_domain_current_push(EFL_ID_DOMAIN_SHARED);
+   calls = 0;
+   ck_assert_int_eq(efl_add_ref_bulk(SIMPLE_CLASS, NULL, objs, count, _bulk_init, &calls), count);
+   _bulk_many_check(objs, count);
+   for (i = 0; i < count; i++)
+     efl_unref(objs[i]);
+   efl_domain_current_pop();
+
+   efl_unref(parent);
+   free(objs);
+   free(more);
+}
+EFL_END_TEST
+
 void eo_test_general(TCase *tc)
 {
    tcase_add_test(tc, eo_simple);
@@ -1866,8 +2425,16 @@ void eo_test_general(TCase *tc)
    tcase_add_test(tc, eo_comment);
    tcase_add_test(tc, eo_rec_interface);
    tcase_add_test(tc, eo_domain);
+   tcase_add_test(tc, eo_domain_shared_lookup);
+   tcase_add_test(tc, eo_domain_shared_override_del);
+   tcase_add_test(tc, eo_domain_shared_override_clear);
    tcase_add_test(tc, efl_cast_test);
    tcase_add_test(tc, efl_object_destruct_test);
    tcase_add_test(tc, efl_object_auto_unref_test);
    tcase_add_test(tc, efl_object_size);
+   tcase_add_test(tc, efl_object_data_layout);
+   tcase_add_test(tc, efl_object_call_cache);
+   tcase_add_test(tc, efl_object_direct_call);
+   tcase_add_test(tc, efl_object_bulk);
+   tcase_add_test(tc, efl_object_bulk_many);
 }
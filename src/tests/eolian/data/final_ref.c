@@ -0,0 +1,88 @@
+
+void _final_value_set(Eo *obj, Final_Data *pd, int value);
+
+
+static void
+__eolian_final_value_set_reflect(Eo *obj, Eina_Value val)
+{
+   int cval;
+   eina_value_int_convert(&val, &cval);
+   final_value_set(obj, cval);
+   eina_value_flush(&val);
+}
+
+EOAPI EFL_VOID_FUNC_BODYV_DIRECT(final_value_set, FINAL_CLASS, _final_value_set, EFL_FUNC_CALL(value), int value);
+
+int _final_value_get(const Eo *obj, Final_Data *pd);
+
+
+static Eina_Value
+__eolian_final_value_get_reflect(Eo *obj)
+{
+   int val = final_value_get(obj);
+   return eina_value_int_init(val);
+}
+
+EOAPI EFL_FUNC_BODY_CONST_DIRECT(final_value_get, FINAL_CLASS, _final_value_get, int, 5);
+
+void _final_reset(Eo *obj, Final_Data *pd);
+
+EOAPI EFL_VOID_FUNC_BODY_DIRECT(final_reset, FINAL_CLASS, _final_reset);
+
+int _final_sum(const Eo *obj, Final_Data *pd, int x);
+
+EOAPI EFL_FUNC_BODYV_CONST_DIRECT(final_sum, FINAL_CLASS, _final_sum, int, 0, EFL_FUNC_CALL(x), int x);
+
+void _final_owned(Eo *obj, Final_Data *pd, char *s);
+
+static void
+_final_owned_ownership_fallback(char *s)
+{
+   free(s);
+}
+
+EOAPI EFL_VOID_FUNC_BODYV_FALLBACK(final_owned, _final_owned_ownership_fallback(s);, EFL_FUNC_CALL(s), char *s);
+
+static Eina_Bool
+_final_class_initializer(Efl_Class *klass)
+{
+   const Efl_Object_Ops *opsp = NULL;
+
+   const Efl_Object_Property_Reflection_Ops *ropsp = NULL;
+
+#ifndef FINAL_EXTRA_OPS
+#define FINAL_EXTRA_OPS
+#endif
+
+   EFL_OPS_DEFINE(ops,
+      EFL_OBJECT_OP_FUNC(final_value_set, _final_value_set),
+      EFL_OBJECT_OP_FUNC(final_value_get, _final_value_get),
+      EFL_OBJECT_OP_FUNC(final_reset, _final_reset),
+      EFL_OBJECT_OP_FUNC(final_sum, _final_sum),
+      EFL_OBJECT_OP_FUNC(final_owned, _final_owned),
+      FINAL_EXTRA_OPS
+   );
+   opsp = &ops;
+
+   static const Efl_Object_Property_Reflection refl_table[] = {
+      {"value", __eolian_final_value_set_reflect, __eolian_final_value_get_reflect},
+   };
+   static const Efl_Object_Property_Reflection_Ops rops = {
+      refl_table, EINA_C_ARRAY_LENGTH(refl_table)
+   };
+   ropsp = &rops;
+
+   return efl_class_functions_set(klass, opsp, ropsp);
+}
+
+static const Efl_Class_Description _final_class_desc = {
+   EO_VERSION,
+   "Final",
+   EFL_CLASS_TYPE_REGULAR,
+   sizeof(Final_Data),
+   _final_class_initializer,
+   NULL,
+   NULL
+};
+
+EFL_DEFINE_CLASS(final_class_get, &_final_class_desc, NULL, NULL);
@@ -4,6 +4,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <unistd.h>
 
 #ifdef _WIN32
 #include "Evil.h"
@@ -237,6 +238,54 @@ EFL_START_TEST(owning)
 }
 EFL_END_TEST
 
+EFL_START_TEST(eolian_final_generation)
+{
+   char output_filepath[PATH_MAX + 128] = "";
+   snprintf(output_filepath, PATH_MAX, "%s/eolian_final",
+            eina_environment_tmp_get());
+   _remove_ref(output_filepath, "eo.c");
+   fail_if(0 != _eolian_gen_execute(TESTS_SRC_DIR"/data/final.eo", "-gc", output_filepath));
+   fail_if(!_files_compare(TESTS_SRC_DIR"/data/final_ref.c", output_filepath, "eo.c"));
+}
+EFL_END_TEST
+
+EFL_START_TEST(eolian_cache_generation)
+{
+   char output_filepath[PATH_MAX + 128] = "";
+   char options[PATH_MAX];
+   Eina_Tmpstr *cache_dir = NULL;
+   Eina_Iterator *it;
+   const char *f;
+   unsigned int entries = 0;
+
+   fail_if(!eina_file_mkdtemp("eolian_cache_XXXXXX", &cache_dir));
+   snprintf(options, sizeof(options), "-gc -C \"%s\"", cache_dir);
+   snprintf(output_filepath, PATH_MAX, "%s/eolian_cache_simple",
+            eina_environment_tmp_get());
+
+   /* the first run fills the cache, the second one writes from it */
+   _remove_ref(output_filepath, "eo.c");
+   fail_if(0 != _eolian_gen_execute(TESTS_SRC_DIR"/data/class_simple.eo", options, output_filepath));
+   fail_if(!_files_compare(TESTS_SRC_DIR"/data/class_simple_ref.c", output_filepath, "eo.c"));
+   _remove_ref(output_filepath, "eo.c");
+   fail_if(0 != _eolian_gen_execute(TESTS_SRC_DIR"/data/class_simple.eo", options, output_filepath));
+   fail_if(!_files_compare(TESTS_SRC_DIR"/data/class_simple_ref.c", output_filepath, "eo.c"));
+
+   it = eina_file_ls(cache_dir);
+   EINA_ITERATOR_FOREACH(it, f)
+     {
+        entries++;
+        remove(f);
+        eina_stringshare_del(f);
+     }
+   eina_iterator_free(it);
+   ck_assert_int_eq(entries, 1);
+
+   rmdir(cache_dir);
+   eina_tmpstr_del(cache_dir);
+}
+EFL_END_TEST
+
 void eolian_generation_test(TCase *tc)
 {
    tcase_add_test(tc, eolian_types_generation);
@@ -248,4 +297,6 @@ void eolian_generation_test(TCase *tc)
    tcase_add_test(tc, eolian_docs);
    tcase_add_test(tc, eolian_function_pointers);
    tcase_add_test(tc, owning);
+   tcase_add_test(tc, eolian_final_generation);
+   tcase_add_test(tc, eolian_cache_generation);
 }
@@ -1648,6 +1648,29 @@ EFL_START_TEST(eolian_class_unimpl)
 }
 EFL_END_TEST
 
+EFL_START_TEST(eolian_class_final)
+{
+   const Eolian_Class *cl;
+
+   Eolian_State *eos = eolian_state_new();
+
+   fail_if(!eolian_state_directory_add(eos, TESTS_SRC_DIR"/data"));
+
+   fail_if(!eolian_state_file_parse(eos, TESTS_SRC_DIR"/data/final.eo"));
+   fail_if(!(cl = eolian_state_class_by_name_get(eos, "Final")));
+   fail_if(!eolian_class_is_final(cl));
+
+   fail_if(!eolian_state_file_parse(eos, TESTS_SRC_DIR"/data/override.eo"));
+   fail_if(!(cl = eolian_state_class_by_name_get(eos, "Override")));
+   fail_if(eolian_class_is_final(cl));
+
+   /* final classes cannot be inherited from */
+   fail_if(eolian_state_file_parse(eos, TESTS_SRC_DIR"/data/final_child.eo"));
+
+   eolian_state_free(eos);
+}
+EFL_END_TEST
+
 void eolian_parsing_test(TCase *tc)
 {
    tcase_add_test(tc, eolian_simple_parsing);
@@ -1674,4 +1697,5 @@ void eolian_parsing_test(TCase *tc)
    tcase_add_test(tc, eolian_mixins_require);
    tcase_add_test(tc, eolian_class_requires_classes);
    tcase_add_test(tc, eolian_class_unimpl);
+   tcase_add_test(tc, eolian_class_final);
 }
@@ -228,6 +228,67 @@ EFL_START_TEST(eolian_cxx_test_type_callback)
 }
 EFL_END_TEST
 
+static void
+_test_event3_cb(nonamespace::Generic, int v)
+{
+  ck_assert(v == 42);
+}
+
+EFL_START_TEST(eolian_cxx_test_event_connection)
+{
+  efl::eo::eo_init i;
+
+  int calls = 0;
+  int* counter = &calls;
+
+  nonamespace::Generic g(efl::eo::instantiate);
+
+  static_assert(decltype(g.prefix_event1_event)::description() == GENERIC_EVENT_PREFIX_EVENT1
+                , "event description is not a constant expression");
+
+  auto inline_cb = [counter] (nonamespace::Generic) { ++*counter; };
+  static_assert(efl::eolian::_detail::is_inline_callable<decltype(inline_cb)>::value
+                , "pointer sized lambda should not be allocated");
+  static_assert(efl::eolian::_detail::is_inline_callable<decltype(&_test_event3_cb)>::value
+                , "function pointer should not be allocated");
+
+  efl::eolian::signal_connection c1 = efl::eolian::event_add(g.prefix_event1_event, g, inline_cb);
+  efl::eolian::signal_connection c2 = efl::eolian::event_add(g.prefix_event3_event, g, &_test_event3_cb);
+  g.call_event1();
+  g.call_event3();
+  ck_assert_int_eq(calls, 1);
+
+  c1.disconnect();
+  c2.disconnect();
+  g.call_event1();
+  ck_assert_int_eq(calls, 1);
+
+  {
+    // Captures too much to fit in the callback data, goes to the heap.
+    int unused[4] = {0, 0, 0, 0};
+    efl::eolian::scoped_signal_connection c3
+      (efl::eolian::event_add(g.prefix_event1_event, g, [counter, unused] (nonamespace::Generic)
+                              {
+                                ++*counter;
+                                (void)unused;
+                              }));
+    g.call_event1();
+    ck_assert_int_eq(calls, 2);
+  }
+  g.call_event1();
+  ck_assert_int_eq(calls, 2);
+
+  {
+    efl::eolian::scoped_signal_connection c4
+      (efl::eolian::event_add(g.prefix_event1_event, g, inline_cb));
+    g.call_event1();
+    ck_assert_int_eq(calls, 3);
+  }
+  g.call_event1();
+  ck_assert_int_eq(calls, 3);
+}
+EFL_END_TEST
+
 using efl::eolian::grammar::attributes::klass_def;
 using efl::eolian::grammar::attributes::function_def;
 using efl::eolian::grammar::attributes::property_def;
@@ -360,6 +421,7 @@ eolian_cxx_test_binding(TCase* tc)
    tcase_add_test(tc, eolian_cxx_test_type_generation_return);
    tcase_add_test(tc, eolian_cxx_test_type_generation_optional);
    tcase_add_test(tc, eolian_cxx_test_type_callback);
+   tcase_add_test(tc, eolian_cxx_test_event_connection);
    tcase_add_test(tc, eolian_cxx_test_properties);
    tcase_add_test(tc, eolian_cxx_test_parent_extensions);
    tcase_add_test(tc, eolian_cxx_test_cls_get);
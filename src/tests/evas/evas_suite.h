@@ -18,6 +18,7 @@ void evas_test_mesh1(TCase *tc);
 void evas_test_mesh2(TCase *tc);
 void evas_test_mesh3(TCase *tc);
 void evas_test_mask(TCase *tc);
+void evas_test_blend(TCase *tc);
 void evas_test_evasgl(TCase *tc);
 void evas_test_object_smart(TCase *tc);
 void evas_test_matrix(TCase *tc);
@@ -0,0 +1,247 @@
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif
+
+#ifdef BUILD_ENGINE_BUFFER
+
+#include <Evas.h>
+#include <Ecore_Evas.h>
+
+#include "../../lib/evas/include/evas_common_private.h"
+
+#include "evas_suite.h"
+#include "evas_tests_helpers.h"
+
+/* The spans are drawn by whatever the CPU offers (AVX2, SSE3, MMX, NEON or
+ * plain C). The reference pixels below are computed with the C macros, so
+ * every optimized path has to match the C code to the bit. The object is
+ * 37 pixels wide so that both the vector loops and their tails run. */
+
+#define W 48
+#define H 12
+#define OX 5
+#define OY 2
+#define OW 37
+#define OH 7
+
+#define BG 0xff285078
+
+#define START_BLEND_TEST() \
+   Ecore_Evas *ee; Evas *e; Evas_Object *bg; \
+   ee = ecore_evas_buffer_new(W, H); \
+   ecore_evas_show(ee); \
+   ecore_evas_manual_render_set(ee, EINA_TRUE); \
+   e = ecore_evas_get(ee); \
+   bg = evas_object_rectangle_add(e); \
+   evas_object_color_set(bg, 0x28, 0x50, 0x78, 0xff); \
+   evas_object_geometry_set(bg, 0, 0, W, H); \
+   evas_object_show(bg); \
+   do {} while (0)
+
+#define END_BLEND_TEST() do { \
+   evas_object_del(bg); \
+   ecore_evas_free(ee); \
+   } while (0)
+
+typedef DATA32 (*Blend_Ref_Func) (DATA32 s, DATA32 d);
+
+static DATA32
+_ref_blend(DATA32 s, DATA32 d)
+{
+   return s + MUL_256(256 - (s >> 24), d);
+}
+
+static DATA32
+_ref_mul(DATA32 s, DATA32 d)
+{
+   return MUL4_SYM(s, d);
+}
+
+static DATA32
+_ref_mul_color(DATA32 c, DATA32 d)
+{
+   /* alpha only colors have their own, slightly different span */
+   if (c == ((c >> 24) * 0x01010101))
+     return MUL_256(1 + (c >> 24), d);
+   return MUL4_SYM(c, d);
+}
+
+static DATA32
+_ref_copy(DATA32 s, DATA32 d EINA_UNUSED)
+{
+   return s;
+}
+
+static void
+_pixels_fill(DATA32 *data, Eina_Bool alpha)
+{
+   DATA32 seed = 0x12345678;
+   int i;
+
+   for (i = 0; i < OW * OH; i++)
+     {
+        DATA32 a, r, g, b;
+
+        seed = (seed * 1103515245) + 12345;
+        a = alpha ? (seed >> 24) : 0xff;
+        /* runs of transparent and opaque pixels for the sparse spans */
+        if (alpha && ((i % OW) < 9)) a = ((i / OW) & 1) ? 0xff : 0;
+        r = (((seed >> 16) & 0xff) * a) / 255;
+        g = (((seed >> 8) & 0xff) * a) / 255;
+        b = ((seed & 0xff) * a) / 255;
+        data[i] = (a << 24) | (r << 16) | (g << 8) | b;
+     }
+}
+
+static void
+_pixels_check(Ecore_Evas *ee, const DATA32 *src, DATA32 col, Blend_Ref_Func ref)
+{
+   const DATA32 *out;
+   int x, y;
+
+   ecore_evas_manual_render(ee);
+   out = ecore_evas_buffer_pixels_get(ee);
+   ck_assert(out != NULL);
+
+   for (y = 0; y < H; y++)
+     for (x = 0; x < W; x++)
+       {
+          DATA32 expected = BG;
+
+          if ((x >= OX) && (x < OX + OW) && (y >= OY) && (y < OY + OH))
+            expected = ref(src ? src[((y - OY) * OW) + (x - OX)] : col, BG);
+          /* the alpha of a non alpha canvas is not meaningful */
+          ck_assert_int_eq(out[(y * W) + x] & 0xffffff, expected & 0xffffff);
+       }
+}
+
+static Evas_Object *
+_image_add(Evas *e, DATA32 *data, Eina_Bool alpha, Evas_Render_Op op)
+{
+   Evas_Object *o;
+
+   o = evas_object_image_add(e);
+   evas_object_image_size_set(o, OW, OH);
+   evas_object_image_alpha_set(o, alpha);
+   evas_object_image_data_copy_set(o, data);
+   evas_object_image_data_update_add(o, 0, 0, OW, OH);
+   evas_object_image_fill_set(o, 0, 0, OW, OH);
+   evas_object_geometry_set(o, OX, OY, OW, OH);
+   evas_object_render_op_set(o, op);
+   evas_object_show(o);
+
+   return o;
+}
+
+static Evas_Object *
+_rect_add(Evas *e, DATA32 col, Evas_Render_Op op)
+{
+   Evas_Object *o;
+
+   o = evas_object_rectangle_add(e);
+   evas_object_color_set(o, (col >> 16) & 0xff, (col >> 8) & 0xff,
+                         col & 0xff, col >> 24);
+   evas_object_geometry_set(o, OX, OY, OW, OH);
+   evas_object_render_op_set(o, op);
+   evas_object_show(o);
+
+   return o;
+}
+
+EFL_START_TEST(evas_blend_test_pixel)
+{
+   DATA32 data[OW * OH];
+   Evas_Object *o;
+
+   START_BLEND_TEST();
+
+   _pixels_fill(data, EINA_TRUE);
+   o = _image_add(e, data, EINA_TRUE, EVAS_RENDER_BLEND);
+   _pixels_check(ee, data, 0, _ref_blend);
+   evas_object_del(o);
+
+   END_BLEND_TEST();
+}
+EFL_END_TEST
+
+EFL_START_TEST(evas_blend_test_color)
+{
+   static const DATA32 colors[] = {
+      0x80402010, /* generic */
+      0x80808080, /* alpha only */
+      0x10000000
+   };
+   Evas_Object *o;
+   unsigned int i;
+
+   START_BLEND_TEST();
+
+   for (i = 0; i < EINA_C_ARRAY_LENGTH(colors); i++)
+     {
+        o = _rect_add(e, colors[i], EVAS_RENDER_BLEND);
+        _pixels_check(ee, NULL, colors[i], _ref_blend);
+        evas_object_del(o);
+     }
+
+   END_BLEND_TEST();
+}
+EFL_END_TEST
+
+EFL_START_TEST(evas_blend_test_copy)
+{
+   DATA32 data[OW * OH];
+   Evas_Object *o;
+
+   START_BLEND_TEST();
+
+   _pixels_fill(data, EINA_FALSE);
+   o = _image_add(e, data, EINA_FALSE, EVAS_RENDER_COPY);
+   _pixels_check(ee, data, 0, _ref_copy);
+   evas_object_del(o);
+
+   o = _rect_add(e, 0xff102030, EVAS_RENDER_COPY);
+   _pixels_check(ee, NULL, 0xff102030, _ref_copy);
+   evas_object_del(o);
+
+   END_BLEND_TEST();
+}
+EFL_END_TEST
+
+EFL_START_TEST(evas_blend_test_mul)
+{
+   static const DATA32 colors[] = {
+      0xffc06430, /* opaque */
+      0x80808080, /* alpha only */
+      0x80402010
+   };
+   DATA32 data[OW * OH];
+   Evas_Object *o;
+   unsigned int i;
+
+   START_BLEND_TEST();
+
+   _pixels_fill(data, EINA_FALSE);
+   o = _image_add(e, data, EINA_FALSE, EVAS_RENDER_MUL);
+   _pixels_check(ee, data, 0, _ref_mul);
+   evas_object_del(o);
+
+   for (i = 0; i < EINA_C_ARRAY_LENGTH(colors); i++)
+     {
+        o = _rect_add(e, colors[i], EVAS_RENDER_MUL);
+        _pixels_check(ee, NULL, colors[i], _ref_mul_color);
+        evas_object_del(o);
+     }
+
+   END_BLEND_TEST();
+}
+EFL_END_TEST
+
+void evas_test_blend(TCase *tc)
+{
+   tcase_add_test(tc, evas_blend_test_pixel);
+   tcase_add_test(tc, evas_blend_test_color);
+   tcase_add_test(tc, evas_blend_test_copy);
+   tcase_add_test(tc, evas_blend_test_mul);
+}
+
+#endif // BUILD_ENGINE_BUFFER
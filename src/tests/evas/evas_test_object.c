@@ -30,7 +30,208 @@ EFL_START_TEST(evas_object_various)
 }
 EFL_END_TEST
 
+static void
+_hit_test_check(Evas *evas, Evas_Object **objs, Evas_Object *bg, int cols)
+{
+   Eina_List *l;
+   int x, y;
+
+   for (y = 0; y < cols * 8; y += 3)
+     for (x = 0; x < cols * 8; x += 3)
+       {
+          Evas_Object *expected = bg;
+
+          if (((x % 8) < 6) && ((y % 8) < 6))
+            expected = objs[((y / 8) * cols) + (x / 8)];
+          l = evas_tree_objects_at_xy_get(evas, NULL, x, y);
+          ck_assert_int_eq(eina_list_count(l), 1);
+          ck_assert_ptr_eq(eina_list_data_get(l), expected);
+          eina_list_free(l);
+       }
+}
+
+EFL_START_TEST(evas_object_hit_test_many)
+{
+   const int cols = 24;
+   Evas_Object *objs[24 * 24], *bg, *grabber, *member;
+   Ecore_Evas *ee;
+   Evas *evas;
+   Eina_List *l;
+   int i, pass;
+
+   ee = ecore_evas_buffer_new(500, 500);
+   ecore_evas_show(ee);
+   ecore_evas_manual_render_set(ee, EINA_TRUE);
+   evas = ecore_evas_get(ee);
+
+   bg = evas_object_rectangle_add(evas);
+   evas_object_geometry_set(bg, 0, 0, 500, 500);
+   evas_object_show(bg);
+   for (i = 0; i < cols * cols; i++)
+     {
+        objs[i] = evas_object_rectangle_add(evas);
+        evas_object_geometry_set(objs[i], (i % cols) * 8, (i / cols) * 8, 6, 6);
+        evas_object_show(objs[i]);
+     }
+   ecore_evas_manual_render(ee);
+
+   /* several queries on an unchanged canvas go through the hit grid */
+   for (pass = 0; pass < 3; pass++)
+     _hit_test_check(evas, objs, bg, cols);
+
+   /* moving an object must be seen right away */
+   evas_object_move(objs[0], 300, 300);
+   l = evas_tree_objects_at_xy_get(evas, NULL, 301, 301);
+   ck_assert_ptr_eq(eina_list_data_get(l), objs[0]);
+   eina_list_free(l);
+   l = evas_tree_objects_at_xy_get(evas, NULL, 301, 301);
+   ck_assert_ptr_eq(eina_list_data_get(l), objs[0]);
+   eina_list_free(l);
+   l = evas_tree_objects_at_xy_get(evas, NULL, 1, 1);
+   ck_assert_ptr_eq(eina_list_data_get(l), bg);
+   eina_list_free(l);
+   evas_object_move(objs[0], 0, 0);
+   for (pass = 0; pass < 2; pass++)
+     _hit_test_check(evas, objs, bg, cols);
+
+   /* repeat events and stacking are kept */
+   evas_object_repeat_events_set(objs[1], EINA_TRUE);
+   for (pass = 0; pass < 2; pass++)
+     {
+        l = evas_tree_objects_at_xy_get(evas, NULL, 9, 1);
+        ck_assert_int_eq(eina_list_count(l), 2);
+        ck_assert_ptr_eq(eina_list_nth(l, 0), objs[1]);
+        ck_assert_ptr_eq(eina_list_nth(l, 1), bg);
+        eina_list_free(l);
+     }
+   evas_object_repeat_events_set(objs[1], EINA_FALSE);
+   evas_object_raise(bg);
+   for (pass = 0; pass < 2; pass++)
+     {
+        l = evas_tree_objects_at_xy_get(evas, NULL, 1, 1);
+        ck_assert_ptr_eq(eina_list_data_get(l), bg);
+        eina_list_free(l);
+     }
+   evas_object_lower(bg);
+
+   /* an event grabber takes events wherever its members are, whatever its
+    * own geometry */
+   grabber = evas_object_event_grabber_add(evas);
+   member = evas_object_rectangle_add(evas);
+   evas_object_geometry_set(member, 250, 250, 20, 20);
+   evas_object_show(member);
+   evas_object_smart_member_add(member, grabber);
+   evas_object_show(grabber);
+   for (pass = 0; pass < 2; pass++)
+     {
+        l = evas_tree_objects_at_xy_get(evas, NULL, 255, 255);
+        ck_assert_int_eq(eina_list_count(l), 1);
+        ck_assert_ptr_eq(eina_list_data_get(l), member);
+        eina_list_free(l);
+     }
+   evas_object_del(grabber);
+   evas_object_del(member);
+   for (pass = 0; pass < 2; pass++)
+     _hit_test_check(evas, objs, bg, cols);
+
+   /* deleted objects leave the grid */
+   evas_object_del(objs[2]);
+   objs[2] = bg;
+   for (pass = 0; pass < 2; pass++)
+     _hit_test_check(evas, objs, bg, cols);
+
+   ecore_evas_free(ee);
+}
+EFL_END_TEST
+
+EFL_START_TEST(evas_object_hit_test_color_changes)
+{
+   const int cols = 24;
+   Evas_Object *objs[24 * 24], *expected[24 * 24], *bg, *clip;
+   Ecore_Evas *ee;
+   Evas *evas;
+   Eina_List *l;
+   int i, pass;
+
+   ee = ecore_evas_buffer_new(500, 500);
+   ecore_evas_show(ee);
+   ecore_evas_manual_render_set(ee, EINA_TRUE);
+   evas = ecore_evas_get(ee);
+
+   bg = evas_object_rectangle_add(evas);
+   evas_object_geometry_set(bg, 0, 0, 500, 500);
+   evas_object_show(bg);
+   for (i = 0; i < cols * cols; i++)
+     {
+        objs[i] = evas_object_rectangle_add(evas);
+        evas_object_geometry_set(objs[i], (i % cols) * 8, (i / cols) * 8, 6, 6);
+        evas_object_show(objs[i]);
+        expected[i] = objs[i];
+     }
+   ecore_evas_manual_render(ee);
+
+   /* color changes between queries keep the results right */
+   for (pass = 0; pass < 4; pass++)
+     {
+        for (i = pass; i < cols * cols; i += 7)
+          evas_object_color_set(objs[i], pass * 60, 255 - pass * 60, 0, 255);
+        _hit_test_check(evas, expected, bg, cols);
+        ecore_evas_manual_render(ee);
+     }
+
+   /* visibility is checked on every query */
+   evas_object_hide(objs[5]);
+   expected[5] = bg;
+   evas_object_color_set(objs[6], 0, 0, 255, 255);
+   for (pass = 0; pass < 2; pass++)
+     _hit_test_check(evas, expected, bg, cols);
+   evas_object_show(objs[5]);
+   expected[5] = objs[5];
+   evas_object_color_set(objs[6], 255, 0, 0, 255);
+   for (pass = 0; pass < 2; pass++)
+     _hit_test_check(evas, expected, bg, cols);
+
+   /* so is clipping, and a color change on the clipper moves nothing */
+   clip = evas_object_rectangle_add(evas);
+   evas_object_geometry_set(clip, 0, 0, 3, 3);
+   evas_object_show(clip);
+   evas_object_clip_set(objs[0], clip);
+   for (pass = 0; pass < 2; pass++)
+     {
+        evas_object_color_set(clip, 255, 255, 255, 255 - pass);
+        l = evas_tree_objects_at_xy_get(evas, NULL, 1, 1);
+        ck_assert_ptr_eq(eina_list_data_get(l), objs[0]);
+        eina_list_free(l);
+        l = evas_tree_objects_at_xy_get(evas, NULL, 4, 4);
+        ck_assert_ptr_eq(eina_list_data_get(l), bg);
+        eina_list_free(l);
+     }
+   evas_object_del(clip);
+   for (pass = 0; pass < 2; pass++)
+     _hit_test_check(evas, expected, bg, cols);
+
+   /* a move mixed with color changes is seen right away */
+   for (pass = 0; pass < 2; pass++)
+     _hit_test_check(evas, expected, bg, cols);
+   evas_object_color_set(objs[7], 0, 255, 0, 255);
+   evas_object_move(objs[7], 300, 300);
+   evas_object_color_set(objs[8], 0, 255, 0, 255);
+   expected[7] = bg;
+   for (pass = 0; pass < 2; pass++)
+     {
+        l = evas_tree_objects_at_xy_get(evas, NULL, 301, 301);
+        ck_assert_ptr_eq(eina_list_data_get(l), objs[7]);
+        eina_list_free(l);
+        _hit_test_check(evas, expected, bg, cols);
+     }
+
+   ecore_evas_free(ee);
+}
+EFL_END_TEST
+
 void evas_test_object(TCase *tc)
 {
    tcase_add_test(tc, evas_object_various);
+   tcase_add_test(tc, evas_object_hit_test_many);
+   tcase_add_test(tc, evas_object_hit_test_color_changes);
 }
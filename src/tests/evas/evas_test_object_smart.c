@@ -213,8 +213,170 @@ EFL_START_TEST(evas_object_smart_clipped_smart_move)
 }
 EFL_END_TEST
 
+EFL_START_TEST(evas_object_smart_render_cache)
+{
+   const int W = 32;
+   const int H = 32;
+   Ecore_Evas *ee;
+   Evas *evas;
+   Evas_Smart *smart;
+   Evas_Object *bg, *smart_obj, *r1, *r2;
+   unsigned int *ref, *data;
+   unsigned int hits, misses;
+   size_t memory;
+
+   ee = ecore_evas_buffer_new(W, H);
+   ecore_evas_show(ee);
+   ecore_evas_manual_render_set(ee, EINA_TRUE);
+   evas = ecore_evas_get(ee);
+
+   bg = evas_object_rectangle_add(evas);
+   evas_object_geometry_set(bg, 0, 0, W, H);
+   evas_object_color_set(bg, 0, 0xFF, 0, 0xFF);
+   evas_object_show(bg);
+
+   Evas_Smart_Class sc = EVAS_SMART_CLASS_INIT_NAME_VERSION("Cached");
+   evas_object_smart_clipped_smart_set(&sc);
+   smart = evas_smart_class_new(&sc);
+   fail_if(!smart);
+
+   smart_obj = evas_object_smart_add(evas, smart);
+   evas_object_geometry_set(smart_obj, 0, 0, W, H);
+
+   r1 = evas_object_rectangle_add(evas);
+   evas_object_smart_member_add(r1, smart_obj);
+   evas_object_geometry_set(r1, 4, 4, 8, 8);
+   evas_object_color_set(r1, 0xFF, 0, 0, 0xFF);
+   evas_object_show(r1);
+
+   r2 = evas_object_rectangle_add(evas);
+   evas_object_smart_member_add(r2, smart_obj);
+   evas_object_geometry_set(r2, 8, 8, 12, 12);
+   evas_object_color_set(r2, 0, 0, 0x80, 0x80);
+   evas_object_show(r2);
+   evas_object_show(smart_obj);
+
+   ecore_evas_manual_render(ee);
+   ref = malloc(W * H * 4);
+   memcpy(ref, ecore_evas_buffer_pixels_get(ee), W * H * 4);
+
+   efl_canvas_object_render_cache_set(smart_obj, EINA_TRUE);
+   fail_if(!efl_canvas_object_render_cache_get(smart_obj));
+
+   /* the first frame fills the cache, it must look the same */
+   evas_damage_rectangle_add(evas, 0, 0, W, H);
+   ecore_evas_manual_render(ee);
+   data = (unsigned int *) ecore_evas_buffer_pixels_get(ee);
+   fail_if(memcmp(data, ref, W * H * 4));
+   efl_canvas_object_render_cache_stats_get(smart_obj, &memory, &hits, &misses);
+   ck_assert_int_eq(misses, 1);
+   ck_assert_int_eq(hits, 0);
+   fail_if(memory == 0);
+
+   /* nothing changed, the next frame is a blit of the cache */
+   evas_damage_rectangle_add(evas, 0, 0, W, H);
+   ecore_evas_manual_render(ee);
+   data = (unsigned int *) ecore_evas_buffer_pixels_get(ee);
+   fail_if(memcmp(data, ref, W * H * 4));
+   efl_canvas_object_render_cache_stats_get(smart_obj, NULL, &hits, &misses);
+   ck_assert_int_eq(misses, 1);
+   ck_assert_int_eq(hits, 1);
+
+   /* a member change renders the subtree again */
+   evas_object_color_set(r1, 0, 0, 0xFF, 0xFF);
+   ecore_evas_manual_render(ee);
+   data = (unsigned int *) ecore_evas_buffer_pixels_get(ee);
+   ck_assert_int_eq(data[5 * W + 5], 0xFF0000FF);
+   efl_canvas_object_render_cache_stats_get(smart_obj, NULL, NULL, &misses);
+   ck_assert_int_eq(misses, 2);
+
+   efl_canvas_object_render_cache_set(smart_obj, EINA_FALSE);
+   efl_canvas_object_render_cache_stats_get(smart_obj, &memory, &hits, &misses);
+   ck_assert_int_eq(memory, 0);
+   ck_assert_int_eq(hits, 0);
+
+   free(ref);
+   evas_object_del(smart_obj);
+   ecore_evas_free(ee);
+}
+EFL_END_TEST
+
+EFL_START_TEST(evas_object_smart_render_cache_hidden_change)
+{
+   const int W = 32;
+   const int H = 32;
+   Ecore_Evas *ee;
+   Evas *evas;
+   Evas_Smart *smart;
+   Evas_Object *bg, *smart_obj, *r1, *r2;
+   unsigned int *data;
+   unsigned int misses;
+
+   ee = ecore_evas_buffer_new(W, H);
+   ecore_evas_show(ee);
+   ecore_evas_manual_render_set(ee, EINA_TRUE);
+   evas = ecore_evas_get(ee);
+
+   bg = evas_object_rectangle_add(evas);
+   evas_object_geometry_set(bg, 0, 0, W, H);
+   evas_object_color_set(bg, 0, 0xFF, 0, 0xFF);
+   evas_object_show(bg);
+
+   Evas_Smart_Class sc = EVAS_SMART_CLASS_INIT_NAME_VERSION("Cached");
+   evas_object_smart_clipped_smart_set(&sc);
+   smart = evas_smart_class_new(&sc);
+   fail_if(!smart);
+
+   smart_obj = evas_object_smart_add(evas, smart);
+   evas_object_geometry_set(smart_obj, 0, 0, W, H);
+
+   r1 = evas_object_rectangle_add(evas);
+   evas_object_smart_member_add(r1, smart_obj);
+   evas_object_geometry_set(r1, 4, 4, 8, 8);
+   evas_object_color_set(r1, 0xFF, 0, 0, 0xFF);
+   evas_object_show(r1);
+
+   r2 = evas_object_rectangle_add(evas);
+   evas_object_smart_member_add(r2, smart_obj);
+   evas_object_geometry_set(r2, 16, 16, 8, 8);
+   evas_object_color_set(r2, 0, 0, 0xFF, 0xFF);
+   evas_object_show(r2);
+   evas_object_show(smart_obj);
+
+   efl_canvas_object_render_cache_set(smart_obj, EINA_TRUE);
+   ecore_evas_manual_render(ee);
+   data = (unsigned int *) ecore_evas_buffer_pixels_get(ee);
+   ck_assert_int_eq(data[5 * W + 5], 0xFFFF0000);
+   efl_canvas_object_render_cache_stats_get(smart_obj, NULL, NULL, &misses);
+   ck_assert_int_eq(misses, 1);
+
+   /* the change produces no update region, the group is not drawn */
+   evas_obscured_rectangle_add(evas, 0, 0, 16, 16);
+   evas_object_color_set(r1, 0xFF, 0xFF, 0xFF, 0xFF);
+   ecore_evas_manual_render(ee);
+   data = (unsigned int *) ecore_evas_buffer_pixels_get(ee);
+   ck_assert_int_eq(data[5 * W + 5], 0xFFFF0000);
+
+   /* revealed by a change that is not a member one, the cache must not
+    * still hold the old color */
+   evas_obscured_clear(evas);
+   evas_damage_rectangle_add(evas, 0, 0, W, H);
+   ecore_evas_manual_render(ee);
+   data = (unsigned int *) ecore_evas_buffer_pixels_get(ee);
+   ck_assert_int_eq(data[5 * W + 5], 0xFFFFFFFF);
+   ck_assert_int_eq(data[17 * W + 17], 0xFF0000FF);
+   efl_canvas_object_render_cache_stats_get(smart_obj, NULL, NULL, &misses);
+   ck_assert_int_eq(misses, 2);
+
+   evas_object_del(smart_obj);
+   ecore_evas_free(ee);
+}
+EFL_END_TEST
+
 void evas_test_object_smart(TCase *tc)
 {
    tcase_add_test(tc, evas_object_smart_paragraph_direction);
    tcase_add_test(tc, evas_object_smart_clipped_smart_move);
+   tcase_add_test(tc, evas_object_smart_render_cache);
+   tcase_add_test(tc, evas_object_smart_render_cache_hidden_change);
 }
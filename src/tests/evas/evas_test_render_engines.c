@@ -3,8 +3,11 @@
 #endif
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include <Evas.h>
+#include <Ecore_Evas.h>
 
 #include "evas_suite.h"
 
@@ -75,8 +78,207 @@ EFL_START_TEST(evas_render_lookup)
 }
 EFL_END_TEST
 
+#ifdef BUILD_ENGINE_BUFFER
+/* Big enough for the async renders to be cut in several tiles */
+#define TILED_W 320
+#define TILED_H 320
+
+static void
+_tiled_evas_restart(const char *threads)
+{
+   ck_assert_int_eq(ecore_evas_shutdown(), 0);
+   ck_assert_int_eq(evas_shutdown(), 0);
+   if (threads)
+     setenv("EVAS_RENDER_THREADS", threads, 1);
+   else
+     unsetenv("EVAS_RENDER_THREADS");
+   ck_assert_int_eq(evas_init(), 1);
+   ck_assert_int_eq(ecore_evas_init(), 1);
+}
+
+static unsigned int *
+_tiled_scene_render(void)
+{
+   unsigned int src[40 * 40], *ret;
+   Evas_Object *o;
+   Ecore_Evas *ee;
+   Evas *e;
+   int i;
+
+   ee = ecore_evas_buffer_new(TILED_W, TILED_H);
+   ck_assert(ee != NULL);
+   ecore_evas_show(ee);
+   e = ecore_evas_get(ee);
+
+   o = evas_object_rectangle_add(e);
+   evas_object_color_set(o, 40, 80, 120, 255);
+   evas_object_geometry_set(o, 0, 0, TILED_W, TILED_H);
+   evas_object_show(o);
+
+   /* a smooth scaled image samples across the tile borders */
+   for (i = 0; i < 40 * 40; i++)
+     {
+        unsigned int a = (i * 7) & 0xff;
+
+        src[i] = (a << 24) | ((a * (i % 40) / 40) << 16) |
+          ((a * (i / 40) / 40) << 8) | (a / 2);
+     }
+   o = evas_object_image_filled_add(e);
+   evas_object_image_size_set(o, 40, 40);
+   evas_object_image_alpha_set(o, EINA_TRUE);
+   evas_object_image_smooth_scale_set(o, EINA_TRUE);
+   evas_object_image_data_copy_set(o, src);
+   evas_object_image_data_update_add(o, 0, 0, 40, 40);
+   evas_object_geometry_set(o, 3, 5, TILED_W - 11, TILED_H - 7);
+   evas_object_show(o);
+
+   for (i = 0; i < 4; i++)
+     {
+        o = evas_object_rectangle_add(e);
+        evas_object_color_set(o, 30 * i, 100, 60, 100 + 30 * i);
+        evas_object_geometry_set(o, 17 * i, 31 * i, 250, 233);
+        evas_object_show(o);
+     }
+
+   /* not manual, so this goes through evas_render_async() */
+   ret = malloc(TILED_W * TILED_H * sizeof (unsigned int));
+   ck_assert(ret != NULL);
+   memcpy(ret, ecore_evas_buffer_pixels_get(ee),
+          TILED_W * TILED_H * sizeof (unsigned int));
+
+   ecore_evas_free(ee);
+   return ret;
+}
+
+EFL_START_TEST(evas_render_async_tiled)
+{
+   unsigned int *serial, *tiled;
+
+   _tiled_evas_restart("1");
+   serial = _tiled_scene_render();
+
+   _tiled_evas_restart("4");
+   tiled = _tiled_scene_render();
+
+   _tiled_evas_restart(NULL);
+
+   ck_assert(!memcmp(serial, tiled, TILED_W * TILED_H * sizeof (unsigned int)));
+   free(serial);
+   free(tiled);
+}
+EFL_END_TEST
+
+#define SPAN_W 200
+#define SPAN_H 100
+
+static unsigned int *
+_span_pixels_dup(Ecore_Evas *ee)
+{
+   unsigned int *ret;
+
+   ret = malloc(SPAN_W * SPAN_H * sizeof (unsigned int));
+   ck_assert(ret != NULL);
+   memcpy(ret, ecore_evas_buffer_pixels_get(ee),
+          SPAN_W * SPAN_H * sizeof (unsigned int));
+   return ret;
+}
+
+/* A smart group on the left, big enough to get its own span of active
+ * objects once cached, and a rect that moves on the right */
+static Ecore_Evas *
+_span_scene_new(int mover_x, int mover_y, Evas_Object **mover)
+{
+   static Evas_Smart *smart = NULL;
+   Evas_Object *o, *group;
+   Ecore_Evas *ee;
+   Evas *e;
+   int i;
+
+   if (!smart)
+     {
+        static Evas_Smart_Class sc = EVAS_SMART_CLASS_INIT_NAME_VERSION("span_group");
+
+        evas_object_smart_clipped_smart_set(&sc);
+        smart = evas_smart_class_new(&sc);
+     }
+
+   ee = ecore_evas_buffer_new(SPAN_W, SPAN_H);
+   ck_assert(ee != NULL);
+   ecore_evas_show(ee);
+   e = ecore_evas_get(ee);
+
+   o = evas_object_rectangle_add(e);
+   evas_object_color_set(o, 40, 80, 120, 255);
+   evas_object_geometry_set(o, 0, 0, SPAN_W, SPAN_H);
+   evas_object_show(o);
+
+   group = evas_object_smart_add(e, smart);
+   evas_object_geometry_set(group, 10, 10, 80, 80);
+   for (i = 0; i < 6; i++)
+     {
+        o = evas_object_rectangle_add(e);
+        evas_object_color_set(o, 40 * i, 200 - 30 * i, 60, 120 + 20 * i);
+        evas_object_geometry_set(o, 10 + 7 * i, 10 + 9 * i, 35, 30);
+        evas_object_smart_member_add(o, group);
+        evas_object_show(o);
+     }
+   evas_object_show(group);
+
+   *mover = evas_object_rectangle_add(e);
+   evas_object_color_set(*mover, 200, 40, 40, 180);
+   evas_object_geometry_set(*mover, mover_x, mover_y, 20, 20);
+   evas_object_show(*mover);
+
+   return ee;
+}
+
+EFL_START_TEST(evas_render_cached_span_skip)
+{
+   unsigned int *pixels, *ref;
+   Evas_Object *mover, *ref_mover;
+   Ecore_Evas *ee, *ref_ee;
+   int i;
+
+   ee = _span_scene_new(110, 10, &mover);
+   /* the group stays put while the rect moves, after a few frames it
+    * is drawn from its render cache and the update regions, all on the
+    * right, skip its span */
+   for (i = 0; i < 10; i++)
+     {
+        evas_object_move(mover, 110 + 5 * i, 10 + 4 * i);
+        free(_span_pixels_dup(ee));
+     }
+   pixels = _span_pixels_dup(ee);
+
+   /* a fresh canvas has no cache, so it walks every object */
+   ref_ee = _span_scene_new(110 + 5 * 9, 10 + 4 * 9, &ref_mover);
+   ref = _span_pixels_dup(ref_ee);
+   ck_assert(!memcmp(pixels, ref, SPAN_W * SPAN_H * sizeof (unsigned int)));
+   free(pixels);
+   free(ref);
+
+   /* then an update region that does overlap the cached group */
+   evas_object_move(mover, 60, 40);
+   pixels = _span_pixels_dup(ee);
+   ecore_evas_free(ref_ee);
+   ref_ee = _span_scene_new(60, 40, &ref_mover);
+   ref = _span_pixels_dup(ref_ee);
+   ck_assert(!memcmp(pixels, ref, SPAN_W * SPAN_H * sizeof (unsigned int)));
+   free(pixels);
+   free(ref);
+
+   ecore_evas_free(ref_ee);
+   ecore_evas_free(ee);
+}
+EFL_END_TEST
+#endif
+
 void evas_test_render_engines(TCase *tc)
 {
    tcase_add_test(tc, evas_render_engines);
    tcase_add_test(tc, evas_render_lookup);
+#ifdef BUILD_ENGINE_BUFFER
+   tcase_add_test(tc, evas_render_async_tiled);
+   tcase_add_test(tc, evas_render_cached_span_skip);
+#endif
 }